@@ -6,6 +6,11 @@ import math
 
 #To enable this script, you need to edit the getPythonDataSourceEnabled function in the config.py file to return True.
 
+#The channel functions may return a tuple or any object implementing the buffer protocol (a NumPy array, array.array or bytes)
+#of int16, float32 or float64 samples. Buffers are copied at once, which is much faster than a tuple for large blocks.
+#A getStereoData() function may be defined instead of both channel functions. It returns one buffer of interleaved
+#left and right samples or a pair of buffers (left, right).
+
 #The variable numberOfSamples should be set to dataLength. However, to keep the script simple for generating a sine wave, this value is being overwritten with a fixed number (4096).
 def initialize(dataLength, samplingRate):
     global numberOfSamples
@@ -20,22 +25,10 @@ def getLeftChannelData():
     signalFrequency = 1001.293945313 #Hz
     samplingPeriod = 1.0 / fs
     fullScaleAmplitude = 32767
-    result = tuple()
-
-    for n in range(numberOfSamples):
-        y = fullScaleAmplitude * math.sin(2 * math.pi * n * signalFrequency * samplingPeriod)
-        result += (y,)
-
-    return result
+    return tuple(fullScaleAmplitude * math.sin(2 * math.pi * n * signalFrequency * samplingPeriod) for n in range(numberOfSamples))
 
 def getRightChannelData():
     signalFrequency = 10 * 1001.293945313 #Hz
     samplingPeriod = 1.0 / fs
     fullScaleAmplitude = 32767
-    result = tuple()
-
-    for n in range(numberOfSamples):
-        y = fullScaleAmplitude * math.sin(2 * math.pi * n * signalFrequency * samplingPeriod)
-        result += (y,)
-
-    return result
+    return tuple(fullScaleAmplitude * math.sin(2 * math.pi * n * signalFrequency * samplingPeriod) for n in range(numberOfSamples))
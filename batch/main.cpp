@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/BatchAnalyzer.hpp"
+#include "core/ConfigReader.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+void printUsage()
+{
+    std::cout<<R"(Usage: spectrum-analyzer-batch [options] file...
+
+Computes bar spectra of WAV, RF64 or raw PCM files with the analyzer processing chain.
+
+Options:
+  -t <0-9>      color theme whose configuration is used (default 1)
+  -j <threads>  number of worker threads (default: number of cores)
+  -f <csv|bin>  output format (default csv)
+  -o <dir>      output directory (default current directory)
+)"<<std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    ThemeConfig theme = ThemeConfig::Theme1;
+    uint32_t numberOfThreads{0};
+    BatchOutputFormat outputFormat{BatchOutputFormat::Csv};
+    std::string outputDirectory{"."};
+    std::vector<std::string> inputPaths;
+
+    try
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            const std::string argument = argv[i];
+            const bool hasValue = (i + 1 < argc);
+
+            if((argument == "-t") && hasValue)
+            {
+                theme = static_cast<ThemeConfig>(std::stoi(argv[++i]));
+            }
+            else if((argument == "-j") && hasValue)
+            {
+                numberOfThreads = std::stoul(argv[++i]);
+            }
+            else if((argument == "-f") && hasValue)
+            {
+                outputFormat = (std::string(argv[++i]) == "bin") ? BatchOutputFormat::Binary : BatchOutputFormat::Csv;
+            }
+            else if((argument == "-o") && hasValue)
+            {
+                outputDirectory = argv[++i];
+            }
+            else if(!argument.empty() && (argument.front() == '-'))
+            {
+                printUsage();
+                return 1;
+            }
+            else
+            {
+                inputPaths.push_back(argument);
+            }
+        }
+    }
+    catch(const std::exception &)
+    {
+        printUsage();
+        return 1;
+    }
+
+    if(inputPaths.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    ConfigReader configReader(theme, Mode::Analyzer);
+    const Configuration &config = configReader.getConfig();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    BatchAnalyzer batchAnalyzer(config, numberOfThreads);
+    const bool allInputsProcessed = batchAnalyzer.run(inputPaths, outputDirectory, outputFormat);
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout<<"Finished in "<<elapsed.count()<<" ms"<<std::endl;
+
+    return allInputsProcessed ? 0 : 1;
+}
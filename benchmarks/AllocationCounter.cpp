@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+std::atomic<uint64_t> numberOfAllocations{0};
+
+void* allocate(std::size_t size)
+{
+    numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if(void *pointer = std::malloc(size ? size : 1))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+}
+
+uint64_t getNumberOfAllocations()
+{
+    return numberOfAllocations.load(std::memory_order_relaxed);
+}
+
+// the aligned and nothrow forms of the operators are left to the standard library
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
@@ -0,0 +1,12 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// number of calls of the global operator new made by all threads of the benchmarks
+uint64_t getNumberOfAllocations();
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "BenchmarkHelpers.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+namespace
+{
+
+constexpr double PI = 3.14159265358979323846;
+
+// a fixed seed keeps the input identical between runs and machines
+std::mt19937 getGenerator()
+{
+    return std::mt19937(12345);
+}
+
+}
+
+std::vector<float> generateBenchmarkSignal(uint32_t numberOfSamples)
+{
+    auto generator = getGenerator();
+    std::normal_distribution<float> noise(0, 0.05);
+    std::vector<float> signal(numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        signal[i] = 0.5 * std::sin(2 * PI * 1000 * i / benchmarkSamplingRate) + noise(generator);
+    }
+
+    return signal;
+}
+
+std::vector<std::complex<float>> generateBenchmarkSpectrum(uint32_t numberOfBins)
+{
+    auto generator = getGenerator();
+    std::uniform_real_distribution<float> value(-1000, 1000);
+    std::vector<std::complex<float>> spectrum(numberOfBins);
+
+    for(auto &bin : spectrum)
+    {
+        bin = {value(generator), value(generator)};
+    }
+
+    return spectrum;
+}
+
+std::vector<float> generateBenchmarkDbfsValues(uint32_t numberOfValues)
+{
+    auto generator = getGenerator();
+    std::uniform_real_distribution<float> value(-96, 0);
+    std::vector<float> values(numberOfValues);
+
+    for(auto &element : values)
+    {
+        element = value(generator);
+    }
+
+    return values;
+}
+
+std::vector<float> getHannWindow(uint32_t numberOfSamples)
+{
+    std::vector<float> window(numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        window[i] = 0.5 - 0.5 * std::cos(2 * PI * i / (numberOfSamples - 1));
+    }
+
+    return window;
+}
+
+Frequencies getLogarithmicallySpacedFrequencies(uint32_t numberOfBars, uint32_t samplingRate)
+{
+    const double lowestFrequency{20};
+    const double highestFrequency = samplingRate / 2.0;
+    Frequencies frequencies(numberOfBars);
+
+    for(uint32_t i=0; i<numberOfBars; ++i)
+    {
+        frequencies[i] = lowestFrequency * std::pow(highestFrequency / lowestFrequency, static_cast<double>(i) / std::max<uint32_t>(numberOfBars - 1, 1));
+    }
+
+    return frequencies;
+}
+
+std::chrono::nanoseconds getCpuTimeOfThread(std::thread &thread)
+{
+#if defined(_WIN32)
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+
+    if(!GetThreadTimes(thread.native_handle(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return {};
+    }
+
+    auto toHundredsOfNanoseconds = [](const FILETIME &fileTime)
+    {
+        return (static_cast<uint64_t>(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime;
+    };
+
+    return std::chrono::nanoseconds((toHundredsOfNanoseconds(kernelTime) + toHundredsOfNanoseconds(userTime)) * 100);
+#else
+    clockid_t clockId;
+    timespec time{};
+
+    if((pthread_getcpuclockid(thread.native_handle(), &clockId) != 0) || (clock_gettime(clockId, &time) != 0))
+    {
+        return {};
+    }
+
+    return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+#endif
+}
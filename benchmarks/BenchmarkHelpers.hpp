@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "core/CommonTypes.hpp"
+#include <chrono>
+#include <complex>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+constexpr uint32_t benchmarkSamplingRate{48000};
+
+// sweeps shared by the benchmarks, they cover the sizes used by the themes
+const std::vector<int64_t> fftSizes{1024, 4096, 16384, 65536};
+const std::vector<int64_t> numbersOfBars{32, 128, 512, 2048};
+const std::vector<int64_t> overlapsInPercents{0, 50, 75, 90};
+
+std::vector<float> generateBenchmarkSignal(uint32_t numberOfSamples);
+std::vector<std::complex<float>> generateBenchmarkSpectrum(uint32_t numberOfBins);
+std::vector<float> generateBenchmarkDbfsValues(uint32_t numberOfValues);
+std::vector<float> getHannWindow(uint32_t numberOfSamples);
+
+// bars spread logarithmically from 20 Hz up to the Nyquist frequency
+Frequencies getLogarithmicallySpacedFrequencies(uint32_t numberOfBars, uint32_t samplingRate=benchmarkSamplingRate);
+
+// CPU time used so far by a running thread
+std::chrono::nanoseconds getCpuTimeOfThread(std::thread &thread);
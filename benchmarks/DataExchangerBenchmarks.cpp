@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "BenchmarkHelpers.hpp"
+#include "core/DataExchanger.hpp"
+#include <benchmark/benchmark.h>
+#include <thread>
+
+
+// one round trip between two threads, which is what every hand-over between stages costs
+void BM_DataExchangerPingPong(benchmark::State &state)
+{
+    const auto values = generateBenchmarkDbfsValues(state.range(0));
+    const uint32_t maxQueueSize{10};
+
+    DataExchanger<std::vector<float>> requests(maxQueueSize);
+    DataExchanger<std::vector<float>> responses(maxQueueSize);
+
+    std::thread echoThread([&]()
+    {
+        while(true)
+        {
+            auto value = requests.get();
+
+            if(value.empty())
+            {
+                break;
+            }
+            responses.push_back(std::move(value));
+        }
+    });
+
+    for(auto _ : state)
+    {
+        auto value = values;
+        requests.push_back(std::move(value));
+        benchmark::DoNotOptimize(responses.get());
+    }
+
+    requests.stop();
+    echoThread.join();
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_DataExchangerPingPong)->ArgName("bars")->ArgsProduct({numbersOfBars})->UseRealTime();
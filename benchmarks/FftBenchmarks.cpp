@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "BenchmarkHelpers.hpp"
+#include "core/FftCalculator.hpp"
+#include "core/Helpers.hpp"
+#include <benchmark/benchmark.h>
+
+
+template<typename Calculator>
+void BM_FftCalculator(benchmark::State &state)
+{
+    const uint32_t fftSize = state.range(0);
+    const auto signal = generateBenchmarkSignal(fftSize);
+    Calculator calculator(fftSize);
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(calculator.calculate(signal));
+    }
+
+    state.SetItemsProcessed(state.iterations() * fftSize);
+}
+
+BENCHMARK_TEMPLATE(BM_FftCalculator, RealFftCalculator)->ArgName("fftSize")->ArgsProduct({fftSizes});
+BENCHMARK_TEMPLATE(BM_FftCalculator, ComplexFftCalculator)->ArgName("fftSize")->ArgsProduct({fftSizes});
+
+// every iteration adds one hop of new samples, so calculate() returns one spectrum as in the app
+void BM_WelchCalculator(benchmark::State &state)
+{
+    const auto fftType = static_cast<FftType>(state.range(0));
+    const uint32_t fftSize = state.range(1);
+    const float overlapping = state.range(2) / 100.0f;
+    const auto hopSize = calculateHopSize(fftSize, overlapping);
+    const auto signal = generateBenchmarkSignal(hopSize);
+
+    WelchCalculator welchCalculator(fftType, fftSize, overlapping, getHannWindow(fftSize));
+
+    for(uint32_t numberOfSamples=0; numberOfSamples<fftSize; numberOfSamples+=hopSize)
+    {
+        welchCalculator.updateBuffer(signal);
+    }
+    welchCalculator.calculate();
+
+    for(auto _ : state)
+    {
+        welchCalculator.updateBuffer(signal);
+        benchmark::DoNotOptimize(welchCalculator.calculate());
+    }
+
+    state.SetItemsProcessed(state.iterations() * hopSize);
+}
+
+BENCHMARK(BM_WelchCalculator)->ArgNames({"fftType", "fftSize", "overlap"})
+    ->ArgsProduct({{static_cast<int64_t>(FftType::Real), static_cast<int64_t>(FftType::Complex)}, fftSizes, overlapsInPercents});
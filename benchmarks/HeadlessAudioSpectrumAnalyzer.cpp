@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "HeadlessAudioSpectrumAnalyzer.hpp"
+#include "AllocationCounter.hpp"
+#include "BenchmarkHelpers.hpp"
+#include "core/Stats.hpp"
+#include "dataSource/DataSourceBase.hpp"
+
+// in the order in which init() starts the threads
+const std::vector<std::string> HeadlessAudioSpectrumAnalyzer::stageNames{"samplesUpdater", "fftCalculator", "processing", "drafter"};
+
+HeadlessAudioSpectrumAnalyzer::HeadlessAudioSpectrumAnalyzer(const Configuration &configuration):
+    AudioSpectrumAnalyzer(configuration)
+{
+}
+
+PipelineReport HeadlessAudioSpectrumAnalyzer::run(std::chrono::milliseconds warmUpTime, std::chrono::milliseconds measurementTime)
+{
+    init();
+
+    std::this_thread::sleep_for(warmUpTime);
+    const auto first = takeSnapshot();
+    std::this_thread::sleep_for(measurementTime);
+    const auto last = takeSnapshot();
+
+    shouldProceed.store(false);
+    SpectrumAnalyzerBase::run();
+
+    PipelineReport report;
+    report.elapsedTime = last.time - first.time;
+    report.numberOfFrames = last.numberOfFrames - first.numberOfFrames;
+    report.numberOfAllocations = last.numberOfAllocations - first.numberOfAllocations;
+
+    for(const auto &[name, cpuTime] : last.cpuTimePerStage)
+    {
+        report.cpuTimePerStage[name] = cpuTime - first.cpuTimePerStage.at(name);
+    }
+
+    for(const auto &[name, numberOfDroppedValues] : last.numberOfDroppedValuesPerQueue)
+    {
+        report.numberOfDroppedValuesPerQueue[name] = numberOfDroppedValues - first.numberOfDroppedValuesPerQueue.at(name);
+    }
+
+    return report;
+}
+
+void HeadlessAudioSpectrumAnalyzer::init()
+{
+    Metrics::clear();
+    threads.push_back(std::thread(&HeadlessAudioSpectrumAnalyzer::samplesUpdater,this));
+    threads.push_back(std::thread(&HeadlessAudioSpectrumAnalyzer::fftCalculator,this));
+    threads.push_back(std::thread(&HeadlessAudioSpectrumAnalyzer::processing,this));
+    threads.push_back(std::thread(&HeadlessAudioSpectrumAnalyzer::drafter,this));
+}
+
+void HeadlessAudioSpectrumAnalyzer::samplesUpdater()
+{
+    const std::string processName{"samplesUpdater"};
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::SamplesUpdater, processName);
+
+    const uint32_t maxNumberOfPendingBlocks = std::max<uint32_t>(config.get<MaxQueueSize>() / 2, 1);
+    const auto signal = generateBenchmarkSignal(getNumberOfSamplesToBeCollectedFromHw());
+
+    numberOfSamplesCollectedFromHw.store(signal.size());
+
+    while(shouldProceed)
+    {
+        // the same back pressure as for a source which is not realtime, with a shorter sleep;
+        // spinning instead would starve the other stages when the theme gives this thread
+        // a realtime priority
+        if(dataExchanger.getSize() >= maxNumberOfPendingBlocks)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            continue;
+        }
+
+        const auto processingScope = stageMetrics->startProcessing();
+        dataExchanger.push_back(std::make_unique<std::any>(StereoData{signal, signal, std::chrono::steady_clock::now()}));
+    }
+
+    dataExchanger.stop();
+}
+
+void HeadlessAudioSpectrumAnalyzer::drafter()
+{
+    const std::string processName{"drafter"};
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::Drafter, processName);
+
+    while(shouldProceed)
+    {
+        const auto timestampedData = processedDataMailbox.getNewValue();
+
+        if(timestampedData == nullptr)
+        {
+            processedDataMailbox.waitForNewValue(100ms);
+            continue;
+        }
+
+        const auto processingScope = stageMetrics->startProcessing();
+
+        stageMetrics->recordLatency(timestampedData->captureTime);
+        numberOfFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void HeadlessAudioSpectrumAnalyzer::flowController()
+{
+}
+
+HeadlessAudioSpectrumAnalyzer::Snapshot HeadlessAudioSpectrumAnalyzer::takeSnapshot()
+{
+    Snapshot snapshot{std::chrono::steady_clock::now(), numberOfFrames.load(), getNumberOfAllocations()};
+
+    for(uint32_t i=0; i<stageNames.size(); ++i)
+    {
+        snapshot.cpuTimePerStage[stageNames.at(i)] = getCpuTimeOfThread(threads.at(i));
+    }
+
+    snapshot.numberOfDroppedValuesPerQueue["samples"] = dataExchanger.getNumberOfDroppedValues();
+    snapshot.numberOfDroppedValuesPerQueue["fft"] = fftDataExchanger.getNumberOfDroppedValues();
+    snapshot.numberOfDroppedValuesPerQueue["processed"] = processedDataMailbox.getNumberOfOverwrittenValues();
+
+    return snapshot;
+}
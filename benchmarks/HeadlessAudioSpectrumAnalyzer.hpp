@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "core/AudioSpectrumAnalyzer.hpp"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+
+
+struct PipelineReport
+{
+    std::chrono::nanoseconds elapsedTime{};
+    uint64_t numberOfFrames{0};
+    uint64_t numberOfAllocations{0};
+    std::map<std::string, std::chrono::nanoseconds> cpuTimePerStage;
+    std::map<std::string, uint64_t> numberOfDroppedValuesPerQueue;
+};
+
+// Runs the fftCalculator and processing stages of AudioSpectrumAnalyzer between a synthetic
+// source, which is limited only by the samples queue, and a drafter which draws nothing.
+// The flow controller is not started, so the overlapping configured by the theme is kept
+// and every run does the same amount of work per block.
+class HeadlessAudioSpectrumAnalyzer : public AudioSpectrumAnalyzer
+{
+public:
+    HeadlessAudioSpectrumAnalyzer(const Configuration &configuration);
+
+    // everything done during the warm-up (FFTW planning, filling the queues) is left out
+    PipelineReport run(std::chrono::milliseconds warmUpTime, std::chrono::milliseconds measurementTime);
+
+    void init() override;
+    void samplesUpdater() override;
+    void drafter() override;
+    void flowController() override;
+
+private:
+    struct Snapshot
+    {
+        std::chrono::steady_clock::time_point time;
+        uint64_t numberOfFrames;
+        uint64_t numberOfAllocations;
+        std::map<std::string, std::chrono::nanoseconds> cpuTimePerStage;
+        std::map<std::string, uint64_t> numberOfDroppedValuesPerQueue;
+    };
+
+    Snapshot takeSnapshot();
+
+    static const std::vector<std::string> stageNames;
+    std::atomic<uint64_t> numberOfFrames{0};
+};
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "HeadlessAudioSpectrumAnalyzer.hpp"
+#include "core/ConfigReader.hpp"
+#include <benchmark/benchmark.h>
+
+
+namespace
+{
+
+constexpr std::chrono::milliseconds warmUpTime{1000};
+constexpr std::chrono::milliseconds measurementTime{3000};
+
+}
+
+// Sustainable throughput of the whole pipeline with the configuration of each theme. Frames
+// per second is the headroom over DesiredFrameRate, cpu_<stage> is the share of one core used
+// by the stage and dropped_<queue> counts values thrown away by a queue which overflowed.
+void BM_Pipeline(benchmark::State &state)
+{
+    ConfigReader configReader(static_cast<ThemeConfig>(state.range(0)), Mode::Analyzer);
+    const Configuration config = configReader.getConfig();
+
+    for(auto _ : state)
+    {
+        HeadlessAudioSpectrumAnalyzer analyzer(config);
+        const auto report = analyzer.run(warmUpTime, measurementTime);
+        const double elapsedTime = std::chrono::duration<double>(report.elapsedTime).count();
+
+        state.SetIterationTime(elapsedTime);
+        state.counters["fps"] = report.numberOfFrames / elapsedTime;
+        state.counters["allocations_per_frame"] = report.numberOfFrames ? static_cast<double>(report.numberOfAllocations) / report.numberOfFrames : 0;
+
+        for(const auto &[name, cpuTime] : report.cpuTimePerStage)
+        {
+            state.counters["cpu_" + name] = benchmark::Counter(100 * std::chrono::duration<double>(cpuTime).count() / elapsedTime);
+        }
+
+        for(const auto &[name, numberOfDroppedValues] : report.numberOfDroppedValuesPerQueue)
+        {
+            state.counters["dropped_" + name] = numberOfDroppedValues;
+        }
+    }
+
+    state.counters["fft_size"] = config.get<NumberOfSamples>();
+    state.counters["bars"] = config.get<Freqs>().size();
+}
+
+BENCHMARK(BM_Pipeline)->ArgName("theme")->DenseRange(0, 9)->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
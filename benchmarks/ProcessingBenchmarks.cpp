@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "BenchmarkHelpers.hpp"
+#include "core/DataCalculator.hpp"
+#include "core/FftBinCombiner.hpp"
+#include "core/FrequenciesInfo.hpp"
+#include "core/Helpers.hpp"
+#include <benchmark/benchmark.h>
+
+
+namespace
+{
+
+constexpr float scalingFactor{1};
+constexpr float offsetFactor{0};
+
+const std::vector<int64_t> numbersOfSignals{1, 4, 16};
+
+}
+
+void BM_FrequenciesInfo(benchmark::State &state)
+{
+    const uint32_t fftSize = state.range(0);
+    const auto frequencies = getLogarithmicallySpacedFrequencies(state.range(1));
+
+    for(auto _ : state)
+    {
+        FrequenciesInfo frequenciesInfo(benchmarkSamplingRate, fftSize, frequencies);
+        benchmark::DoNotOptimize(frequenciesInfo.getAllFrequencyIndexes());
+    }
+}
+
+BENCHMARK(BM_FrequenciesInfo)->ArgNames({"fftSize", "bars"})->ArgsProduct({fftSizes, numbersOfBars})->Unit(benchmark::kMicrosecond);
+
+void BM_FftBinCombinerMagnitudes(benchmark::State &state)
+{
+    const uint32_t fftSize = state.range(0);
+    const auto spectrum = generateBenchmarkSpectrum(fftSize);
+    FrequenciesInfo frequenciesInfo(benchmarkSamplingRate, fftSize, getLogarithmicallySpacedFrequencies(state.range(1)));
+    FftBinCombiner fftBinCombiner(scalingFactor, offsetFactor, getFloorDbFs16bit(), frequenciesInfo.getAllFrequencyIndexes());
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(fftBinCombiner.combineMagnitudes(spectrum));
+    }
+
+    state.SetItemsProcessed(state.iterations() * fftSize);
+}
+
+BENCHMARK(BM_FftBinCombinerMagnitudes)->ArgNames({"fftSize", "bars"})->ArgsProduct({fftSizes, numbersOfBars});
+
+void BM_FftBinCombinerRmsValues(benchmark::State &state)
+{
+    const uint32_t fftSize = state.range(0);
+    const auto spectrum = generateBenchmarkSpectrum(fftSize);
+    FrequenciesInfo frequenciesInfo(benchmarkSamplingRate, fftSize, getLogarithmicallySpacedFrequencies(state.range(1)));
+    FftBinCombiner fftBinCombiner(scalingFactor, offsetFactor, getFloorDbFs16bit(), frequenciesInfo.getAllFrequencyIndexes());
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(fftBinCombiner.combineRmsValues(spectrum));
+    }
+
+    state.SetItemsProcessed(state.iterations() * fftSize);
+}
+
+BENCHMARK(BM_FftBinCombinerRmsValues)->ArgNames({"fftSize", "bars"})->ArgsProduct({fftSizes, numbersOfBars});
+
+// the calculators are fed one spectrum per iteration, the same way the processing thread does
+template<typename Calculator>
+void runDataCalculator(benchmark::State &state, Calculator &calculator)
+{
+    const auto values = generateBenchmarkDbfsValues(state.range(0));
+
+    for(auto _ : state)
+    {
+        calculator.push_back(values);
+        benchmark::DoNotOptimize(calculator.calculate());
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+void BM_DataMaxHolder(benchmark::State &state)
+{
+    DataMaxHolder dataMaxHolder(state.range(0), state.range(1), getFloorDbFs16bit());
+    runDataCalculator(state, dataMaxHolder);
+}
+
+BENCHMARK(BM_DataMaxHolder)->ArgNames({"bars", "signals"})->ArgsProduct({numbersOfBars, numbersOfSignals});
+
+void BM_DataAverager(benchmark::State &state)
+{
+    DataAverager dataAverager(state.range(0), state.range(1));
+    runDataCalculator(state, dataAverager);
+}
+
+BENCHMARK(BM_DataAverager)->ArgNames({"bars", "signals"})->ArgsProduct({numbersOfBars, numbersOfSignals});
+
+void BM_DataSmoother(benchmark::State &state)
+{
+    DataSmoother dataSmoother(state.range(0), 0.2);
+    runDataCalculator(state, dataSmoother);
+}
+
+BENCHMARK(BM_DataSmoother)->ArgName("bars")->ArgsProduct({numbersOfBars});
+
+void BM_ScaleDbfsToPercents(benchmark::State &state)
+{
+    const auto values = generateBenchmarkDbfsValues(state.range(0));
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(scaleDbfsToPercents(values, 0, getFloorDbFs16bit()));
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK(BM_ScaleDbfsToPercents)->ArgName("bars")->ArgsProduct({numbersOfBars});
@@ -14,6 +14,27 @@
 #include "FftBinCombiner.hpp"
 #include <optional>
 
+namespace
+{
+
+// calculators keeping the history of each bar, they are created again when bars are merged
+// or when the source changes the floor the held maximum starts from
+struct BarCalculators
+{
+    BarCalculators(const Configuration &config, const uint32_t numberOfBars, const float floorDbFs):
+        dataMaxHolder(numberOfBars, config.get<NumberOfSignalsForMaxHold>(), floorDbFs),
+        dataAverager(numberOfBars, config.get<NumberOfSignalsForAveraging>()),
+        dataSmoother(numberOfBars, config.get<AlphaFactor>())
+    {
+    }
+
+    DataMaxHolder dataMaxHolder;
+    DataAverager dataAverager;
+    DataSmoother dataSmoother;
+};
+
+}
+
 AudioSpectrumAnalyzer::AudioSpectrumAnalyzer(const Configuration &configuration, std::promise<AppEvent> &&appEvent):
     AudioSpectrumAnalyzerBase(configuration, std::move(appEvent))
 {
@@ -31,18 +52,24 @@ void AudioSpectrumAnalyzer::init()
 void AudioSpectrumAnalyzer::fftCalculator()
 {
     const std::string processName{"fftCalculator"};
-    StatsManager statsManager(processName);
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::FftCalculator, processName);
 
     float overlapping = calculateOverlapping(config.get<SamplingRate>(), config.get<NumberOfSamples>(), config.get<DesiredFrameRate>());
 
     WelchCalculator fft(FftType::Real, config.get<NumberOfSamples>(), overlapping,  config.get<SignalWindow>());
+    uint32_t fftSize = config.get<NumberOfSamples>();
+
+    // measuring a plan takes far longer than a frame, so it must not happen when the governor is already lowering quality
+    if(config.get<QualityGovernorSettings>().enabled)
+    {
+        fft.prepareFftSize(getFftSize(QualityLevel::SmallerFftSize, config.get<NumberOfSamples>()));
+    }
 
     while(shouldProceed)
     {
         const auto &dataInTimeDomain  = dataExchanger.get();
-        const auto &newOverlapping = flowControlDataExchanger.getWithoutBlocking();
-
-        if(newOverlapping != std::nullopt)
+        if(const auto *newOverlapping = overlappingMailbox.getNewValue())
         {
             overlapping = *newOverlapping;
         }
@@ -52,18 +79,27 @@ void AudioSpectrumAnalyzer::fftCalculator()
             continue;
         }
 
-        statsManager.update();
+        const auto processingScope = stageMetrics->startProcessing();
 
         auto stereoData = std::any_cast<StereoData>(*dataInTimeDomain);
 
+        // a smaller FFT uses every n-th value of the window, so its shape and scaling stay the same
+        if(const auto demandedFftSize = getFftSize(qualityLevel.load(), config.get<NumberOfSamples>()); demandedFftSize != fftSize)
+        {
+            fftSize = demandedFftSize;
+            fft.updateFftSize(fftSize, takeEveryNthValue(config.get<SignalWindow>(), config.get<NumberOfSamples>() / fftSize));
+        }
+
         fft.updateOverlapping(overlapping);
-        fft.updateBuffer(getAverage(stereoData.left, stereoData.right));
+        fft.updateBuffer(getAverage(stereoData.left, stereoData.right), stereoData.captureTime);
 
         auto fftResult = fft.calculate();
+        const auto &captureTimes = fft.getCaptureTimes();
 
         for(uint32_t i=0; i<fftResult.size(); ++i)
         {
-            fftDataExchanger.push_back(std::make_unique<std::any>(std::move(fftResult.at(i))));
+            stageMetrics->recordLatency(captureTimes.at(i));
+            fftDataExchanger.push_back(std::make_unique<std::any>(Timestamped<FftResult>{std::move(fftResult.at(i)), captureTimes.at(i)}));
         }
 
     }
@@ -74,15 +110,18 @@ void AudioSpectrumAnalyzer::fftCalculator()
 void AudioSpectrumAnalyzer::processing()
 {
     const std::string processName{"processing"};
-    StatsManager statsManager(processName);
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::Processing, processName);
 
     FrequenciesInfo frequenciesInfo(config.get<SamplingRate>(), config.get<NumberOfSamples>(), config.get<Freqs>());
-    DataMaxHolder dataMaxHolder(frequenciesInfo.numberOfFrequencies(), config.get<NumberOfSignalsForMaxHold>(), getFloorDbFs16bit());
-    DataAverager dataAverager(frequenciesInfo.numberOfFrequencies(), config.get<NumberOfSignalsForAveraging>());
-    DataSmoother dataSmoother(frequenciesInfo.numberOfFrequencies(), config.get<AlphaFactor>());
+    const uint32_t numberOfBars = frequenciesInfo.numberOfFrequencies();
+    float currentFloorDbFs = floorDbFs.load();
+    auto barCalculators = std::make_unique<BarCalculators>(config, numberOfBars, currentFloorDbFs);
 
-    FftBinCombiner fftBinCombiner(config.get<ScalingFactor>(), config.get<OffsetFactor>(), frequenciesInfo.getAllFrequencyIndexes());
+    FftBinCombiner fftBinCombiner(config.get<ScalingFactor>(), config.get<OffsetFactor>(), currentFloorDbFs, frequenciesInfo.getAllFrequencyIndexes());
 
+    uint32_t fftSize = config.get<NumberOfSamples>();
+    uint32_t numberOfMergedBars{1};
 
     while(shouldProceed)
     {
@@ -93,29 +132,59 @@ void AudioSpectrumAnalyzer::processing()
             continue;
         }
 
-        statsManager.update();
+        const auto processingScope = stageMetrics->startProcessing();
 
-        dataMaxHolder.push_back(fftBinCombiner.combineMagnitudes(std::any_cast<FftResult>(*fftResult)));
+        const auto &timestampedFftResult = std::any_cast<const Timestamped<FftResult>&>(*fftResult);
 
-        auto dataWithMaxValue = dataMaxHolder.calculate();
+        // the FFT size is known from the result, so bins are assigned again once the first result of a new size arrives
+        const uint32_t demandedNumberOfMergedBars = getNumberOfMergedBars(qualityLevel.load());
+        const float demandedFloorDbFs = floorDbFs.load();
+
+        if((demandedNumberOfMergedBars != numberOfMergedBars) || (demandedFloorDbFs != currentFloorDbFs))
+        {
+            currentFloorDbFs = demandedFloorDbFs;
+            fftBinCombiner.updateFloorDbFs(currentFloorDbFs);
+            barCalculators = std::make_unique<BarCalculators>(config, (numberOfBars + demandedNumberOfMergedBars - 1) / demandedNumberOfMergedBars, currentFloorDbFs);
+        }
+
+        if((timestampedFftResult.value.size() != fftSize) || (demandedNumberOfMergedBars != numberOfMergedBars))
+        {
+
+            fftSize = timestampedFftResult.value.size();
+            numberOfMergedBars = demandedNumberOfMergedBars;
+            frequenciesInfo = FrequenciesInfo(config.get<SamplingRate>(), fftSize, config.get<Freqs>());
+
+            const bool reducedQuality = (fftSize != config.get<NumberOfSamples>()) || (numberOfMergedBars > 1);
+            fftBinCombiner.updateFrequencyIndexes(reducedQuality ? frequenciesInfo.getFrequencyIndexesOfMergedRectangles(numberOfMergedBars) : frequenciesInfo.getAllFrequencyIndexes());
+        }
+
+        barCalculators->dataMaxHolder.push_back(fftBinCombiner.combineMagnitudes(timestampedFftResult.value));
+
+        auto dataWithMaxValue = barCalculators->dataMaxHolder.calculate();
 
         if(!dataWithMaxValue.empty())
         {
-            dataAverager.push_back(dataWithMaxValue);
+            barCalculators->dataAverager.push_back(dataWithMaxValue);
 
-            auto averagedData = dataAverager.calculate();
+            auto averagedData = barCalculators->dataAverager.calculate();
 
             if(!averagedData.empty())
             {
-                dataSmoother.push_back(averagedData);
-                auto smoothedData = dataSmoother.calculate();
+                barCalculators->dataSmoother.push_back(averagedData);
+                auto smoothedData = barCalculators->dataSmoother.calculate();
+
+                if(numberOfMergedBars > 1)
+                {
+                    smoothedData = repeatEachValue(smoothedData, numberOfMergedBars, numberOfBars);
+                }
 
-                processedDataExchanger.push_back(std::make_unique<std::any>(smoothedData));
+                stageMetrics->recordLatency(timestampedFftResult.captureTime);
+                processedDataMailbox.publish(Timestamped<Data>{std::move(smoothedData), timestampedFftResult.captureTime});
             }
         }
     }
 
-    processedDataExchanger.stop();
+    processedDataMailbox.stop();
 }
 
 AudioSpectrumAnalyzer::~AudioSpectrumAnalyzer()
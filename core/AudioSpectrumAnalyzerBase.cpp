@@ -7,28 +7,116 @@
 #include "AudioSpectrumAnalyzerBase.hpp"
 #include "Stats.hpp"
 #include "dataSource/SamplesCollector.hpp"
+#include "dataSource/FrameLog.hpp"
 #include "CommonData.hpp"
 #include "Helpers.hpp"
 #include "Window.hpp"
+#include "SpectrumInterpolator.hpp"
 #include <iostream>
+#include <algorithm>
+#include <optional>
 
+namespace
+{
+
+// values recorded since the previous report, the drafter's time since capture is
+// the total latency from capture to the swap of the frame
+struct StageReport
+{
+    std::string name;
+    StageMetricsHandle metrics;
+    LatencyHistogram::Snapshot previousInterArrivalTimes{};
+    LatencyHistogram::Snapshot previousProcessingTimes{};
+    LatencyHistogram::Snapshot previousLatencies{};
+};
+
+void printLatencies(StageReport &report)
+{
+    const auto interArrivalTimes = report.metrics->getInterArrivalTimes();
+    const auto processingTimes = report.metrics->getProcessingTimes();
+    const auto latencies = report.metrics->getLatencies();
+    const auto interval = LatencyHistogram::summarize(interArrivalTimes, report.previousInterArrivalTimes);
+    const auto processing = LatencyHistogram::summarize(processingTimes, report.previousProcessingTimes);
+    const auto latency = LatencyHistogram::summarize(latencies, report.previousLatencies);
+
+    std::cout<<report.name<<" interval p50/p99/max: "<<interval.p50.count()<<"/"<<interval.p99.count()<<"/"<<interval.max.count()<<" us"
+             <<" processing p50/p99/max: "<<processing.p50.count()<<"/"<<processing.p99.count()<<"/"<<processing.max.count()<<" us"
+             <<" since capture p50/p99/max: "<<latency.p50.count()<<"/"<<latency.p99.count()<<"/"<<latency.max.count()<<" us"<<std::endl;
+
+    report.previousInterArrivalTimes = interArrivalTimes;
+    report.previousProcessingTimes = processingTimes;
+    report.previousLatencies = latencies;
+}
+
+// operations of a frame measured by the Window, operations which were not run are skipped
+void printOperationTimes(std::vector<StageReport> &reports)
+{
+    for(const auto &prefix : {"drawing/", "gpu/"})
+    {
+        for(auto &[name, metrics] : Metrics::getStagesStartingWith(prefix))
+        {
+            if(std::none_of(reports.begin(), reports.end(), [&name = name](const auto &report){ return report.name == name; }))
+            {
+                reports.push_back(StageReport{name, metrics});
+            }
+        }
+    }
+
+    for(auto &report : reports)
+    {
+        const auto processingTimes = report.metrics->getProcessingTimes();
+        const auto processing = LatencyHistogram::summarize(processingTimes, report.previousProcessingTimes);
+
+        if(processing.count > 0)
+        {
+            std::cout<<report.name<<" p50/p99/max: "<<processing.p50.count()<<"/"<<processing.p99.count()<<"/"<<processing.max.count()<<" us"<<std::endl;
+        }
+
+        report.previousProcessingTimes = processingTimes;
+    }
+}
+
+}
+
+uint32_t AudioSpectrumAnalyzerBase::getNumberOfSamplesToBeCollectedFromHw() const
+{
+    const auto configuredValue = config.get<NumberOfSamplesCollectedFromHw>();
+
+    if(configuredValue != 0)
+    {
+        return configuredValue;
+    }
+
+    return calculateNumberOfSamplesCollectedFromHw(config.get<SamplingRate>(), config.get<NumberOfSamples>(), config.get<DesiredFrameRate>());
+}
 
 void AudioSpectrumAnalyzerBase::samplesUpdater()
 {
-    const uint32_t noOfSamplesToBeCollectedFromHwEachTime{128};
+    const uint32_t noOfSamplesToBeCollectedFromHwEachTime = getNumberOfSamplesToBeCollectedFromHw();
     const std::string processName{"samplesUpdater"};
-    StatsManager statsManager(processName);
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::SamplesUpdater, processName);
 
-    SamplesCollector samplesCollector(config.get<PythonDataSourceEnabled>(), config.get<LoopbackEnabled>(), audioConfigFile);
+    SamplesCollector samplesCollector(config, audioConfigFile);
+    const bool backpressureRequired = !samplesCollector.isRealtime();
+    const uint32_t maxNumberOfPendingBlocks = std::max<uint32_t>(config.get<MaxQueueSize>() / 2, 1);
 
     samplesCollector.initialize(noOfSamplesToBeCollectedFromHwEachTime, config.get<SamplingRate>());
+    numberOfSamplesCollectedFromHw.store(noOfSamplesToBeCollectedFromHwEachTime);
+    floorDbFs.store(getFloorDbFs(samplesCollector.getSampleFormat()));
 
     auto channel = std::vector<float>(config.get<NumberOfSamples>(),getFloorDbFs16bit());
 
-    while(shouldProceed)
+    std::unique_ptr<FrameLogWriter> frameLogWriter;
+    std::optional<std::chrono::steady_clock::time_point> firstLoggedCaptureTime;
+
+    if(!config.get<FrameLogRecordPath>().empty())
     {
-        statsManager.update();
+        frameLogWriter = std::make_unique<FrameLogWriter>(config.get<FrameLogRecordPath>(), config.get<SamplingRate>(), config.get<FrameLogSettings>().encoding);
+    }
 
+    while(shouldProceed)
+    {
         if(samplesCollector.checkIfErrorOccured())
         {
             for(int i=0;i< config.get<DesiredFrameRate>();++i)
@@ -40,18 +128,45 @@ void AudioSpectrumAnalyzerBase::samplesUpdater()
             std::cout<<"PLEASE ENABLE YOUR MICROPHONE OR ANOTHER AUDIO INPUT DEVICE."<<std::endl;
 
             samplesCollector.initialize(noOfSamplesToBeCollectedFromHwEachTime, config.get<SamplingRate>());
+            floorDbFs.store(getFloorDbFs(samplesCollector.getSampleFormat()));
         }
         else
         {
+            // an unpaced source is throttled by the consumer instead of overflowing the queue
+            while(backpressureRequired && shouldProceed && (dataExchanger.getSize() >= maxNumberOfPendingBlocks))
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+
             auto data = samplesCollector.collectStereoDataFromHw();
 
+            // waiting for the block is not a part of processing it
+            const auto processingScope = stageMetrics->startProcessing();
+
             if(!data.left.empty() && !data.right.empty())
             {
+                // sources without their own timestamps are stamped when the block arrives
+                if(data.captureTime == std::chrono::steady_clock::time_point{})
+                {
+                    data.captureTime = std::chrono::steady_clock::now();
+                }
+
+                if(frameLogWriter)
+                {
+                    if(!firstLoggedCaptureTime)
+                    {
+                        firstLoggedCaptureTime = data.captureTime;
+                    }
+
+                    frameLogWriter->write(data, data.captureTime - *firstLoggedCaptureTime);
+                }
+
+                stageMetrics->recordLatency(data.captureTime);
                 dataExchanger.push_back(std::make_unique<std::any>(std::move(data)));
             }
             else
             {
-                dataExchanger.push_back(std::make_unique<std::any>(StereoData{channel, channel}));
+                dataExchanger.push_back(std::make_unique<std::any>(StereoData{channel, channel, std::chrono::steady_clock::now()}));
             }
         }
     }
@@ -62,25 +177,52 @@ void AudioSpectrumAnalyzerBase::samplesUpdater()
 void AudioSpectrumAnalyzerBase::drafter()
 {
     const std::string processName{"drafter"};
-    StatsManager statsManager(processName);
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::Drafter, processName);
 
     bool isFullScreenEnabled = config.get<DefaultFullscreenState>();
     std::unique_ptr<Window> window = std::make_unique<Window>(config, isFullScreenEnabled);
     window->initializeGPU();
 
+    const bool interpolationEnabled = config.get<SpectrumInterpolationEnabled>();
+    SpectrumInterpolator interpolator;
+
     while(shouldProceed)
     {
-        const auto &data = processedDataExchanger.get();
+        const auto timestampedData = processedDataMailbox.getNewValue();
 
-        if(data == nullptr)
+        // without interpolation a frame is drawn only when there is a new spectrum to show
+        if((timestampedData == nullptr) && (!interpolationEnabled || interpolator.isEmpty()))
         {
+            processedDataMailbox.waitForNewValue(100ms);
             continue;
         }
 
-        statsManager.update();
+        const auto processingScope = stageMetrics->startProcessing();
+        const auto drawingStartTime = std::chrono::steady_clock::now();
+
+        if(timestampedData && interpolationEnabled)
+        {
+            interpolator.push(timestampedData->value, timestampedData->captureTime, drawingStartTime);
+        }
+
+        window->skipExpensiveLayers(areExpensiveLayersSkipped(qualityLevel.load()));
+        window->updateFloorDbFs(floorDbFs.load());
 
-        window->draw(std::any_cast<Data>(*data));
+        // draw() returns once the frame has been handed over with swapBuffers
+        window->draw(interpolationEnabled ? interpolator.get(drawingStartTime) : timestampedData->value);
 
+        // recorded once the frame is swapped, so the latency includes drawing and the swap.
+        // With interpolation the capture time of the newest spectrum is recorded in the first
+        // frame blending towards it, so the delay added by blending is not included and frames
+        // drawn without a new spectrum are not recorded.
+        if(timestampedData)
+        {
+            stageMetrics->recordLatency(timestampedData->captureTime);
+        }
+
+        const auto swapTime = std::chrono::steady_clock::now();
+        frameSwapDataExchanger.push_back(FrameSwap{swapTime, swapTime - drawingStartTime});
 
         if(window->checkIfWindowShouldBeRecreated())
         {
@@ -95,6 +237,11 @@ void AudioSpectrumAnalyzerBase::drafter()
             shouldProceed.store(false);
         }
 
+        if(Tracer::isEnabled() && window->checkIfTraceShouldBeSaved())
+        {
+            saveTrace();
+        }
+
         if (auto themeConfig = window->checkIfThemeShouldBeChanged())
         {
             appEventPromise.set_value(*themeConfig);
@@ -105,7 +252,27 @@ void AudioSpectrumAnalyzerBase::drafter()
 
 void AudioSpectrumAnalyzerBase::flowController()
 {
-    float coeffUsedInCaseWhenScreenFallsBehindIncomingData = -0.01;
+    applyThreadPolicy(PipelineStage::FlowController, "flowController");
+
+    // a replayed log has to go through the same FFT frames on every run
+    const bool overlappingAdjustable = config.get<FrameLogReplayPath>().empty();
+
+    OverlappingController overlappingController(config.get<FlowControllerSettings>(), config.get<SamplingRate>(), config.get<NumberOfSamples>(), config.get<DesiredFrameRate>());
+
+    const auto samplesUpdaterMetrics = Metrics::registerStage("samplesUpdater");
+    const auto fftCalculatorMetrics = Metrics::registerStage("fftCalculator");
+    const auto drafterMetrics = Metrics::registerStage("drafter");
+
+    std::vector<StageReport> stageReports{{"samplesUpdater", samplesUpdaterMetrics},
+                                          {"fftCalculator", fftCalculatorMetrics},
+                                          {"processing", Metrics::registerStage("processing")},
+                                          {"drafter", drafterMetrics}};
+    std::vector<StageReport> operationReports;
+
+    // the governor changes the FFT, so like the overlapping it is left alone while a log is replayed
+    QualityGovernor qualityGovernor(config.get<QualityGovernorSettings>());
+    const bool qualityAdjustable = overlappingAdjustable && config.get<QualityGovernorSettings>().enabled;
+    PipelineLoadMeter pipelineLoadMeter({{"fftCalculator", fftCalculatorMetrics}, {"processing", Metrics::registerStage("processing")}});
 
     auto previousTime = steady_clock::now();
 
@@ -118,32 +285,82 @@ void AudioSpectrumAnalyzerBase::flowController()
         std::this_thread::sleep_for(100ms);
     }
 
+    // all stages have allocated their buffers by now
+    if(shouldProceed && config.get<MemoryLockingEnabled>())
+    {
+        ThreadPolicy::lockMemory();
+    }
+
+    // frames swapped while the pipeline was starting are not taken into account
+    while(frameSwapDataExchanger.getWithoutBlocking())
+    {
+    }
+
+    auto numberOfPublishedSpectra = processedDataMailbox.getNumberOfPublishedValues();
+
     while(shouldProceed)
     {
-        std::this_thread::sleep_for(100ms);
-        auto numberOfFramesPerSecond = StatsManager::getStatsFor("drafter").getNumberOfCallsInLast(1000ms);
-        auto overlappingDiff = calculateOverlappingDiff(config.get<DesiredFrameRate>(), numberOfFramesPerSecond);
-        auto overlapping = calculateOverlapping(config.get<SamplingRate>(), config.get<NumberOfSamples>(), numberOfFramesPerSecond);
+        // the controller is updated after every swapped frame, the timeout only lets
+        // the statistics be printed and the thread be stopped when no frames are drawn
+        const auto frameSwap = frameSwapDataExchanger.getWithTimeout(100ms);
 
-        if(processedDataExchanger.getSize() > 1)
+        if(frameSwap)
         {
-            overlapping = overlapping + coeffUsedInCaseWhenScreenFallsBehindIncomingData;
-        }
+            // spectra published since the previous frame, one per frame is what the display can show
+            const auto numberOfPublishedSpectraNow = processedDataMailbox.getNumberOfPublishedValues();
+            const auto numberOfSpectraPerFrame = static_cast<uint32_t>(numberOfPublishedSpectraNow - numberOfPublishedSpectra);
+            numberOfPublishedSpectra = numberOfPublishedSpectraNow;
 
-        overlapping = overlapping + overlappingDiff;
+            const auto newOverlapping = overlappingController.update(*frameSwap, numberOfSpectraPerFrame);
 
-        if((overlapping >=0) && (overlapping < 1))
-        {
-            flowControlDataExchanger.push_back(std::move(overlapping));
+            if(overlappingAdjustable && newOverlapping)
+            {
+                auto overlapping = *newOverlapping;
+                Tracer::counter("overlapping", overlapping);
+                overlappingMailbox.publish(std::move(overlapping));
+            }
+
+            Tracer::counter("samples queue size", dataExchanger.getSize());
+            Tracer::counter("fft queue size", fftDataExchanger.getSize());
+            Tracer::counter("spectra per frame", numberOfSpectraPerFrame);
+            Tracer::counter("demanded frame rate", overlappingController.getState().demandedFrameRate);
         }
+
         auto now = steady_clock::now();
 
         if(now - previousTime >= seconds(1))
         {
-            std::cout<<"Samples are updated: "<<StatsManager::getStatsFor("samplesUpdater").getNumberOfCallsInLast(1000ms)<<" per second"<< " queue size: "<<dataExchanger.getSize()<<std::endl;
-            std::cout<<"Plots are updated: "<<numberOfFramesPerSecond<<" per second"<<" queue size: "<<processedDataExchanger.getSize()<<std::endl;
+            const auto numberOfWakeupsPerSecond = samplesUpdaterMetrics->getNumberOfCallsInLast(1000ms);
+            std::cout<<"Samples are updated: "<<numberOfWakeupsPerSecond<<" per second"<<" block size: "<<numberOfSamplesCollectedFromHw.load()<<" samples: "<<numberOfWakeupsPerSecond * numberOfSamplesCollectedFromHw.load()<<" per second"<< " queue size: "<<dataExchanger.getSize()<<std::endl;
+            std::cout<<"FFT input is consumed: "<<fftCalculatorMetrics->getNumberOfCallsInLast(1000ms)<<" per second"<<" queue size: "<<fftDataExchanger.getSize()<<std::endl;
+            std::cout<<"Plots are updated: "<<drafterMetrics->getNumberOfCallsInLast(1000ms)<<" per second"<<" skipped spectra: "<<processedDataMailbox.getNumberOfOverwrittenValues()<<std::endl;
+            std::cout<<"Flow controller: "<<overlappingController.getState()<<std::endl;
+
+            if(qualityAdjustable)
+            {
+                const auto numberOfDroppedValues = dataExchanger.getNumberOfDroppedValues() + fftDataExchanger.getNumberOfDroppedValues();
+                const auto load = pipelineLoadMeter.measure(fftDataExchanger.getSize(), numberOfDroppedValues, now);
+
+                if(const auto transition = qualityGovernor.update(load, now))
+                {
+                    const auto level = transition->level;
+                    qualityLevel.store(level);
+                    overlappingController.updateLimits(getFftSize(level, config.get<NumberOfSamples>()), getMaxFrameRate(level, config.get<DesiredFrameRate>()));
+
+                    auto overlapping = overlappingController.getState().overlapping;
+                    overlappingMailbox.publish(std::move(overlapping));
+
+                    std::cout<<"Quality governor: "<<*transition<<std::endl;
+                    Tracer::counter("quality level", static_cast<uint32_t>(level));
+                }
+            }
+
+            for(auto &stageReport : stageReports)
+            {
+                printLatencies(stageReport);
+            }
+            printOperationTimes(operationReports);
             previousTime = now;
         }
     }
 }
-
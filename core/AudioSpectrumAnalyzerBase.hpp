@@ -6,6 +6,8 @@
 #pragma once
 
 #include "SpectrumAnalyzerBase.hpp"
+#include "QualityGovernor.hpp"
+#include "CommonData.hpp"
 
 
 class AudioSpectrumAnalyzerBase : public SpectrumAnalyzerBase
@@ -17,5 +19,12 @@ public:
     void drafter() override;
     void flowController() override;
 protected:
+    uint32_t getNumberOfSamplesToBeCollectedFromHw() const;
+
     std::string audioConfigFile="audioConfig";
+    std::atomic<uint32_t> numberOfSamplesCollectedFromHw{0};
+    // set by the flowController, every stage lowers its own work accordingly
+    std::atomic<QualityLevel> qualityLevel{QualityLevel::Full};
+    // set by the samplesUpdater from the format of the source, nothing quieter can be measured
+    std::atomic<float> floorDbFs{getFloorDbFs16bit()};
 };
@@ -0,0 +1,443 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "BatchAnalyzer.hpp"
+#include "dataSource/SampleConverter.hpp"
+#include "FftCalculator.hpp"
+#include "FftBinCombiner.hpp"
+#include "FrequenciesInfo.hpp"
+#include "DataCalculator.hpp"
+#include "CommonData.hpp"
+#include "Helpers.hpp"
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <map>
+#include <cmath>
+
+struct BatchAnalyzer::Input
+{
+    std::string path;
+    std::unique_ptr<MappedFile> file;
+    AudioFileLayout layout;
+    float overlapping;
+    uint32_t hopSize;
+    size_t numberOfFrames;
+    uint32_t numberOfBars;
+    FrequencyIndexesPerRectangle frequencyIndexes;
+};
+
+struct BatchAnalyzer::Job
+{
+    size_t inputIndex;
+    size_t firstFrame;
+    size_t firstOutputFrame;
+    size_t endFrame;
+    bool lastChunkOfInput;
+};
+
+namespace
+{
+
+constexpr uint32_t minNumberOfFramesPerChunk{256};
+constexpr uint32_t maxNumberOfFramesPerChunk{16384};
+constexpr uint32_t numberOfChunksPerThread{4};
+constexpr uint32_t binaryFormatVersion{1};
+
+// the smoother is settled when the influence of its earlier state drops below this fraction
+constexpr double smootherResidual{1e-5};
+
+class SpectrumWriter
+{
+public:
+    SpectrumWriter(const std::string &path, const BatchOutputFormat format, const Frequencies &frequencies):
+        file(path, (format == BatchOutputFormat::Binary) ? (std::ios::out | std::ios::binary) : std::ios::out),
+        format(format)
+    {
+        if(format == BatchOutputFormat::Binary)
+        {
+            const uint32_t numberOfBars = frequencies.size();
+
+            file.write("SPAB", 4);
+            file.write(reinterpret_cast<const char*>(&binaryFormatVersion), sizeof(binaryFormatVersion));
+            file.write(reinterpret_cast<const char*>(&numberOfBars), sizeof(numberOfBars));
+            file.write(reinterpret_cast<const char*>(frequencies.data()), frequencies.size() * sizeof(float));
+        }
+        else
+        {
+            file<<"time";
+            for(const auto &frequency : frequencies)
+            {
+                file<<","<<frequency;
+            }
+            file<<"\n";
+        }
+    }
+
+    bool isOpen() const
+    {
+        return file.good();
+    }
+
+    void write(const std::vector<SpectrumFrame> &frames)
+    {
+        for(const auto &frame : frames)
+        {
+            if(format == BatchOutputFormat::Binary)
+            {
+                file.write(reinterpret_cast<const char*>(&frame.time), sizeof(frame.time));
+                file.write(reinterpret_cast<const char*>(frame.bars.data()), frame.bars.size() * sizeof(float));
+            }
+            else
+            {
+                file<<frame.time;
+                for(const auto &bar : frame.bars)
+                {
+                    file<<","<<bar;
+                }
+                file<<"\n";
+            }
+        }
+    }
+
+private:
+    std::ofstream file;
+    const BatchOutputFormat format;
+};
+
+std::string getOutputPath(const std::string &inputPath, const std::string &outputDirectory, const BatchOutputFormat format)
+{
+    auto fileName = std::filesystem::path(inputPath).stem();
+    fileName += (format == BatchOutputFormat::Binary) ? ".spab" : ".csv";
+
+    return (std::filesystem::path(outputDirectory) / fileName).string();
+}
+
+}
+
+BatchAnalyzer::BatchAnalyzer(const Configuration &config, const uint32_t numberOfThreads, const uint32_t numberOfFramesPerChunk):
+    config(config),
+    numberOfThreads(numberOfThreads ? numberOfThreads : std::max(1u, std::thread::hardware_concurrency())),
+    numberOfFramesPerChunk(numberOfFramesPerChunk)
+{
+}
+
+BatchAnalyzer::~BatchAnalyzer()
+{
+}
+
+bool BatchAnalyzer::run(const std::vector<std::string> &inputPaths, const std::string &outputDirectory, const BatchOutputFormat outputFormat)
+{
+    bool allInputsProcessed{true};
+    std::vector<std::unique_ptr<Input>> inputs;
+
+    for(const auto &path : inputPaths)
+    {
+        if(auto input = openInput(path))
+        {
+            inputs.push_back(std::move(input));
+        }
+        else
+        {
+            allInputsProcessed = false;
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(outputDirectory, errorCode);
+
+    std::map<const Input*, std::unique_ptr<SpectrumWriter>> writers;
+    std::map<const Input*, size_t> numberOfWrittenFrames;
+
+    process(inputs, [&](const Input &input, std::vector<SpectrumFrame> &&frames, const bool lastChunkOfInput)
+    {
+        auto &writer = writers[&input];
+
+        if(!writer)
+        {
+            writer = std::make_unique<SpectrumWriter>(getOutputPath(input.path, outputDirectory, outputFormat), outputFormat, config.get<Freqs>());
+        }
+
+        writer->write(frames);
+        numberOfWrittenFrames[&input] += frames.size();
+
+        if(lastChunkOfInput)
+        {
+            if(writer->isOpen())
+            {
+                std::cout<<input.path<<": "<<numberOfWrittenFrames[&input]<<" spectra written to "<<getOutputPath(input.path, outputDirectory, outputFormat)<<std::endl;
+            }
+            else
+            {
+                std::cout<<"ERROR: cannot write "<<getOutputPath(input.path, outputDirectory, outputFormat)<<std::endl;
+                allInputsProcessed = false;
+            }
+            writer.reset();
+        }
+    });
+
+    return allInputsProcessed;
+}
+
+std::vector<SpectrumFrame> BatchAnalyzer::analyze(const std::string &inputPath)
+{
+    std::vector<SpectrumFrame> result;
+    std::vector<std::unique_ptr<Input>> inputs;
+
+    if(auto input = openInput(inputPath))
+    {
+        inputs.push_back(std::move(input));
+    }
+
+    process(inputs, [&result](const Input &, std::vector<SpectrumFrame> &&frames, const bool)
+    {
+        std::move(frames.begin(), frames.end(), std::back_inserter(result));
+    });
+
+    return result;
+}
+
+std::unique_ptr<BatchAnalyzer::Input> BatchAnalyzer::openInput(const std::string &path) const
+{
+    auto input = std::make_unique<Input>();
+    input->path = path;
+    input->file = std::make_unique<MappedFile>(path);
+
+    if(!input->file->isMapped())
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        const auto &playback = config.get<FilePlaybackSettings>();
+        const auto waveLayout = parseWaveFile(input->file->getData(), input->file->getSize());
+        input->layout = waveLayout ? *waveLayout : getRawFileLayout(input->file->getSize(), playback.rawSampleFormat, playback.rawNumberOfChannels, config.get<SamplingRate>());
+    }
+    catch(const std::exception &exception)
+    {
+        std::cout<<"ERROR: "<<path<<": "<<exception.what()<<std::endl;
+        return nullptr;
+    }
+
+    if(input->layout.samplingRate == 0)
+    {
+        std::cout<<"ERROR: "<<path<<": sampling rate is not specified"<<std::endl;
+        return nullptr;
+    }
+
+    const uint32_t numberOfSamples = config.get<NumberOfSamples>();
+    const uint32_t samplingRate = input->layout.samplingRate;
+
+    // the frame rate of the theme defines how many spectra are produced per second of audio
+    input->overlapping = calculateOverlapping(samplingRate, numberOfSamples, config.get<DesiredFrameRate>());
+    input->hopSize = calculateHopSize(numberOfSamples, input->overlapping);
+    input->numberOfFrames = (input->layout.numberOfFrames >= numberOfSamples) ? ((input->layout.numberOfFrames - numberOfSamples) / input->hopSize + 1) : 0;
+
+    FrequenciesInfo frequenciesInfo(samplingRate, numberOfSamples, config.get<Freqs>());
+    input->numberOfBars = frequenciesInfo.numberOfFrequencies();
+    input->frequencyIndexes = frequenciesInfo.getAllFrequencyIndexes();
+
+    return input;
+}
+
+uint32_t BatchAnalyzer::calculateNumberOfWarmUpFrames() const
+{
+    const uint32_t numberOfSignalsForMaxHold = std::max(config.get<NumberOfSignalsForMaxHold>(), 1u);
+    const uint32_t numberOfSignalsForAveraging = std::max(config.get<NumberOfSignalsForAveraging>(), 1u);
+    const float alphaFactor = config.get<AlphaFactor>();
+
+    uint32_t numberOfFramesForSmoother{0};
+
+    if((alphaFactor > 0) && (alphaFactor < 1))
+    {
+        numberOfFramesForSmoother = std::ceil(std::log(smootherResidual) / std::log(1.0 - alphaFactor));
+    }
+
+    return (numberOfSignalsForMaxHold - 1) + (numberOfSignalsForAveraging - 1) + numberOfFramesForSmoother;
+}
+
+uint32_t BatchAnalyzer::calculateNumberOfFramesPerChunk(const size_t numberOfFrames) const
+{
+    if(numberOfFramesPerChunk != 0)
+    {
+        return numberOfFramesPerChunk;
+    }
+
+    // chunks have to be long compared to the warm-up, otherwise most of the work is repeated
+    const size_t minimum = std::max<size_t>(4 * calculateNumberOfWarmUpFrames(), minNumberOfFramesPerChunk);
+    const size_t balanced = (numberOfFrames + numberOfThreads * numberOfChunksPerThread - 1) / (numberOfThreads * numberOfChunksPerThread);
+
+    return std::clamp<size_t>(balanced, minimum, std::max<size_t>(minimum, maxNumberOfFramesPerChunk));
+}
+
+std::vector<BatchAnalyzer::Job> BatchAnalyzer::createJobs(const std::vector<std::unique_ptr<Input>> &inputs) const
+{
+    std::vector<Job> jobs;
+    const size_t numberOfWarmUpFrames = calculateNumberOfWarmUpFrames();
+
+    for(size_t inputIndex = 0; inputIndex < inputs.size(); ++inputIndex)
+    {
+        const size_t numberOfFrames = inputs[inputIndex]->numberOfFrames;
+        const size_t chunkSize = calculateNumberOfFramesPerChunk(numberOfFrames);
+
+        if(numberOfFrames == 0)
+        {
+            jobs.push_back(Job{inputIndex, 0, 0, 0, true});
+            continue;
+        }
+
+        for(size_t firstOutputFrame = 0; firstOutputFrame < numberOfFrames; firstOutputFrame += chunkSize)
+        {
+            const size_t endFrame = std::min(firstOutputFrame + chunkSize, numberOfFrames);
+            const size_t firstFrame = firstOutputFrame - std::min(firstOutputFrame, numberOfWarmUpFrames);
+
+            jobs.push_back(Job{inputIndex, firstFrame, firstOutputFrame, endFrame, endFrame == numberOfFrames});
+        }
+    }
+
+    return jobs;
+}
+
+void BatchAnalyzer::process(const std::vector<std::unique_ptr<Input>> &inputs, const Consumer &consumer)
+{
+    const auto jobs = createJobs(inputs);
+    const size_t maxNumberOfPendingJobs = numberOfThreads * numberOfChunksPerThread;
+
+    std::vector<std::optional<std::vector<SpectrumFrame>>> results(jobs.size());
+    std::atomic<size_t> nextJob{0};
+    size_t numberOfConsumedJobs{0};
+    std::mutex resultsMutex;
+    std::condition_variable resultsConditionVariable;
+
+    auto worker = [&]()
+    {
+        WelchCalculator welchCalculator(FftType::Real, config.get<NumberOfSamples>(), 0, config.get<SignalWindow>());
+
+        for(size_t jobIndex = nextJob++; jobIndex < jobs.size(); jobIndex = nextJob++)
+        {
+            {
+                // results are written in order, so workers must not run too far ahead of the writer
+                std::unique_lock<std::mutex> lock(resultsMutex);
+                resultsConditionVariable.wait(lock, [&](){return jobIndex < numberOfConsumedJobs + maxNumberOfPendingJobs;});
+            }
+
+            auto frames = analyzeChunk(welchCalculator, *inputs[jobs[jobIndex].inputIndex], jobs[jobIndex]);
+
+            {
+                std::lock_guard<std::mutex> lock(resultsMutex);
+                results[jobIndex] = std::move(frames);
+            }
+            resultsConditionVariable.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for(uint32_t i = 0; i < std::min<size_t>(numberOfThreads, jobs.size()); ++i)
+    {
+        workers.emplace_back(worker);
+    }
+
+    for(size_t jobIndex = 0; jobIndex < jobs.size(); ++jobIndex)
+    {
+        std::vector<SpectrumFrame> frames;
+
+        {
+            std::unique_lock<std::mutex> lock(resultsMutex);
+            resultsConditionVariable.wait(lock, [&](){return results[jobIndex].has_value();});
+            frames = std::move(*results[jobIndex]);
+            results[jobIndex].reset();
+            ++numberOfConsumedJobs;
+        }
+        resultsConditionVariable.notify_all();
+
+        consumer(*inputs[jobs[jobIndex].inputIndex], std::move(frames), jobs[jobIndex].lastChunkOfInput);
+    }
+
+    for(auto &thread : workers)
+    {
+        thread.join();
+    }
+}
+
+std::vector<SpectrumFrame> BatchAnalyzer::analyzeChunk(WelchCalculator &welchCalculator, const Input &input, const Job &job) const
+{
+    std::vector<SpectrumFrame> frames;
+
+    if(job.endFrame == job.firstFrame)
+    {
+        return frames;
+    }
+
+    const uint32_t numberOfSamples = config.get<NumberOfSamples>();
+    const auto &layout = input.layout;
+    const size_t frameSize = layout.numberOfChannels * getBytesPerSample(layout.sampleFormat);
+
+    const float floorDbFs = getFloorDbFs(layout.sampleFormat);
+
+    FftBinCombiner fftBinCombiner(config.get<ScalingFactor>(), config.get<OffsetFactor>(), floorDbFs, input.frequencyIndexes);
+    DataMaxHolder dataMaxHolder(input.numberOfBars, config.get<NumberOfSignalsForMaxHold>(), floorDbFs);
+    DataAverager dataAverager(input.numberOfBars, config.get<NumberOfSignalsForAveraging>());
+    DataSmoother dataSmoother(input.numberOfBars, config.get<AlphaFactor>());
+
+    welchCalculator.clear();
+    welchCalculator.updateOverlapping(input.overlapping);
+
+    const size_t firstSample = job.firstFrame * input.hopSize;
+    const size_t endSample = (job.endFrame - 1) * input.hopSize + numberOfSamples;
+
+    frames.reserve(job.endFrame - job.firstOutputFrame);
+
+    std::vector<float> left(numberOfSamples);
+    std::vector<float> right(numberOfSamples);
+    size_t frameIndex = job.firstFrame;
+
+    for(size_t sample = firstSample; sample < endSample; sample += numberOfSamples)
+    {
+        const size_t numberOfSamplesInBlock = std::min<size_t>(numberOfSamples, endSample - sample);
+
+        left.resize(numberOfSamplesInBlock);
+        right.resize(numberOfSamplesInBlock);
+        extractStereo(input.file->getData() + layout.dataOffset + sample * frameSize, layout.sampleFormat, layout.numberOfChannels, left.data(), right.data(), numberOfSamplesInBlock);
+
+        welchCalculator.updateBuffer(getAverage(left, right));
+
+        for(const auto &fftResult : welchCalculator.calculate())
+        {
+            dataMaxHolder.push_back(fftBinCombiner.combineMagnitudes(fftResult));
+
+            auto dataWithMaxValue = dataMaxHolder.calculate();
+
+            if(!dataWithMaxValue.empty())
+            {
+                dataAverager.push_back(dataWithMaxValue);
+
+                auto averagedData = dataAverager.calculate();
+
+                if(!averagedData.empty())
+                {
+                    dataSmoother.push_back(averagedData);
+                    auto smoothedData = dataSmoother.calculate();
+
+                    if(frameIndex >= job.firstOutputFrame)
+                    {
+                        frames.push_back(SpectrumFrame{static_cast<double>(frameIndex) * input.hopSize / layout.samplingRate, std::move(smoothedData)});
+                    }
+                }
+            }
+
+            ++frameIndex;
+        }
+    }
+
+    return frames;
+}
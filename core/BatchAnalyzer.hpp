@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "Config.hpp"
+#include "dataSource/AudioFileParser.hpp"
+#include "dataSource/MappedFile.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class WelchCalculator;
+
+enum class BatchOutputFormat : uint16_t
+{
+    Csv = 0,
+    Binary = 1
+};
+
+struct SpectrumFrame
+{
+    double time;
+    std::vector<float> bars;
+};
+
+// Runs the analyzer processing chain (Welch FFT, bin combining, max hold, averaging and
+// smoothing) over recorded files as fast as the CPU allows. Every file is split into
+// chunks of FFT frames which are processed in parallel. Each chunk starts early enough
+// to fill the max hold and averaging windows and to let the smoother settle, so the
+// result matches a single pass over the whole file.
+//
+// Binary output layout (little endian): "SPAB", uint32 version, uint32 number of bars,
+// float bar frequencies, then for every frame a float64 time in seconds followed by
+// the bar values in dBFS. CSV output has one frame per line: time followed by bars.
+class BatchAnalyzer
+{
+public:
+    BatchAnalyzer(const Configuration &config, const uint32_t numberOfThreads, const uint32_t numberOfFramesPerChunk=0);
+    ~BatchAnalyzer();
+
+    bool run(const std::vector<std::string> &inputPaths, const std::string &outputDirectory, const BatchOutputFormat outputFormat);
+    std::vector<SpectrumFrame> analyze(const std::string &inputPath);
+
+private:
+    struct Input;
+    struct Job;
+
+    using Consumer = std::function<void(const Input &input, std::vector<SpectrumFrame> &&frames, const bool lastChunkOfInput)>;
+
+    std::unique_ptr<Input> openInput(const std::string &path) const;
+    uint32_t calculateNumberOfWarmUpFrames() const;
+    uint32_t calculateNumberOfFramesPerChunk(const size_t numberOfFrames) const;
+    std::vector<Job> createJobs(const std::vector<std::unique_ptr<Input>> &inputs) const;
+    void process(const std::vector<std::unique_ptr<Input>> &inputs, const Consumer &consumer);
+    std::vector<SpectrumFrame> analyzeChunk(WelchCalculator &welchCalculator, const Input &input, const Job &job) const;
+
+    const Configuration config;
+    const uint32_t numberOfThreads;
+    const uint32_t numberOfFramesPerChunk;
+};
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
 
 #pragma once
 
+#include "CommonTypes.hpp"
 
 constexpr float getDynamicRangeOf16bitSignal()
 {
@@ -16,3 +17,20 @@ constexpr float getFloorDbFs16bit()
 {
     return -96.32;
 }
+
+constexpr float getFloorDbFs24bit()
+{
+    return -144.49;
+}
+
+// lowest level which can be told apart from the quantization of the samples, samples are
+// converted to float, so formats wider than 24 bits are limited by its 24-bit mantissa
+constexpr float getFloorDbFs(const SampleFormat sampleFormat)
+{
+    return (sampleFormat == SampleFormat::Int16) ? getFloorDbFs16bit() : getFloorDbFs24bit();
+}
+
+constexpr float getFullScaleAmplitude()
+{
+    return 32767;
+}
@@ -20,8 +20,89 @@ using Frequencies = std::vector<Frequency>;
 using Positions = std::vector<Position>;
 using Color = std::vector<float>;
 using ColorsOfRectanglePerVertices = std::map<uint32_t, Color>;
+using ThreadSettingsPerStage = std::map<uint32_t, std::vector<float>>;
 
 
+enum class SampleFormat : uint16_t
+{
+    Int16 = 0,
+    Int24 = 1,
+    Int32 = 2,
+    Float32 = 3
+};
+
+struct PcmFormat
+{
+    SampleFormat sampleFormat;
+    uint16_t numberOfChannels;
+};
+
+enum class SignalType : uint16_t
+{
+    Off = 0,
+    Sine = 1,
+    Multitone = 2,
+    Sweep = 3,
+    WhiteNoise = 4,
+    PinkNoise = 5,
+    Impulse = 6
+};
+
+struct GeneratorSignal
+{
+    SignalType type;
+    float amplitudeDbfs;
+    float frequency;
+    float secondFrequency;
+    float period;
+    uint32_t seed;
+};
+
+enum class FrameLogEncoding : uint16_t
+{
+    Float32 = 0,
+    Int16 = 1,
+    Lossless = 2
+};
+
+struct FrameLog
+{
+    FrameLogEncoding encoding;
+    bool originalTiming;
+};
+
+struct FrameTiming
+{
+    float budgetInMilliseconds;
+    bool gpuTimerQueriesEnabled;
+};
+
+struct FlowControl
+{
+    float proportionalGain;
+    float integralGain;
+    float integralLimit;
+    float hysteresis;
+    float targetQueueDepth;
+};
+
+struct QualityControl
+{
+    bool enabled;
+    float cpuBudgetInPercents;
+    float restoreThresholdInPercents;
+    uint32_t maxQueueDepth;
+    float restoreDelayInSeconds;
+};
+
+struct FilePlayback
+{
+    bool realtimePacing;
+    bool looping;
+    SampleFormat rawSampleFormat;
+    uint16_t rawNumberOfChannels;
+};
+
 enum class FftType : uint16_t
 {
     Complex =0,
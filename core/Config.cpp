@@ -12,12 +12,29 @@ std::ostream& operator<<(std::ostream& os, const Configuration &config)
     os<<config.data.get<WindowTitle>();
     os<<config.data.get<PythonDataSourceEnabled>();
     os<<config.data.get<LoopbackEnabled>();
+    os<<config.data.get<CallbackCaptureEnabled>();
+    os<<config.data.get<FileDataSourcePath>();
+    os<<config.data.get<FilePlaybackSettings>();
+    os<<config.data.get<StreamDataSourceAddress>();
+    os<<config.data.get<StreamDataSourceFormat>();
+    os<<config.data.get<SignalGeneratorLeftChannel>();
+    os<<config.data.get<SignalGeneratorRightChannel>();
+    os<<config.data.get<FrameLogRecordPath>();
+    os<<config.data.get<FrameLogReplayPath>();
+    os<<config.data.get<FrameLogSettings>();
+    os<<config.data.get<PythonProcessIsolationEnabled>();
+    os<<config.data.get<TraceOutputPath>();
+    os<<config.data.get<FrameTimingSettings>();
+    os<<config.data.get<FlowControllerSettings>();
+    os<<config.data.get<SpectrumInterpolationEnabled>();
+    os<<config.data.get<QualityGovernorSettings>();
     os<<config.data.get<DefaultFullscreenState>();
     os<<config.data.get<MaximizedWindowSize>();
     os<<config.data.get<NormalWindowSize>();
     os<<config.data.get<NumberOfRectangles>();
     os<<config.data.get<GapWidthInRelationToRectangleWidth>();
     os<<config.data.get<NumberOfSamples>();
+    os<<config.data.get<NumberOfSamplesCollectedFromHw>();
     os<<config.data.get<SamplingRate>();
     os<<config.data.get<DesiredFrameRate>();
     os<<config.data.get<NumberOfSignalsForAveraging>();
@@ -49,6 +66,8 @@ std::ostream& operator<<(std::ostream& os, const Configuration &config)
     os<<config.data.get<ColorOfDynamicMaxHoldSecondaryLine>();
     os<<config.data.get<ColorsOfRectangle>();
     os<<config.data.get<ColorsOfDynamicMaxHoldRectangle>();
+    os<<config.data.get<ThreadSchedulingSettings>();
+    os<<config.data.get<MemoryLockingEnabled>();
 
     return os;
 }
@@ -37,6 +37,7 @@
 #include "config/NormalWindowSize.hpp"
 #include "config/NumberOfRectangles.hpp"
 #include "config/NumberOfSamples.hpp"
+#include "config/NumberOfSamplesCollectedFromHw.hpp"
 #include "config/NumberOfSignalsForAveraging.hpp"
 #include "config/NumberOfSignalsForMaxHold.hpp"
 #include "config/OffsetFactor.hpp"
@@ -51,6 +52,24 @@
 #include "config/LoopbackEnabled.hpp"
 #include "config/SingleScaleMode.hpp"
 #include "config/HorizontalDrawingArea.hpp"
+#include "config/ThreadSchedulingSettings.hpp"
+#include "config/MemoryLockingEnabled.hpp"
+#include "config/CallbackCaptureEnabled.hpp"
+#include "config/FileDataSourcePath.hpp"
+#include "config/FilePlaybackSettings.hpp"
+#include "config/StreamDataSourceAddress.hpp"
+#include "config/StreamDataSourceFormat.hpp"
+#include "config/SignalGeneratorLeftChannel.hpp"
+#include "config/SignalGeneratorRightChannel.hpp"
+#include "config/FrameLogRecordPath.hpp"
+#include "config/FrameLogReplayPath.hpp"
+#include "config/FrameLogSettings.hpp"
+#include "config/PythonProcessIsolationEnabled.hpp"
+#include "config/TraceOutputPath.hpp"
+#include "config/FrameTimingSettings.hpp"
+#include "config/FlowControllerSettings.hpp"
+#include "config/SpectrumInterpolationEnabled.hpp"
+#include "config/QualityGovernorSettings.hpp"
 
 #include <vector>
 #include <cstdint>
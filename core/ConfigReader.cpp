@@ -8,6 +8,7 @@
 #include "config/SingleScaleMode.hpp"
 #include <iostream>
 #include <unordered_set>
+#include <algorithm>
 
 ConfigReader::ConfigReader(const ThemeConfig theme, const Mode mode, const std::string &path) : ConfigFileReader(theme, mode, path)
 {
@@ -26,6 +27,7 @@ Configuration ConfigReader::getConfig()
         config.data.add(getNormalWindowSize());
         config.data.add(getGapWidthInRelationToRectangleWidth());
         config.data.add(getNumberOfSamples());
+        config.data.add(getNumberOfSamplesCollectedFromHw());
         config.data.add(getSamplingRate());
         config.data.add(getDesiredFrameRate());
         config.data.add(getNumberOfSignalsForAveraging());
@@ -63,6 +65,24 @@ Configuration ConfigReader::getConfig()
         config.data.add(getLoopbackEnabled());
         config.data.add(getSingleScaleMode());
         config.data.add(getHorizontalDrawingArea());
+        config.data.add(getThreadSchedulingSettings());
+        config.data.add(getMemoryLockingEnabled());
+        config.data.add(getCallbackCaptureEnabled());
+        config.data.add(getFileDataSourcePath());
+        config.data.add(getFilePlaybackSettings());
+        config.data.add(getStreamDataSourceAddress());
+        config.data.add(getStreamDataSourceFormat());
+        config.data.add(getSignalGeneratorLeftChannel());
+        config.data.add(getSignalGeneratorRightChannel());
+        config.data.add(getFrameLogRecordPath());
+        config.data.add(getFrameLogReplayPath());
+        config.data.add(getFrameLogSettings());
+        config.data.add(getPythonProcessIsolationEnabled());
+        config.data.add(getTraceOutputPath());
+        config.data.add(getFrameTimingSettings());
+        config.data.add(getFlowControllerSettings());
+        config.data.add(getSpectrumInterpolationEnabled());
+        config.data.add(getQualityGovernorSettings());
     }
 
     return config;
@@ -310,6 +330,20 @@ MaxQueueSize ConfigReader::getMaxQueueSize()
     return data;
 }
 
+NumberOfSamplesCollectedFromHw ConfigReader::getNumberOfSamplesCollectedFromHw()
+{
+    NumberOfSamplesCollectedFromHw data(themeConfig, mode);
+
+    auto value = loadVectorConfig(data.name, data.getInfo(), {(float)data.value},0);
+
+    if(value)
+    {
+        data.value = value->at(0);
+    }
+
+    return data;
+}
+
 ScalingFactor ConfigReader::getScalingFactor()
 {
     ScalingFactor data(getSignalWindow().value);
@@ -697,3 +731,280 @@ HorizontalDrawingArea ConfigReader::getHorizontalDrawingArea()
     }
     return data;
 }
+
+ThreadSchedulingSettings ConfigReader::getThreadSchedulingSettings()
+{
+    ThreadSchedulingSettings data(themeConfig, mode);
+
+    auto value = loadMapConfig(data.name, data.getInfo(), data.value, 0);
+
+    if(value)
+    {
+        data.value = std::move(*value);
+    }
+
+    return data;
+}
+
+MemoryLockingEnabled ConfigReader::getMemoryLockingEnabled()
+{
+    MemoryLockingEnabled data(themeConfig, mode);
+
+    auto value = loadBoolConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = *value;
+    }
+
+    return data;
+}
+
+CallbackCaptureEnabled ConfigReader::getCallbackCaptureEnabled()
+{
+    CallbackCaptureEnabled data(themeConfig, mode);
+
+    auto value = loadBoolConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = *value;
+    }
+
+    return data;
+}
+
+FileDataSourcePath ConfigReader::getFileDataSourcePath()
+{
+    FileDataSourcePath data(themeConfig, mode);
+
+    auto value = loadStringConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = std::move(*value);
+    }
+
+    return data;
+}
+
+FilePlaybackSettings ConfigReader::getFilePlaybackSettings()
+{
+    FilePlaybackSettings data(themeConfig, mode);
+
+    auto value = loadVectorConfig(data.name, data.getInfo(), {(float)data.value.realtimePacing, (float)data.value.looping, (float)data.value.rawSampleFormat, (float)data.value.rawNumberOfChannels},0);
+
+    if(value && (value->size() == 4))
+    {
+        data.value.realtimePacing = value->at(0);
+        data.value.looping = value->at(1);
+        data.value.rawSampleFormat = static_cast<SampleFormat>(std::clamp<uint16_t>(value->at(2), 0, static_cast<uint16_t>(SampleFormat::Float32)));
+        data.value.rawNumberOfChannels = std::max<uint16_t>(value->at(3), 1);
+    }
+
+    return data;
+}
+
+StreamDataSourceAddress ConfigReader::getStreamDataSourceAddress()
+{
+    StreamDataSourceAddress data(themeConfig, mode);
+
+    auto value = loadStringConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = std::move(*value);
+    }
+
+    return data;
+}
+
+StreamDataSourceFormat ConfigReader::getStreamDataSourceFormat()
+{
+    StreamDataSourceFormat data(themeConfig, mode);
+
+    auto value = loadVectorConfig(data.name, data.getInfo(), {(float)data.value.sampleFormat, (float)data.value.numberOfChannels},0);
+
+    if(value && (value->size() == 2))
+    {
+        data.value.sampleFormat = static_cast<SampleFormat>(std::clamp<uint16_t>(value->at(0), 0, static_cast<uint16_t>(SampleFormat::Float32)));
+        data.value.numberOfChannels = std::max<uint16_t>(value->at(1), 1);
+    }
+
+    return data;
+}
+
+SignalGeneratorLeftChannel ConfigReader::getSignalGeneratorLeftChannel()
+{
+    SignalGeneratorLeftChannel data(themeConfig, mode);
+
+    data.value = loadGeneratorSignal(data.name, data.getInfo(), data.value);
+
+    return data;
+}
+
+SignalGeneratorRightChannel ConfigReader::getSignalGeneratorRightChannel()
+{
+    SignalGeneratorRightChannel data(themeConfig, mode);
+
+    data.value = loadGeneratorSignal(data.name, data.getInfo(), data.value);
+
+    return data;
+}
+
+GeneratorSignal ConfigReader::loadGeneratorSignal(const std::string &name, const std::string &info, const GeneratorSignal &defaultValue)
+{
+    GeneratorSignal signal = defaultValue;
+
+    auto value = loadVectorConfig(name, info, {(float)signal.type, signal.amplitudeDbfs, signal.frequency, signal.secondFrequency, signal.period, (float)signal.seed},0);
+
+    if(value && (value->size() == 6))
+    {
+        signal.type = static_cast<SignalType>(std::clamp<uint16_t>(value->at(0), 0, static_cast<uint16_t>(SignalType::Impulse)));
+        signal.amplitudeDbfs = std::min(value->at(1), 0.0f);
+        signal.frequency = std::max(value->at(2), 0.0f);
+        signal.secondFrequency = std::max(value->at(3), 0.0f);
+        signal.period = std::max(value->at(4), 0.0f);
+        signal.seed = value->at(5);
+    }
+
+    return signal;
+}
+
+FrameLogRecordPath ConfigReader::getFrameLogRecordPath()
+{
+    FrameLogRecordPath data(themeConfig, mode);
+
+    auto value = loadStringConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = std::move(*value);
+    }
+
+    return data;
+}
+
+FrameLogReplayPath ConfigReader::getFrameLogReplayPath()
+{
+    FrameLogReplayPath data(themeConfig, mode);
+
+    auto value = loadStringConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = std::move(*value);
+    }
+
+    return data;
+}
+
+FrameLogSettings ConfigReader::getFrameLogSettings()
+{
+    FrameLogSettings data(themeConfig, mode);
+
+    auto value = loadVectorConfig(data.name, data.getInfo(), {(float)data.value.encoding, (float)data.value.originalTiming},0);
+
+    if(value && (value->size() == 2))
+    {
+        data.value.encoding = static_cast<FrameLogEncoding>(std::clamp<uint16_t>(value->at(0), 0, static_cast<uint16_t>(FrameLogEncoding::Lossless)));
+        data.value.originalTiming = value->at(1);
+    }
+
+    return data;
+}
+
+PythonProcessIsolationEnabled ConfigReader::getPythonProcessIsolationEnabled()
+{
+    PythonProcessIsolationEnabled data(themeConfig, mode);
+
+    auto value = loadBoolConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = *value;
+    }
+
+    return data;
+}
+
+TraceOutputPath ConfigReader::getTraceOutputPath()
+{
+    TraceOutputPath data(themeConfig, mode);
+
+    auto value = loadStringConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = std::move(*value);
+    }
+
+    return data;
+}
+
+FrameTimingSettings ConfigReader::getFrameTimingSettings()
+{
+    FrameTimingSettings data(themeConfig, mode);
+
+    auto value = loadVectorConfig(data.name, data.getInfo(), {data.value.budgetInMilliseconds, (float)data.value.gpuTimerQueriesEnabled},0);
+
+    if(value && (value->size() == 2))
+    {
+        data.value.budgetInMilliseconds = std::max(value->at(0), 0.0f);
+        data.value.gpuTimerQueriesEnabled = value->at(1);
+    }
+
+    return data;
+}
+
+FlowControllerSettings ConfigReader::getFlowControllerSettings()
+{
+    FlowControllerSettings data(themeConfig, mode);
+
+    const auto &defaultValue = data.value;
+    auto value = loadVectorConfig(data.name, data.getInfo(), {defaultValue.proportionalGain, defaultValue.integralGain, defaultValue.integralLimit, defaultValue.hysteresis, defaultValue.targetQueueDepth}, 3);
+
+    if(value && (value->size() == 5))
+    {
+        data.value.proportionalGain = std::max(value->at(0), 0.0f);
+        data.value.integralGain = std::max(value->at(1), 0.0f);
+        data.value.integralLimit = std::max(value->at(2), 0.0f);
+        data.value.hysteresis = std::max(value->at(3), 0.0f);
+        data.value.targetQueueDepth = std::max(value->at(4), 0.0f);
+    }
+
+    return data;
+}
+
+SpectrumInterpolationEnabled ConfigReader::getSpectrumInterpolationEnabled()
+{
+    SpectrumInterpolationEnabled data(themeConfig, mode);
+
+    auto value = loadBoolConfig(data.name, data.getInfo(), data.value);
+
+    if(value)
+    {
+        data.value = *value;
+    }
+
+    return data;
+}
+
+QualityGovernorSettings ConfigReader::getQualityGovernorSettings()
+{
+    QualityGovernorSettings data(themeConfig, mode);
+
+    const auto &defaultValue = data.value;
+    auto value = loadVectorConfig(data.name, data.getInfo(), {static_cast<float>(defaultValue.enabled), defaultValue.cpuBudgetInPercents, defaultValue.restoreThresholdInPercents, static_cast<float>(defaultValue.maxQueueDepth), defaultValue.restoreDelayInSeconds}, 1);
+
+    if(value && (value->size() == 5))
+    {
+        data.value.enabled = (value->at(0) != 0);
+        data.value.cpuBudgetInPercents = std::clamp(value->at(1), 1.0f, 100.0f);
+        data.value.restoreThresholdInPercents = std::clamp(value->at(2), 0.0f, data.value.cpuBudgetInPercents);
+        data.value.maxQueueDepth = static_cast<uint32_t>(std::max(value->at(3), 0.0f));
+        data.value.restoreDelayInSeconds = std::max(value->at(4), 0.0f);
+    }
+
+    return data;
+}
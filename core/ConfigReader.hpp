@@ -27,6 +27,7 @@ private:
     NormalWindowSize getNormalWindowSize();
     GapWidthInRelationToRectangleWidth getGapWidthInRelationToRectangleWidth();
     NumberOfSamples getNumberOfSamples();
+    NumberOfSamplesCollectedFromHw getNumberOfSamplesCollectedFromHw();
     SamplingRate getSamplingRate();
     DesiredFrameRate getDesiredFrameRate();
     NumberOfSignalsForAveraging getNumberOfSignalsForAveraging();
@@ -62,6 +63,25 @@ private:
     LoopbackEnabled getLoopbackEnabled();
     SingleScaleMode getSingleScaleMode();
     HorizontalDrawingArea getHorizontalDrawingArea();
+    ThreadSchedulingSettings getThreadSchedulingSettings();
+    MemoryLockingEnabled getMemoryLockingEnabled();
+    CallbackCaptureEnabled getCallbackCaptureEnabled();
+    FileDataSourcePath getFileDataSourcePath();
+    FilePlaybackSettings getFilePlaybackSettings();
+    StreamDataSourceAddress getStreamDataSourceAddress();
+    StreamDataSourceFormat getStreamDataSourceFormat();
+    SignalGeneratorLeftChannel getSignalGeneratorLeftChannel();
+    SignalGeneratorRightChannel getSignalGeneratorRightChannel();
+    FrameLogRecordPath getFrameLogRecordPath();
+    FrameLogReplayPath getFrameLogReplayPath();
+    FrameLogSettings getFrameLogSettings();
+    PythonProcessIsolationEnabled getPythonProcessIsolationEnabled();
+    TraceOutputPath getTraceOutputPath();
+    FrameTimingSettings getFrameTimingSettings();
+    FlowControllerSettings getFlowControllerSettings();
+    SpectrumInterpolationEnabled getSpectrumInterpolationEnabled();
+    QualityGovernorSettings getQualityGovernorSettings();
+    GeneratorSignal loadGeneratorSignal(const std::string &name, const std::string &info, const GeneratorSignal &defaultValue);
 
     Configuration config{};
 
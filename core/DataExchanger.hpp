@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <optional>
@@ -19,8 +20,11 @@ public:
     void push_back(T &&value);
     T get();
     std::optional<T> getWithoutBlocking();
+    std::optional<T> getWithTimeout(const std::chrono::milliseconds timeout);
     void stop();
     uint32_t getSize();
+    // values thrown away because the consumer fell behind
+    uint64_t getNumberOfDroppedValues();
 
 private:
 
@@ -28,6 +32,7 @@ private:
     std::condition_variable queueConditionVariable;
     std::queue<T> queue;
     uint32_t maxQueueSize;
+    uint64_t numberOfDroppedValues{0};
 };
 
 template<typename T>
@@ -45,6 +50,8 @@ void DataExchanger<T>::push_back(T &&value)
 
     if(queue.size()>maxQueueSize)
     {
+        numberOfDroppedValues += queue.size();
+
         while(not queue.empty())
         {
             queue.pop();
@@ -80,6 +87,21 @@ std::optional<T> DataExchanger<T>::getWithoutBlocking()
     return {};
 }
 
+template<typename T>
+std::optional<T> DataExchanger<T>::getWithTimeout(const std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> ul(queueMutex);
+
+    if(queueConditionVariable.wait_for(ul, timeout, [this](){return not this->queue.empty();}))
+    {
+        auto value = std::move(queue.front());
+        queue.pop();
+        return value;
+    }
+
+    return {};
+}
+
 template<typename T>
 void DataExchanger<T>::stop()
 {
@@ -94,3 +116,10 @@ uint32_t DataExchanger<T>::getSize()
     std::unique_lock<std::mutex> ul(queueMutex);
     return queue.size();
 }
+
+template<typename T>
+uint64_t DataExchanger<T>::getNumberOfDroppedValues()
+{
+    std::unique_lock<std::mutex> ul(queueMutex);
+    return numberOfDroppedValues;
+}
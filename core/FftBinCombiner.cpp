@@ -8,8 +8,8 @@
 #include "CommonData.hpp"
 #include "Helpers.hpp"
 
-FftBinCombiner::FftBinCombiner(const float scalingFactor, const float offsetFactor, const FrequencyIndexesPerRectangle &data)
-    : scalingFactor(scalingFactor), offsetFactor(offsetFactor), frequencyIndexesPerRectangle(data)
+FftBinCombiner::FftBinCombiner(const float scalingFactor, const float offsetFactor, const float floorDbFs, const FrequencyIndexesPerRectangle &data)
+    : scalingFactor(scalingFactor), offsetFactor(offsetFactor), floorDbFs(floorDbFs), frequencyIndexesPerRectangle(data)
 {
 }
 
@@ -23,6 +23,16 @@ float FftBinCombiner::combineRmsValues(const std::vector<std::complex<float>>& d
     return linearToDbfs({(float)std::sqrt(getSum(powerInSpectrum(calculateMagnitude(data))))}).at(0);
 }
 
+void FftBinCombiner::updateFrequencyIndexes(const FrequencyIndexesPerRectangle &data)
+{
+    frequencyIndexesPerRectangle = data;
+}
+
+void FftBinCombiner::updateFloorDbFs(const float floorDbFs)
+{
+    this->floorDbFs = floorDbFs;
+}
+
 std::vector<float> FftBinCombiner::averageMagnitudeInSpectrum(const std::vector<float> &data)
 {
     std::vector<float> averagedValues;
@@ -35,7 +45,7 @@ std::vector<float> FftBinCombiner::averageMagnitudeInSpectrum(const std::vector<
         switch (count)
         {
             case 0:
-                averagedValues.push_back(getFloorDbFs16bit());
+                averagedValues.push_back(0);
                 break;
 
             case 1:
@@ -72,7 +82,7 @@ std::vector<double> FftBinCombiner::powerInSpectrum(const std::vector<float> &da
         switch (count)
         {
         case 0:
-            result.push_back(getFloorDbFs16bit());
+            result.push_back(0);
             break;
 
         case 1:
@@ -101,15 +111,13 @@ std::vector<double> FftBinCombiner::powerInSpectrum(const std::vector<float> &da
 
 std::vector<float> FftBinCombiner::linearToDbfs(const std::vector<float> &data)
 {
-    static constexpr float fullScale16bit = 32767;
-
     std::vector<float> outputData;
     outputData.reserve(data.size());
 
     for(const auto &el : data)
     {
-        const auto powerInDbfs = 20 * log10(el / fullScale16bit);
-        outputData.push_back((powerInDbfs < getFloorDbFs16bit()) ? getFloorDbFs16bit() : powerInDbfs);
+        const auto powerInDbfs = 20 * log10(el / getFullScaleAmplitude());
+        outputData.push_back((powerInDbfs < floorDbFs) ? floorDbFs : powerInDbfs);
     }
 
     return outputData;
@@ -118,7 +126,6 @@ std::vector<float> FftBinCombiner::linearToDbfs(const std::vector<float> &data)
 std::vector<float> FftBinCombiner::calculateMagnitude(const std::vector<std::complex<float>> &data)
 {
     const uint32_t numberOfSamples = data.size();
-    static constexpr float fullScale16bit = 32767;
 
     std::vector<float> outputData(numberOfSamples);
 
@@ -13,9 +13,11 @@ class FftBinCombiner
 {
 public:
 
-    FftBinCombiner(const float scalingFactor, const float offsetFactor, const FrequencyIndexesPerRectangle &data);
+    FftBinCombiner(const float scalingFactor, const float offsetFactor, const float floorDbFs, const FrequencyIndexesPerRectangle &data);
     std::vector<float> combineMagnitudes(const std::vector<std::complex<float>> &magnitudes);
     float combineRmsValues(const std::vector<std::complex<float>>& data);
+    void updateFrequencyIndexes(const FrequencyIndexesPerRectangle &data);
+    void updateFloorDbFs(const float floorDbFs);
     virtual ~FftBinCombiner()=default;
 
 protected:
@@ -27,5 +29,6 @@ protected:
 
     const float scalingFactor;
     const float offsetFactor;
-    const FrequencyIndexesPerRectangle frequencyIndexesPerRectangle;
+    float floorDbFs;
+    FrequencyIndexesPerRectangle frequencyIndexesPerRectangle;
 };
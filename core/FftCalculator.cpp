@@ -6,7 +6,15 @@
 
 #include "FftCalculator.hpp"
 #include "DataExchanger.hpp"
+#include "Helpers.hpp"
 #include <cstdint>
+#include <mutex>
+
+namespace
+{
+// only fftw_execute is thread safe, plans have to be created and destroyed one at a time
+std::mutex plannerMutex;
+}
 
 
 FftCalculatorBase::FftCalculatorBase(uint32_t size) : outPtr(std::make_unique<std::vector<fftw_complex>>(size))
@@ -15,6 +23,7 @@ FftCalculatorBase::FftCalculatorBase(uint32_t size) : outPtr(std::make_unique<st
 
 RealFftCalculator::RealFftCalculator(uint32_t size): FftCalculatorBase((size / 2)+ 1), inRealPtr(std::make_unique<std::vector<double>>(size))
 {
+    std::lock_guard<std::mutex> lock(plannerMutex);
     p = fftw_plan_dft_r2c_1d(size, inRealPtr->data(), outPtr->data(), FFTW_MEASURE);
 }
 
@@ -50,6 +59,7 @@ FftResult RealFftCalculator::calculate(const std::vector<float> &inputData)
 
 ComplexFftCalculator::ComplexFftCalculator(uint32_t size): FftCalculatorBase(size), inComplexPtr(std::make_unique<std::vector<fftw_complex>>(size))
 {
+    std::lock_guard<std::mutex> lock(plannerMutex);
     p = fftw_plan_dft_1d(size, inComplexPtr->data(), outPtr->data(), FFTW_FORWARD,  FFTW_MEASURE);
 }
 
@@ -77,39 +87,91 @@ FftResult ComplexFftCalculator::calculate(const std::vector<float> &inputData)
 
 FftCalculatorBase::~FftCalculatorBase()
 {
+    // fftw_cleanup() is not called, it would invalidate plans still used by other calculators
+    std::lock_guard<std::mutex> lock(plannerMutex);
     fftw_destroy_plan(p);
-    fftw_cleanup();
 }
 
 WelchCalculator::WelchCalculator(const FftType fftType, const uint32_t fftSize, const float overlapping, const std::vector<float> window) :
+    fftType(fftType),
+    fftSize(fftSize),
     overlapping(overlapping),
     numberOfSamplesToBeRemoved(calculateNumberOfSamplesToBeRemoved()),
-    fftSize(fftSize), window(window)
+    window(window),
+    fftCalculator(createFftCalculator(fftSize))
 {
-    fftCalculator = (fftType == FftType::Complex)
-                        ? std::unique_ptr<FftCalculatorBase>(std::make_unique<ComplexFftCalculator>(fftSize))
-                        : std::unique_ptr<FftCalculatorBase>(std::make_unique<RealFftCalculator>(fftSize));
 }
 
-void WelchCalculator::updateBuffer(const std::vector<float> &inputData)
+void WelchCalculator::updateBuffer(const std::vector<float> &inputData, const std::chrono::steady_clock::time_point captureTime)
 {
     bufforWithDataToBeConverted.insert(bufforWithDataToBeConverted.end(), inputData.begin(), inputData.end());
+    numberOfAddedSamples += inputData.size();
+    bufferedBlocks.push_back({numberOfAddedSamples, captureTime});
 }
 
 
+void WelchCalculator::clear()
+{
+    bufforWithDataToBeConverted.clear();
+    bufferedBlocks.clear();
+    captureTimes.clear();
+    numberOfAddedSamples = 0;
+    numberOfRemovedSamples = 0;
+}
+
 void WelchCalculator::updateOverlapping(const float newOverlapping)
 {
     overlapping = newOverlapping;
     numberOfSamplesToBeRemoved = calculateNumberOfSamplesToBeRemoved();
 }
 
+void WelchCalculator::updateFftSize(const uint32_t newFftSize, const std::vector<float> &newWindow)
+{
+    if(newFftSize == fftSize)
+    {
+        return;
+    }
+
+    auto preparedFftCalculator = preparedFftCalculators.find(newFftSize);
+    auto newFftCalculator = (preparedFftCalculator != preparedFftCalculators.end()) ? std::move(preparedFftCalculator->second) : createFftCalculator(newFftSize);
+
+    // the current plan is kept as well, so switching back to this size is cheap too
+    preparedFftCalculators[fftSize] = std::move(fftCalculator);
+    fftCalculator = std::move(newFftCalculator);
+
+    fftSize = newFftSize;
+    window = newWindow;
+    numberOfSamplesToBeRemoved = calculateNumberOfSamplesToBeRemoved();
+}
+
+void WelchCalculator::prepareFftSize(const uint32_t fftSizeToBePrepared)
+{
+    if((fftSizeToBePrepared == fftSize) || preparedFftCalculators.count(fftSizeToBePrepared))
+    {
+        return;
+    }
+
+    preparedFftCalculators[fftSizeToBePrepared] = createFftCalculator(fftSizeToBePrepared);
+}
+
 
 std::vector<FftResult> WelchCalculator::calculate()
 {
     std::vector<FftResult> fftResults;
+    captureTimes.clear();
 
     while(bufforWithDataToBeConverted.size() >= fftSize)
     {
+        // segments end further and further, so blocks ending before this one are not needed anymore
+        const uint64_t endOfSegment = numberOfRemovedSamples + fftSize;
+
+        while(bufferedBlocks.front().endOfBlock < endOfSegment)
+        {
+            bufferedBlocks.pop_front();
+        }
+
+        captureTimes.push_back(bufferedBlocks.front().captureTime);
+
         std::vector<float> dataInTimeDomain(bufforWithDataToBeConverted.begin(), bufforWithDataToBeConverted.begin() + fftSize);
 
         for (uint32_t i = 0; i < fftSize; i++)
@@ -119,24 +181,28 @@ std::vector<FftResult> WelchCalculator::calculate()
 
         fftResults.emplace_back(fftCalculator->calculate(dataInTimeDomain));
         bufforWithDataToBeConverted.erase(bufforWithDataToBeConverted.begin(), bufforWithDataToBeConverted.begin() + numberOfSamplesToBeRemoved);
+        numberOfRemovedSamples += numberOfSamplesToBeRemoved;
     }
 
     return fftResults;
 }
 
+const std::vector<std::chrono::steady_clock::time_point>& WelchCalculator::getCaptureTimes() const
+{
+    return captureTimes;
+}
+
 
 uint32_t WelchCalculator::calculateNumberOfSamplesToBeRemoved()
 {
-    if(overlapping <= 0)
-    {
-        return fftSize;
-    }
+    return calculateHopSize(fftSize, overlapping);
+}
 
-    if(overlapping >= 1)
+std::unique_ptr<FftCalculatorBase> WelchCalculator::createFftCalculator(const uint32_t size) const
+{
+    if(fftType == FftType::Complex)
     {
-        const uint32_t atLeastOneSampleMustBeRemoved{1};
-        return atLeastOneSampleMustBeRemoved;
+        return std::make_unique<ComplexFftCalculator>(size);
     }
-
-    return  (fftSize - (uint32_t)(overlapping * fftSize));
+    return std::make_unique<RealFftCalculator>(size);
 }
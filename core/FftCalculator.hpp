@@ -12,6 +12,8 @@
 #include <complex>
 #include <memory>
 #include <deque>
+#include <map>
+#include <chrono>
 #include <cstdint>
 
 using FftResult= std::vector<std::complex<float>>;
@@ -55,19 +57,40 @@ class WelchCalculator
 {
 public:
     WelchCalculator(const FftType fftType, const uint32_t fftSize, const float overlapping, const std::vector<float> window);
-    void updateBuffer(const std::vector<float> &inputData);
+    void updateBuffer(const std::vector<float> &inputData, const std::chrono::steady_clock::time_point captureTime={});
     void updateOverlapping(const float newOverlapping);
+    // samples which are already buffered are kept, so the next segment uses them with the new size
+    void updateFftSize(const uint32_t newFftSize, const std::vector<float> &newWindow);
+    // plans the given size up front, so switching to it later does not measure a new FFTW plan
+    void prepareFftSize(const uint32_t fftSizeToBePrepared);
+    void clear();
     std::vector<FftResult> calculate();
 
+    // capture time of the block holding the newest sample of each result of the last calculate()
+    const std::vector<std::chrono::steady_clock::time_point>& getCaptureTimes() const;
+
 private:
+    struct BufferedBlock
+    {
+        uint64_t endOfBlock;
+        std::chrono::steady_clock::time_point captureTime;
+    };
+
     uint32_t calculateNumberOfSamplesToBeRemoved();
+    std::unique_ptr<FftCalculatorBase> createFftCalculator(const uint32_t size) const;
 
-    const uint32_t fftSize;
+    const FftType fftType;
+    uint32_t fftSize;
     float overlapping;
     uint32_t numberOfSamplesToBeRemoved;
     std::deque<float> bufforWithDataToBeConverted;
-    const std::vector<float> window;
+    std::vector<float> window;
     std::unique_ptr<FftCalculatorBase> fftCalculator;
+    std::map<uint32_t, std::unique_ptr<FftCalculatorBase>> preparedFftCalculators;
+    std::deque<BufferedBlock> bufferedBlocks;
+    uint64_t numberOfAddedSamples{0};
+    uint64_t numberOfRemovedSamples{0};
+    std::vector<std::chrono::steady_clock::time_point> captureTimes;
 };
 
 
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FrameBudgetWatchdog.hpp"
+#include <algorithm>
+#include <sstream>
+
+FrameBudgetWatchdog::FrameBudgetWatchdog(microseconds budget):
+    budget(budget)
+{
+}
+
+std::optional<std::string> FrameBudgetWatchdog::check(const std::vector<OperationTime> &operationTimes, time_point<steady_clock> now)
+{
+    if((budget == 0us) || operationTimes.empty())
+    {
+        return std::nullopt;
+    }
+
+    microseconds frameTime{0};
+
+    for(const auto &operationTime : operationTimes)
+    {
+        frameTime += operationTime.elapsedTime;
+    }
+
+    if(frameTime <= budget)
+    {
+        return std::nullopt;
+    }
+
+    ++numberOfFramesOverBudget;
+
+    if(lastReportTime && (now - *lastReportTime < minTimeBetweenReports))
+    {
+        return std::nullopt;
+    }
+
+    const auto &longestOperation = *std::max_element(operationTimes.begin(), operationTimes.end(), [](const auto &first, const auto &second){
+        return first.elapsedTime < second.elapsedTime;
+    });
+
+    std::ostringstream report;
+    report<<"Frame drawn in "<<frameTime.count()<<" us, over the budget of "<<budget.count()<<" us"
+          <<" (frames over the budget: "<<numberOfFramesOverBudget<<"), longest operation: "
+          <<longestOperation.name<<" "<<longestOperation.elapsedTime.count()<<" us";
+
+    numberOfFramesOverBudget = 0;
+    lastReportTime = now;
+
+    return report.str();
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+using namespace std::chrono;
+
+struct OperationTime
+{
+    std::string_view name;
+    microseconds elapsedTime{};
+};
+
+// Checks the drawing time of each frame against a budget. A frame over the budget is
+// reported with the operation which took most of it; to keep the log readable at most
+// one report is given per second, it includes the number of frames over the budget since
+// the previous one. A budget of zero disables the checks.
+class FrameBudgetWatchdog
+{
+public:
+    FrameBudgetWatchdog(microseconds budget);
+    std::optional<std::string> check(const std::vector<OperationTime> &operationTimes, time_point<steady_clock> now);
+
+private:
+    static constexpr seconds minTimeBetweenReports{1};
+
+    const microseconds budget;
+    uint32_t numberOfFramesOverBudget{0};
+    std::optional<time_point<steady_clock>> lastReportTime;
+};
@@ -180,6 +180,30 @@ FrequencyIndexesPerRectangle FrequenciesInfo::getAllFrequencyIndexes()
     return frequencyIndexesPerRectangle;
 }
 
+FrequencyIndexesPerRectangle FrequenciesInfo::getFrequencyIndexesOfMergedRectangles(const uint32_t numberOfMergedRectangles)
+{
+    const uint32_t groupSize = std::max<uint32_t>(numberOfMergedRectangles, 1);
+    FrequencyIndexesPerRectangle frequencyIndexesPerGroup;
+
+    for(const auto &[rectangleIndex, frequencyIndexes] : getAllFrequencyIndexes())
+    {
+        auto &frequencyIndexesOfGroup = frequencyIndexesPerGroup[rectangleIndex / groupSize];
+        frequencyIndexesOfGroup.insert(frequencyIndexesOfGroup.end(), frequencyIndexes.begin(), frequencyIndexes.end());
+    }
+
+    for(auto &[groupIndex, frequencyIndexes] : frequencyIndexesPerGroup)
+    {
+        const auto closestFrequency = closestFrequenciesMap.find(groupIndex * groupSize);
+
+        if(frequencyIndexes.empty() && (closestFrequency != closestFrequenciesMap.end()))
+        {
+            frequencyIndexes.push_back(closestFrequency->second.first);
+        }
+    }
+
+    return frequencyIndexesPerGroup;
+}
+
 std::vector<FrequencyRange> FrequenciesInfo::getFrequencyRangeForEachRectangle()
 {
     std::vector<FrequencyRange> frequencyRangePerRectangle;
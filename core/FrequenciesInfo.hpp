@@ -23,6 +23,9 @@ public:
     std::vector<RectangleIndex> getRectangleIndexesClosestToFrequencies(const Frequencies &demandedFrequencies);
     uint32_t numberOfFrequencies();
     FrequencyIndexesPerRectangle getAllFrequencyIndexes();
+    // indexes of groups of neighbouring rectangles calculated as one rectangle, a group left
+    // without frequencies by a small FFT size takes the frequency closest to its first rectangle
+    FrequencyIndexesPerRectangle getFrequencyIndexesOfMergedRectangles(const uint32_t numberOfMergedRectangles);
     std::vector<FrequencyRange> getFrequencyRangeForEachRectangle();
 
 private:
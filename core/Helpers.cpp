@@ -62,20 +62,50 @@ void zoomData(std::vector<float> &data, const float factor, const float offset)
     }
 }
 
-float calculateOverlappingDiff(const uint32_t desiredNumberOfFramesPerSecond, const uint32_t currentFramesPerSecond)
+float calculateOverlapping(const uint32_t samplingRate, const uint32_t numberOfSamples, const uint32_t numberOfFramesPerSecond)
 {
-    static constexpr float slope = 0.2;
+    auto fps = (numberOfFramesPerSecond == 0) ? 1 : numberOfFramesPerSecond;
 
-    auto desiredFps = (desiredNumberOfFramesPerSecond == 0) ? 1 : desiredNumberOfFramesPerSecond;
+    return  (1.0 - static_cast<float>(samplingRate)/(numberOfSamples * fps));
+}
 
-    return (-slope/desiredFps)*currentFramesPerSecond + slope;
+// Number of new samples between two consecutive FFT frames.
+uint32_t calculateHopSize(const uint32_t numberOfSamples, const float overlapping)
+{
+    if(overlapping <= 0)
+    {
+        return numberOfSamples;
+    }
+
+    if(overlapping >= 1)
+    {
+        const uint32_t atLeastOneSampleMustBeRemoved{1};
+        return atLeastOneSampleMustBeRemoved;
+    }
+
+    return  (numberOfSamples - (uint32_t)(overlapping * numberOfSamples));
 }
 
-float calculateOverlapping(const uint32_t samplingRate, const uint32_t numberOfSamples, const uint32_t numberOfFramesPerSecond)
+// Adaptive capture block: the largest power of two which still delivers at least
+// two blocks per FFT hop. The hop is limited by the FFT length, because without
+// overlapping every FFT consumes exactly numberOfSamples new samples.
+uint32_t calculateNumberOfSamplesCollectedFromHw(const uint32_t samplingRate, const uint32_t numberOfSamples, const uint32_t numberOfFramesPerSecond)
 {
+    static constexpr uint32_t minNumberOfSamples = 64;
+    static constexpr uint32_t maxNumberOfSamples = 4096;
+
     auto fps = (numberOfFramesPerSecond == 0) ? 1 : numberOfFramesPerSecond;
 
-    return  (1.0 - static_cast<float>(samplingRate)/(numberOfSamples * fps));
+    const uint32_t hop = std::min(numberOfSamples, samplingRate / fps);
+
+    uint32_t result = minNumberOfSamples;
+
+    while((result * 2 <= hop / 2) && (result * 2 <= maxNumberOfSamples))
+    {
+        result *= 2;
+    }
+
+    return result;
 }
 
 std::string formatFloat(float value, int totalWidth, int precision)
@@ -97,6 +127,33 @@ std::string formatFloat(float value, int totalWidth, int precision)
 //        |
 // stopDbFs (bottom = 0% of the screen)
 
+std::vector<float> takeEveryNthValue(const std::vector<float> &data, const uint32_t n)
+{
+    std::vector<float> result;
+    result.reserve(data.size() / std::max<uint32_t>(n, 1) + 1);
+
+    for(uint32_t i=0; i<data.size(); i+=std::max<uint32_t>(n, 1))
+    {
+        result.push_back(data[i]);
+    }
+
+    return result;
+}
+
+std::vector<float> repeatEachValue(const std::vector<float> &data, const uint32_t numberOfRepetitions, const uint32_t size)
+{
+    std::vector<float> result;
+    result.reserve(size);
+
+    for(uint32_t i=0; i<size; ++i)
+    {
+        const uint32_t index = i / std::max<uint32_t>(numberOfRepetitions, 1);
+        result.push_back(data.empty() ? getFloorDbFs16bit() : data[std::min<uint32_t>(index, data.size() - 1)]);
+    }
+
+    return result;
+}
+
 std::vector<float> scaleDbfsToPercents(const std::vector<float> &dataInDbfs, float startDbFs, float stopDbFs)
 {
     const float hundredPercents = 100;
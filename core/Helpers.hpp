@@ -16,10 +16,13 @@ float getAverage(const std::vector<float> &data);
 std::vector<float> getAverage(const std::vector<float> &left, const std::vector<float> &right);
 void zoomData(std::vector<float> &data, const float factor, const float offset);
 std::vector<float> calculatePower(const std::vector<std::complex<float>> &fftData, const float amplitudeCorrection=0, const float offsetFactor=0);
-float calculateOverlappingDiff(const uint32_t desiredNumberOfFramesPerSecond, const uint32_t currentFramesPerSecond);
 float calculateOverlapping(const uint32_t samplingRate, const uint32_t numberOfSamples, const uint32_t numberOfFramesPerSecond);
+uint32_t calculateHopSize(const uint32_t numberOfSamples, const float overlapping);
+uint32_t calculateNumberOfSamplesCollectedFromHw(const uint32_t samplingRate, const uint32_t numberOfSamples, const uint32_t numberOfFramesPerSecond);
 std::string formatFloat(float value, int totalWidth, int precision);
-std::vector<float> scaleDbfsToPercents(const std::vector<float> &dataInDbfs, float startDbFs=0, float stopDbFs = getFloorDbFs16bit());
+std::vector<float> takeEveryNthValue(const std::vector<float> &data, const uint32_t n);
+std::vector<float> repeatEachValue(const std::vector<float> &data, const uint32_t numberOfRepetitions, const uint32_t size);
+std::vector<float> scaleDbfsToPercents(const std::vector<float> &dataInDbfs, float startDbFs, float stopDbFs);
 
 template<typename T>
 bool isEqual(T a, T b, T epsilon = static_cast<T>(1e-6))
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <cstdint>
+
+// Triple buffer which passes only the newest value from one producer to one consumer.
+// publish() never waits for the consumer: a value which was not taken in time is
+// overwritten by the next one. getNewValue() hands over the newest value without
+// copying it; it stays valid until the next call. Only waiting for a new value and
+// stop() use a mutex, the hand-over itself is a single atomic exchange on each side.
+template<typename T>
+class LatestValueMailbox
+{
+public:
+    void publish(T &&value);
+
+    // true when a new value can be taken or the mailbox was stopped
+    bool waitForNewValue(const std::chrono::milliseconds timeout);
+    // nullptr when nothing was published since the previous call
+    const T* getNewValue();
+    // number of values published up to and including the one returned last
+    uint64_t getSequenceNumberOfLastValue() const;
+
+    uint64_t getNumberOfPublishedValues() const;
+    // values which were overwritten before the consumer took them
+    uint64_t getNumberOfOverwrittenValues() const;
+    void stop();
+
+private:
+    struct Slot
+    {
+        T value{};
+        uint64_t sequenceNumber{0};
+    };
+
+    static constexpr uint8_t indexMask{3};
+    static constexpr uint8_t newValueFlag{4};
+
+    bool checkIfNewValueIsAvailable() const;
+
+    std::array<Slot, 3> slots;
+    uint8_t producerIndex{0};
+    std::atomic<uint8_t> sharedIndex{1};
+    uint8_t consumerIndex{2};
+
+    std::atomic<uint64_t> numberOfPublishedValues{0};
+    std::atomic<uint64_t> numberOfOverwrittenValues{0};
+
+    std::mutex waitingMutex;
+    std::condition_variable waitingConditionVariable;
+    bool stopped{false};
+};
+
+template<typename T>
+void LatestValueMailbox<T>::publish(T &&value)
+{
+    const auto sequenceNumber = numberOfPublishedValues.load(std::memory_order_relaxed) + 1;
+
+    slots[producerIndex].value = std::move(value);
+    slots[producerIndex].sequenceNumber = sequenceNumber;
+
+    const auto previousIndex = sharedIndex.exchange(producerIndex | newValueFlag, std::memory_order_acq_rel);
+    producerIndex = previousIndex & indexMask;
+
+    if(previousIndex & newValueFlag)
+    {
+        numberOfOverwrittenValues.fetch_add(1, std::memory_order_relaxed);
+    }
+    numberOfPublishedValues.store(sequenceNumber, std::memory_order_relaxed);
+
+    // the consumer checks for a new value while holding the mutex, so the notification cannot be lost
+    {
+        std::lock_guard<std::mutex> lg(waitingMutex);
+    }
+    waitingConditionVariable.notify_one();
+}
+
+template<typename T>
+bool LatestValueMailbox<T>::waitForNewValue(const std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> ul(waitingMutex);
+    return waitingConditionVariable.wait_for(ul, timeout, [this](){return stopped || checkIfNewValueIsAvailable();});
+}
+
+template<typename T>
+const T* LatestValueMailbox<T>::getNewValue()
+{
+    if(!checkIfNewValueIsAvailable())
+    {
+        return nullptr;
+    }
+
+    consumerIndex = sharedIndex.exchange(consumerIndex, std::memory_order_acq_rel) & indexMask;
+    return &slots[consumerIndex].value;
+}
+
+template<typename T>
+uint64_t LatestValueMailbox<T>::getSequenceNumberOfLastValue() const
+{
+    return slots[consumerIndex].sequenceNumber;
+}
+
+template<typename T>
+uint64_t LatestValueMailbox<T>::getNumberOfPublishedValues() const
+{
+    return numberOfPublishedValues.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+uint64_t LatestValueMailbox<T>::getNumberOfOverwrittenValues() const
+{
+    return numberOfOverwrittenValues.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+void LatestValueMailbox<T>::stop()
+{
+    {
+        std::lock_guard<std::mutex> lg(waitingMutex);
+        stopped = true;
+    }
+    waitingConditionVariable.notify_all();
+}
+
+template<typename T>
+bool LatestValueMailbox<T>::checkIfNewValueIsAvailable() const
+{
+    return sharedIndex.load(std::memory_order_acquire) & newValueFlag;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "OverlappingController.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+float smooth(const float previousValue, const float newValue, const float smoothingFactor)
+{
+    return (previousValue == 0) ? newValue : (previousValue + smoothingFactor * (newValue - previousValue));
+}
+
+}
+
+std::ostream& operator<<(std::ostream& os, const FlowControllerState &state)
+{
+    os<<"frame rate measured/display/demanded: "<<state.measuredFrameRate<<"/"<<state.displayFrameRate<<"/"<<state.demandedFrameRate
+      <<" queue depth: "<<state.queueDepth<<" integral: "<<state.integral
+      <<" overlapping: "<<state.overlapping<<(state.saturated ? " (saturated)" : "");
+    return os;
+}
+
+OverlappingController::OverlappingController(const FlowControl &settings, const uint32_t samplingRate, const uint32_t numberOfSamples, const uint32_t desiredFrameRate):
+    settings(settings),
+    samplingRate(samplingRate),
+    numberOfSamples(numberOfSamples),
+    minFrameRate(static_cast<float>(samplingRate) / numberOfSamples),
+    maxFrameRate(std::max(static_cast<float>(desiredFrameRate), minFrameRate))
+{
+    state.demandedFrameRate = maxFrameRate;
+    state.overlapping = convertToOverlapping(maxFrameRate);
+}
+
+std::optional<float> OverlappingController::update(const FrameSwap &frameSwap, const uint32_t queueDepth)
+{
+    float integrationStep{0};
+
+    if(previousSwapTime && (frameSwap.swapTime > *previousSwapTime))
+    {
+        const auto timeBetweenFrames = duration<float>(frameSwap.swapTime - *previousSwapTime).count();
+
+        state.measuredFrameRate = smooth(state.measuredFrameRate, 1 / timeBetweenFrames, smoothingFactorOfMeasuredFrameRate);
+        integrationStep = std::min(timeBetweenFrames, duration<float>(maxIntegrationStep).count());
+    }
+    previousSwapTime = frameSwap.swapTime;
+
+    if(frameSwap.drawingTime > steady_clock::duration::zero())
+    {
+        state.displayFrameRate = smooth(state.displayFrameRate, 1 / duration<float>(frameSwap.drawingTime).count(), smoothingFactorOfDisplayFrameRate);
+    }
+
+    const float feedForwardFrameRate = (state.displayFrameRate > 0) ? std::clamp(state.displayFrameRate, minFrameRate, maxFrameRate) : maxFrameRate;
+    const float error = settings.targetQueueDepth - queueDepth;
+    const float unlimitedFrameRate = feedForwardFrameRate + settings.proportionalGain * error + state.integral;
+
+    state.saturated = ((unlimitedFrameRate >= maxFrameRate) && (error > 0)) || ((unlimitedFrameRate <= minFrameRate) && (error < 0));
+
+    if(!state.saturated)
+    {
+        state.integral = std::clamp(state.integral + settings.integralGain * error * integrationStep, -settings.integralLimit, settings.integralLimit);
+    }
+
+    state.queueDepth = queueDepth;
+    state.demandedFrameRate = std::clamp(feedForwardFrameRate + settings.proportionalGain * error + state.integral, minFrameRate, maxFrameRate);
+
+    const auto overlapping = convertToOverlapping(state.demandedFrameRate);
+
+    if(std::abs(overlapping - state.overlapping) <= settings.hysteresis)
+    {
+        return std::nullopt;
+    }
+
+    state.overlapping = overlapping;
+    return overlapping;
+}
+
+const FlowControllerState& OverlappingController::getState() const
+{
+    return state;
+}
+
+void OverlappingController::updateLimits(const uint32_t numberOfSamples, const float maxFrameRate)
+{
+    this->numberOfSamples = numberOfSamples;
+    minFrameRate = samplingRate / numberOfSamples;
+    this->maxFrameRate = std::max(maxFrameRate, minFrameRate);
+    state.demandedFrameRate = std::clamp(state.demandedFrameRate, minFrameRate, this->maxFrameRate);
+    state.overlapping = convertToOverlapping(state.demandedFrameRate);
+}
+
+float OverlappingController::convertToOverlapping(const float frameRate) const
+{
+    return std::clamp(1 - samplingRate / (numberOfSamples * frameRate), 0.0f, 1.0f);
+}
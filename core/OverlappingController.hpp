@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "CommonTypes.hpp"
+#include <chrono>
+#include <optional>
+#include <ostream>
+#include <cstdint>
+
+using namespace std::chrono;
+
+// sent by the drafter after every frame, the drawing time runs from taking the spectrum
+// out of the mailbox to the return of swapBuffers, so it includes waiting for vsync
+struct FrameSwap
+{
+    time_point<steady_clock> swapTime;
+    steady_clock::duration drawingTime;
+};
+
+struct FlowControllerState
+{
+    float measuredFrameRate{0};
+    float displayFrameRate{0};
+    float demandedFrameRate{0};
+    uint32_t queueDepth{0};
+    float integral{0};
+    float overlapping{0};
+    bool saturated{false};
+};
+
+std::ostream& operator<<(std::ostream& os, const FlowControllerState &state);
+
+// Controller of the number of spectra published between two swapped frames (the queue depth),
+// updated after every swapped frame. Spectra above one per frame are never shown.
+// Its output is the rate at which spectra are demanded from the FFT: the rate the display can
+// take, estimated from the drawing times and limited to DesiredFrameRate, corrected by a PI term
+// of the error of the queue depth. The rate is turned into overlapping with the model
+// overlapping = 1 - samplingRate / (numberOfSamples * frameRate). It is limited to the range
+// reachable without overlapping up to DesiredFrameRate; while it is limited in the direction
+// of the error the integral is frozen, so it does not wind up.
+class OverlappingController
+{
+public:
+    OverlappingController(const FlowControl &settings, const uint32_t samplingRate, const uint32_t numberOfSamples, const uint32_t desiredFrameRate);
+
+    // returns the new overlapping when it moved by more than the hysteresis
+    std::optional<float> update(const FrameSwap &frameSwap, const uint32_t queueDepth);
+    const FlowControllerState& getState() const;
+    // follows a change of the FFT size or of the highest frame rate, the integral is kept
+    void updateLimits(const uint32_t numberOfSamples, const float maxFrameRate);
+
+private:
+    float convertToOverlapping(const float frameRate) const;
+
+    static constexpr float smoothingFactorOfMeasuredFrameRate{0.1};
+    static constexpr float smoothingFactorOfDisplayFrameRate{0.3};
+    static constexpr milliseconds maxIntegrationStep{100};
+
+    const FlowControl settings;
+    const float samplingRate;
+    float numberOfSamples;
+    float minFrameRate;
+    float maxFrameRate;
+    std::optional<time_point<steady_clock>> previousSwapTime;
+    FlowControllerState state;
+};
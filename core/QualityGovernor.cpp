@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "QualityGovernor.hpp"
+#include <algorithm>
+#include <cmath>
+
+std::ostream& operator<<(std::ostream& os, const QualityLevel level)
+{
+    os<<static_cast<uint32_t>(level);
+
+    switch(level)
+    {
+    case QualityLevel::Full:
+        os<<" (full quality)";
+        break;
+    case QualityLevel::FewerWelchSegments:
+        os<<" (fewer Welch segments)";
+        break;
+    case QualityLevel::SmallerFftSize:
+        os<<" (smaller FFT size)";
+        break;
+    case QualityLevel::MergedBars:
+        os<<" (merged bars)";
+        break;
+    case QualityLevel::SkippedExpensiveLayers:
+        os<<" (expensive layers skipped)";
+        break;
+    }
+    return os;
+}
+
+float getMaxFrameRate(const QualityLevel level, const uint32_t desiredFrameRate)
+{
+    return (level >= QualityLevel::FewerWelchSegments) ? desiredFrameRate / 2.0f : desiredFrameRate;
+}
+
+uint32_t getFftSize(const QualityLevel level, const uint32_t numberOfSamples)
+{
+    return (level >= QualityLevel::SmallerFftSize) ? std::max<uint32_t>(numberOfSamples / 2, 2) : numberOfSamples;
+}
+
+uint32_t getNumberOfMergedBars(const QualityLevel level)
+{
+    return (level >= QualityLevel::MergedBars) ? 2 : 1;
+}
+
+bool areExpensiveLayersSkipped(const QualityLevel level)
+{
+    return level >= QualityLevel::SkippedExpensiveLayers;
+}
+
+PipelineLoadMeter::PipelineLoadMeter(const std::vector<std::pair<std::string, StageMetricsHandle>> &stages)
+{
+    for(const auto &[name, metrics] : stages)
+    {
+        this->stages.push_back(MeasuredStage{name, metrics});
+    }
+}
+
+PipelineLoad PipelineLoadMeter::measure(const uint32_t queueDepth, const uint64_t totalNumberOfDroppedValues, const time_point<steady_clock> now)
+{
+    PipelineLoad load{"", 0, queueDepth, 0};
+    const auto elapsedTime = previousTime ? duration_cast<microseconds>(now - *previousTime) : microseconds::zero();
+
+    auto updateLoad = [&load, elapsedTime](const std::string &name, const microseconds processingTime)
+    {
+        const float cpuLoadInPercents = (elapsedTime > microseconds::zero()) ? (100.0f * processingTime.count() / elapsedTime.count()) : 0;
+
+        if(load.busiestStage.empty() || (cpuLoadInPercents > load.cpuLoadInPercents))
+        {
+            load.busiestStage = name;
+            load.cpuLoadInPercents = cpuLoadInPercents;
+        }
+    };
+
+    for(auto &stage : stages)
+    {
+        const auto totalProcessingTime = stage.metrics->getTotalProcessingTime();
+        updateLoad(stage.name, totalProcessingTime - stage.previousTotalProcessingTime);
+        stage.previousTotalProcessingTime = totalProcessingTime;
+    }
+
+    const auto totalDrawingTime = getTotalDrawingTime();
+    updateLoad("drawing", totalDrawingTime - previousTotalDrawingTime);
+    previousTotalDrawingTime = totalDrawingTime;
+
+    load.numberOfDroppedValues = previousTime ? (totalNumberOfDroppedValues - previousTotalNumberOfDroppedValues) : 0;
+    previousTotalNumberOfDroppedValues = totalNumberOfDroppedValues;
+    previousTime = now;
+
+    return load;
+}
+
+microseconds PipelineLoadMeter::getTotalDrawingTime()
+{
+    microseconds totalDrawingTime{};
+
+    for(const auto &[name, metrics] : Metrics::getStagesStartingWith("drawing/"))
+    {
+        totalDrawingTime += metrics->getTotalProcessingTime();
+    }
+
+    return totalDrawingTime;
+}
+
+std::ostream& operator<<(std::ostream& os, const QualityTransition &transition)
+{
+    os<<((transition.level > transition.previousLevel) ? "quality lowered: " : "quality restored: ")
+      <<transition.previousLevel<<" -> "<<transition.level<<", "<<transition.reason;
+    return os;
+}
+
+QualityGovernor::QualityGovernor(const QualityControl &settings):
+    settings(settings)
+{
+}
+
+std::optional<QualityTransition> QualityGovernor::update(const PipelineLoad &load, const time_point<steady_clock> now)
+{
+    if(!settings.enabled)
+    {
+        return std::nullopt;
+    }
+
+    const auto previousLevel = level;
+
+    if(const auto overloadReason = getOverloadReason(load))
+    {
+        headroomStartTime.reset();
+        numberOfOverloadedChecks = std::min(numberOfOverloadedChecks + 1, numberOfOverloadedChecksToLowerQuality);
+
+        const bool valuesDropped = (load.numberOfDroppedValues > 0);
+
+        if((level == QualityLevel::SkippedExpensiveLayers) || ((numberOfOverloadedChecks < numberOfOverloadedChecksToLowerQuality) && !valuesDropped))
+        {
+            return std::nullopt;
+        }
+
+        if(restoreTime && ((now - *restoreTime) < getRestoreDelay()))
+        {
+            restoreDelayMultiplier = std::min(restoreDelayMultiplier * 2, maxRestoreDelayMultiplier);
+        }
+
+        restoreTime.reset();
+        numberOfOverloadedChecks = 0;
+        level = static_cast<QualityLevel>(static_cast<uint8_t>(level) + 1);
+
+        return QualityTransition{previousLevel, level, *overloadReason};
+    }
+
+    numberOfOverloadedChecks = 0;
+
+    if((level == QualityLevel::Full) || !checkIfThereIsHeadroom(load))
+    {
+        headroomStartTime.reset();
+        return std::nullopt;
+    }
+
+    if(!headroomStartTime)
+    {
+        headroomStartTime = now;
+    }
+
+    if((now - *headroomStartTime) < getRestoreDelay())
+    {
+        return std::nullopt;
+    }
+
+    const auto timeWithHeadroom = std::lround(duration<float>(now - *headroomStartTime).count());
+
+    headroomStartTime.reset();
+    restoreTime = now;
+    level = static_cast<QualityLevel>(static_cast<uint8_t>(level) - 1);
+
+    return QualityTransition{previousLevel, level, load.busiestStage + " busy below " + std::to_string(std::lround(settings.restoreThresholdInPercents)) +
+                                                   "% of the time for " + std::to_string(timeWithHeadroom) + " s"};
+}
+
+QualityLevel QualityGovernor::getLevel() const
+{
+    return level;
+}
+
+std::optional<std::string> QualityGovernor::getOverloadReason(const PipelineLoad &load) const
+{
+    if(load.numberOfDroppedValues > 0)
+    {
+        return std::to_string(load.numberOfDroppedValues) + " values dropped by overflowing queues";
+    }
+
+    if(load.cpuLoadInPercents > settings.cpuBudgetInPercents)
+    {
+        return load.busiestStage + " busy " + std::to_string(std::lround(load.cpuLoadInPercents)) + "% of the time";
+    }
+
+    if(load.queueDepth > settings.maxQueueDepth)
+    {
+        return "FFT queue holds " + std::to_string(load.queueDepth) + " items";
+    }
+
+    return std::nullopt;
+}
+
+bool QualityGovernor::checkIfThereIsHeadroom(const PipelineLoad &load) const
+{
+    return (load.cpuLoadInPercents < settings.restoreThresholdInPercents) && (load.queueDepth <= settings.maxQueueDepth);
+}
+
+steady_clock::duration QualityGovernor::getRestoreDelay() const
+{
+    return duration_cast<steady_clock::duration>(duration<float>(settings.restoreDelayInSeconds * restoreDelayMultiplier));
+}
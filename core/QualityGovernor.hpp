@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "CommonTypes.hpp"
+#include "Stats.hpp"
+#include <chrono>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace std::chrono;
+
+// Every level keeps the steps of the levels below it. Stages which have nothing to
+// lower at a step, e.g. the stereo RMS meter which has no bars, ignore it.
+enum class QualityLevel : uint8_t
+{
+    Full,
+    FewerWelchSegments,
+    SmallerFftSize,
+    MergedBars,
+    SkippedExpensiveLayers
+};
+
+std::ostream& operator<<(std::ostream& os, const QualityLevel level);
+
+// Welch segments are demanded at most at this part of DesiredFrameRate
+float getMaxFrameRate(const QualityLevel level, const uint32_t desiredFrameRate);
+uint32_t getFftSize(const QualityLevel level, const uint32_t numberOfSamples);
+// number of neighbouring bars calculated as one
+uint32_t getNumberOfMergedBars(const QualityLevel level);
+bool areExpensiveLayersSkipped(const QualityLevel level);
+
+// Load of the pipeline since the previous check: the busiest stage with the part of
+// the time its thread was working, the depth of the FFT queue and the values dropped
+// by overflowing queues.
+struct PipelineLoad
+{
+    std::string busiestStage;
+    float cpuLoadInPercents{0};
+    uint32_t queueDepth{0};
+    uint64_t numberOfDroppedValues{0};
+};
+
+// Measures the load from the total processing times of the given stages and of the drawing
+// operations of a frame together, so the drawing does not include waiting for swapBuffers.
+// The first measurement only takes the starting values.
+class PipelineLoadMeter
+{
+public:
+    PipelineLoadMeter(const std::vector<std::pair<std::string, StageMetricsHandle>> &stages);
+    PipelineLoad measure(const uint32_t queueDepth, const uint64_t totalNumberOfDroppedValues, const time_point<steady_clock> now);
+
+private:
+    struct MeasuredStage
+    {
+        std::string name;
+        StageMetricsHandle metrics;
+        microseconds previousTotalProcessingTime{};
+    };
+
+    static microseconds getTotalDrawingTime();
+
+    std::vector<MeasuredStage> stages;
+    microseconds previousTotalDrawingTime{};
+    uint64_t previousTotalNumberOfDroppedValues{0};
+    std::optional<time_point<steady_clock>> previousTime;
+};
+
+struct QualityTransition
+{
+    QualityLevel previousLevel;
+    QualityLevel level;
+    std::string reason;
+};
+
+std::ostream& operator<<(std::ostream& os, const QualityTransition &transition);
+
+// Lowers the quality one step after two overloaded checks in a row, or at once when
+// values were dropped, and restores one step after the load stays below the restore
+// threshold for the restore delay. A step which has to be lowered again within that
+// delay after being restored doubles the delay, up to maxRestoreDelayMultiplier times,
+// so the governor does not keep switching between two levels.
+class QualityGovernor
+{
+public:
+    QualityGovernor(const QualityControl &settings);
+
+    // called periodically, returns the transition when the level changed
+    std::optional<QualityTransition> update(const PipelineLoad &load, const time_point<steady_clock> now);
+    QualityLevel getLevel() const;
+
+private:
+    static constexpr uint32_t numberOfOverloadedChecksToLowerQuality{2};
+    static constexpr uint32_t maxRestoreDelayMultiplier{8};
+
+    std::optional<std::string> getOverloadReason(const PipelineLoad &load) const;
+    bool checkIfThereIsHeadroom(const PipelineLoad &load) const;
+    steady_clock::duration getRestoreDelay() const;
+
+    const QualityControl settings;
+    QualityLevel level{QualityLevel::Full};
+    uint32_t numberOfOverloadedChecks{0};
+    std::optional<time_point<steady_clock>> headroomStartTime;
+    std::optional<time_point<steady_clock>> restoreTime;
+    uint32_t restoreDelayMultiplier{1};
+};
@@ -9,15 +9,30 @@
 #include "ConfigReader.hpp"
 #include "DataExchanger.hpp"
 #include "FftCalculator.hpp"
+#include "LatestValueMailbox.hpp"
+#include "OverlappingController.hpp"
+#include "ThreadPolicy.hpp"
+#include "Tracer.hpp"
 #include <vector>
 #include <thread>
 #include <atomic>
 #include <future>
 #include <variant>
 #include <any>
+#include <chrono>
+#include <iostream>
 
 using AppEvent = std::variant<ThemeConfig, ApplicationState>;
 
+// A value passed between pipeline stages with the capture time of the newest audio
+// sample it is based on, so every stage can measure its latency from the capture.
+template<typename T>
+struct Timestamped
+{
+    T value;
+    std::chrono::steady_clock::time_point captureTime;
+};
+
 class SpectrumAnalyzerBase
 {
 public:
@@ -29,9 +44,9 @@ public:
         appEventPromise(std::promise<AppEvent>(std::move(appEvent))),
         dataExchanger(configuration.get<MaxQueueSize>()),
         fftDataExchanger(configuration.get<MaxQueueSize>()),
-        processedDataExchanger(configuration.get<MaxQueueSize>()),
-        flowControlDataExchanger(maxQueueSizeForFlowController)
+        frameSwapDataExchanger(maxQueueSizeForFrameSwaps)
     {
+        Tracer::setEnabled(!config.get<TraceOutputPath>().empty());
     }
 
     void run()
@@ -43,6 +58,12 @@ public:
                 thread.join();
             }
         }
+
+        if(Tracer::isEnabled())
+        {
+            saveTrace();
+            Tracer::clear();
+        }
     }
 
     AppEvent getEvent()
@@ -64,6 +85,23 @@ public:
 
 protected:
 
+    void applyThreadPolicy(const PipelineStage stage, const std::string &threadName)
+    {
+        ThreadPolicy(config.get<ThreadSchedulingSettings>(), stage).applyToCurrentThread(threadName);
+        Tracer::setCurrentThreadName(threadName);
+    }
+
+    void saveTrace()
+    {
+        if(Tracer::saveChromeTrace(config.get<TraceOutputPath>()))
+        {
+            std::cout<<"Trace saved to: "<<config.get<TraceOutputPath>()<<std::endl;
+        }
+        else
+        {
+            std::cout<<"Trace could not be saved to: "<<config.get<TraceOutputPath>()<<std::endl;
+        }
+    }
 
     using Data = std::vector<float>;
     const Configuration config;
@@ -76,9 +114,14 @@ protected:
 
     DataExchanger<std::unique_ptr<std::any>> dataExchanger;
     DataExchanger<std::unique_ptr<std::any>> fftDataExchanger;
-    DataExchanger<std::unique_ptr<std::any>> processedDataExchanger;
-    DataExchanger<float> flowControlDataExchanger;
+    // the drafter takes only the newest spectrum, so processing never waits for the display
+    LatestValueMailbox<Timestamped<Data>> processedDataMailbox;
+    // only the newest overlapping matters, so none demanded by the flowController is lost
+    // when several are published before the FFT takes one
+    LatestValueMailbox<float> overlappingMailbox;
+    // every swap done by the drafter, the flowController reacts to each of them
+    DataExchanger<FrameSwap> frameSwapDataExchanger;
     std::vector<std::thread> threads;
 private:
-    static constexpr uint32_t maxQueueSizeForFlowController = 1;
+    static constexpr uint32_t maxQueueSizeForFrameSwaps = 64;
 };
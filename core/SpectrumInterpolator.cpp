@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SpectrumInterpolator.hpp"
+#include <algorithm>
+
+void SpectrumInterpolator::push(const std::vector<float> &spectrum, const time_point<steady_clock> captureTime, const time_point<steady_clock> arrivalTime)
+{
+    // the picture continues from what was drawn last, not from the previous spectrum
+    previousSpectrum = isEmpty() ? spectrum : get(arrivalTime);
+    timeBetweenCaptures = isEmpty() ? steady_clock::duration::zero() : (captureTime - newestCaptureTime);
+    newestSpectrum = spectrum;
+    newestCaptureTime = captureTime;
+    this->arrivalTime = arrivalTime;
+}
+
+bool SpectrumInterpolator::isEmpty() const
+{
+    return newestSpectrum.empty();
+}
+
+std::vector<float> SpectrumInterpolator::get(const time_point<steady_clock> now) const
+{
+    if((timeBetweenCaptures <= steady_clock::duration::zero()) || (previousSpectrum.size() != newestSpectrum.size()))
+    {
+        return newestSpectrum;
+    }
+
+    const float factor = std::clamp(duration<float>(now - arrivalTime).count() / duration<float>(timeBetweenCaptures).count(), 0.0f, 1.0f);
+
+    std::vector<float> spectrum(newestSpectrum.size());
+
+    std::transform(previousSpectrum.begin(), previousSpectrum.end(), newestSpectrum.begin(), spectrum.begin(), [factor](const float previous, const float newest){
+        return previous + factor * (newest - previous);
+    });
+
+    return spectrum;
+}
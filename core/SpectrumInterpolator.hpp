@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono;
+
+// Blends the two newest spectra, so bars move smoothly when frames are drawn more often
+// than spectra arrive. After a spectrum arrives the result moves from the previous one
+// to it over the time between their captures, which delays the picture by that time.
+class SpectrumInterpolator
+{
+public:
+    void push(const std::vector<float> &spectrum, const time_point<steady_clock> captureTime, const time_point<steady_clock> arrivalTime);
+    bool isEmpty() const;
+    std::vector<float> get(const time_point<steady_clock> now) const;
+
+private:
+    std::vector<float> previousSpectrum;
+    std::vector<float> newestSpectrum;
+    steady_clock::duration timeBetweenCaptures{};
+    time_point<steady_clock> newestCaptureTime{};
+    time_point<steady_clock> arrivalTime{};
+};
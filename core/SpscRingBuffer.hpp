@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// Wait-free single producer / single consumer ring. write() may only be called
+// from one thread and read()/clear() from another one. Neither side ever blocks
+// or allocates, so the producer can be an audio callback.
+template<typename T>
+class SpscRingBuffer
+{
+public:
+    SpscRingBuffer(size_t minimalCapacity);
+    size_t write(const T *data, size_t numberOfElements);
+    size_t read(T *data, size_t numberOfElements);
+
+    // Zero-copy producer side: the producer fills the returned contiguous free space
+    // in place and publishes the stored elements with commitWrite().
+    std::pair<T*, size_t> getWriteRegion();
+    void commitWrite(size_t numberOfElements);
+
+    size_t getSize() const;
+    size_t getCapacity() const;
+    void clear();
+
+private:
+    static size_t roundUpToPowerOfTwo(size_t value);
+
+    std::vector<T> buffer;
+    const size_t mask;
+    alignas(64) std::atomic<size_t> writeIndex{0};
+    alignas(64) std::atomic<size_t> readIndex{0};
+};
+
+template<typename T>
+SpscRingBuffer<T>::SpscRingBuffer(size_t minimalCapacity):
+    buffer(roundUpToPowerOfTwo(minimalCapacity)),
+    mask(buffer.size() - 1)
+{
+}
+
+template<typename T>
+size_t SpscRingBuffer<T>::write(const T *data, size_t numberOfElements)
+{
+    const auto write = writeIndex.load(std::memory_order_relaxed);
+    const auto read = readIndex.load(std::memory_order_acquire);
+
+    numberOfElements = std::min(numberOfElements, buffer.size() - (write - read));
+
+    const auto position = write & mask;
+    const auto firstPart = std::min(numberOfElements, buffer.size() - position);
+
+    std::copy(data, data + firstPart, buffer.begin() + position);
+    std::copy(data + firstPart, data + numberOfElements, buffer.begin());
+
+    writeIndex.store(write + numberOfElements, std::memory_order_release);
+
+    return numberOfElements;
+}
+
+template<typename T>
+std::pair<T*, size_t> SpscRingBuffer<T>::getWriteRegion()
+{
+    const auto write = writeIndex.load(std::memory_order_relaxed);
+    const auto read = readIndex.load(std::memory_order_acquire);
+
+    const auto position = write & mask;
+    const auto numberOfElements = std::min(buffer.size() - (write - read), buffer.size() - position);
+
+    return {buffer.data() + position, numberOfElements};
+}
+
+template<typename T>
+void SpscRingBuffer<T>::commitWrite(size_t numberOfElements)
+{
+    writeIndex.store(writeIndex.load(std::memory_order_relaxed) + numberOfElements, std::memory_order_release);
+}
+
+template<typename T>
+size_t SpscRingBuffer<T>::read(T *data, size_t numberOfElements)
+{
+    const auto read = readIndex.load(std::memory_order_relaxed);
+    const auto write = writeIndex.load(std::memory_order_acquire);
+
+    numberOfElements = std::min(numberOfElements, write - read);
+
+    const auto position = read & mask;
+    const auto firstPart = std::min(numberOfElements, buffer.size() - position);
+
+    std::copy(buffer.begin() + position, buffer.begin() + position + firstPart, data);
+    std::copy(buffer.begin(), buffer.begin() + (numberOfElements - firstPart), data + firstPart);
+
+    readIndex.store(read + numberOfElements, std::memory_order_release);
+
+    return numberOfElements;
+}
+
+template<typename T>
+size_t SpscRingBuffer<T>::getSize() const
+{
+    return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+}
+
+template<typename T>
+size_t SpscRingBuffer<T>::getCapacity() const
+{
+    return buffer.size();
+}
+
+template<typename T>
+void SpscRingBuffer<T>::clear()
+{
+    readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+template<typename T>
+size_t SpscRingBuffer<T>::roundUpToPowerOfTwo(size_t value)
+{
+    size_t result{1};
+
+    while(result < value)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
@@ -1,75 +1,292 @@
 /*
- * Copyright (C) 2024, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
 
 #include "Stats.hpp"
+#include <algorithm>
 
-std::unique_ptr<std::map<std::string,Stats>> StatsManager::statsPerName{std::make_unique<std::map<std::string,Stats>>()};
-std::mutex StatsManager::queueMutex{};
+std::map<std::string, StageMetricsHandle> Metrics::stagesPerName{};
+std::mutex Metrics::registryMutex{};
 
-void Stats::update()
+namespace
 {
-    const auto timeNow = steady_clock::now();
-    queue.push_back(timeNow);
 
-    while(!queue.empty())
+// counters have a single writer, so a plain load and store replaces a locked increment
+void addByOwner(std::atomic<uint64_t> &counter, const uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void incrementByOwner(std::atomic<uint64_t> &counter)
+{
+    addByOwner(counter, 1);
+}
+
+}
+
+void LatencyHistogram::record(microseconds value)
+{
+    incrementByOwner(buckets[getBucketIndex(std::max<int64_t>(value.count(), 0))]);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::getSnapshot() const
+{
+    Snapshot snapshot{};
+
+    for(uint32_t i=0; i<numberOfBuckets; ++i)
     {
-        if((timeNow - queue.front()) > maxNumberOfMilliSecondsKeptInStats)
+        snapshot[i] = buckets[i].load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+LatencySummary LatencyHistogram::summarize(const Snapshot &current, const Snapshot &previous)
+{
+    LatencySummary summary{};
+
+    for(uint32_t i=0; i<numberOfBuckets; ++i)
+    {
+        summary.count += current[i] - previous[i];
+    }
+
+    if(summary.count == 0)
+    {
+        return summary;
+    }
+
+    const uint64_t rankOfMedian = (summary.count + 1) / 2;
+    const uint64_t rankOf99thPercentile = std::max<uint64_t>(1, (summary.count * 99 + 99) / 100);
+    uint64_t numberOfValues{0};
+
+    for(uint32_t i=0; i<numberOfBuckets; ++i)
+    {
+        const auto numberOfValuesInBucket = current[i] - previous[i];
+
+        if(numberOfValuesInBucket == 0)
         {
-            queue.pop_front();
+            continue;
         }
-        else
+
+        const auto previousNumberOfValues = numberOfValues;
+        numberOfValues += numberOfValuesInBucket;
+
+        const microseconds upperBound(getBucketUpperBound(i));
+
+        if((previousNumberOfValues < rankOfMedian) && (numberOfValues >= rankOfMedian))
         {
-            break;
+            summary.p50 = upperBound;
         }
+        if((previousNumberOfValues < rankOf99thPercentile) && (numberOfValues >= rankOf99thPercentile))
+        {
+            summary.p99 = upperBound;
+        }
+        summary.max = upperBound;
     }
+
+    return summary;
 }
 
-uint32_t Stats::getNumberOfCallsInLast(std::chrono::microseconds numberOfMiliSeconds)
+uint32_t LatencyHistogram::getBucketIndex(uint64_t value)
 {
-    uint32_t i{0};
+    if(value < numberOfSubBuckets)
+    {
+        return value;
+    }
 
+    uint32_t exponent{numberOfSubBucketBits};
 
-    for(auto el = queue.rbegin(); el != queue.rend(); ++el)
+    while((exponent < 63) && (value >> (exponent + 1)))
     {
-        if(duration_cast<milliseconds>(*queue.rbegin() - *el ) < numberOfMiliSeconds)
-        {
-            ++i;
-        }
-        else
+        ++exponent;
+    }
+
+    if(exponent > maxExponent)
+    {
+        return numberOfBuckets - 1;
+    }
+
+    const uint32_t shift = exponent - numberOfSubBucketBits;
+    return (exponent - numberOfSubBucketBits + 1) * numberOfSubBuckets + ((value >> shift) & (numberOfSubBuckets - 1));
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(uint32_t index)
+{
+    const uint32_t group = index / numberOfSubBuckets;
+    const uint64_t subBucket = index % numberOfSubBuckets;
+
+    if(group == 0)
+    {
+        return subBucket;
+    }
+
+    const uint32_t shift = group - 1;
+    return ((numberOfSubBuckets + subBucket + 1) << shift) - 1;
+}
+
+void RateCounter::increment(time_point<steady_clock> now)
+{
+    const auto slot = getSlot(now);
+    auto &bucket = buckets[slot % numberOfBuckets];
+    const auto value = bucket.load(std::memory_order_relaxed);
+
+    if((value >> numberOfCounterBits) == slot)
+    {
+        bucket.store(value + 1, std::memory_order_relaxed);
+    }
+    else
+    {
+        bucket.store((slot << numberOfCounterBits) | 1, std::memory_order_relaxed);
+    }
+}
+
+uint32_t RateCounter::getNumberOfEventsInLast(microseconds duration, time_point<steady_clock> now) const
+{
+    const auto currentSlot = getSlot(now);
+    const uint64_t numberOfSlots = std::min<uint64_t>((duration + bucketDuration - 1us) / bucketDuration, numberOfBuckets);
+    uint32_t numberOfEvents{0};
+
+    for(uint64_t i=0; (i < numberOfSlots) && (i <= currentSlot); ++i)
+    {
+        const auto slot = currentSlot - i;
+        const auto value = buckets[slot % numberOfBuckets].load(std::memory_order_relaxed);
+
+        if((value >> numberOfCounterBits) == slot)
         {
-            break;
+            numberOfEvents += value & ((1u << numberOfCounterBits) - 1);
         }
     }
 
-    return i;
+    return numberOfEvents;
+}
+
+uint64_t RateCounter::getSlot(time_point<steady_clock> timePoint)
+{
+    return duration_cast<milliseconds>(timePoint.time_since_epoch()) / bucketDuration;
+}
+
+StageMetrics::ProcessingScope::ProcessingScope(StageMetrics &stageMetrics):
+    stageMetrics(stageMetrics),
+    startTime(steady_clock::now()),
+    traceScope(stageMetrics.name)
+{
+    stageMetrics.recordArrival(startTime);
+}
+
+StageMetrics::ProcessingScope::~ProcessingScope()
+{
+    stageMetrics.addProcessingTime(duration_cast<microseconds>(steady_clock::now() - startTime));
+}
+
+StageMetrics::StageMetrics(const std::string &name):
+    name(name)
+{
+}
+
+void StageMetrics::update()
+{
+    recordArrival(steady_clock::now());
+}
+
+StageMetrics::ProcessingScope StageMetrics::startProcessing()
+{
+    return ProcessingScope(*this);
+}
+
+void StageMetrics::recordLatency(time_point<steady_clock> captureTime)
+{
+    if(captureTime != time_point<steady_clock>{})
+    {
+        latencies.record(duration_cast<microseconds>(steady_clock::now() - captureTime));
+    }
+}
+
+void StageMetrics::recordProcessingTime(microseconds duration)
+{
+    addProcessingTime(duration);
+}
+
+uint64_t StageMetrics::getNumberOfCalls() const
+{
+    return numberOfCalls.load(std::memory_order_relaxed);
+}
+
+microseconds StageMetrics::getTotalProcessingTime() const
+{
+    return microseconds(totalProcessingTimeInMicroseconds.load(std::memory_order_relaxed));
 }
 
+uint32_t StageMetrics::getNumberOfCallsInLast(microseconds duration) const
+{
+    return rateCounter.getNumberOfEventsInLast(duration, steady_clock::now());
+}
 
-StatsManager::StatsManager(const std::string &name): name(name)
+LatencyHistogram::Snapshot StageMetrics::getInterArrivalTimes() const
 {
-    std::lock_guard<std::mutex> lg(queueMutex);
-    statsPerName->insert(std::make_pair(name,Stats{}));
+    return interArrivalTimes.getSnapshot();
 }
 
-void StatsManager::update()
+LatencyHistogram::Snapshot StageMetrics::getProcessingTimes() const
 {
-    std::lock_guard<std::mutex> lg(queueMutex);
-    statsPerName->at(name).update();
+    return processingTimes.getSnapshot();
+}
+
+LatencyHistogram::Snapshot StageMetrics::getLatencies() const
+{
+    return latencies.getSnapshot();
+}
+
+void StageMetrics::recordArrival(time_point<steady_clock> now)
+{
+    if(lastArrivalTime != time_point<steady_clock>{})
+    {
+        interArrivalTimes.record(duration_cast<microseconds>(now - lastArrivalTime));
+    }
+
+    lastArrivalTime = now;
+    rateCounter.increment(now);
+    incrementByOwner(numberOfCalls);
 }
 
-void StatsManager::clear()
+void StageMetrics::addProcessingTime(microseconds duration)
 {
-    std::lock_guard<std::mutex> lg(queueMutex);
-    statsPerName->clear();
+    processingTimes.record(duration);
+    addByOwner(totalProcessingTimeInMicroseconds, std::max<int64_t>(duration.count(), 0));
 }
 
-Stats StatsManager::getStatsFor(const std::string &name)
+StageMetricsHandle Metrics::registerStage(const std::string &name)
 {
-    std::lock_guard<std::mutex> lg(queueMutex);
-    return statsPerName->at(name);
+    std::lock_guard<std::mutex> lg(registryMutex);
+
+    auto &stageMetrics = stagesPerName[name];
+
+    if(!stageMetrics)
+    {
+        stageMetrics = std::make_shared<StageMetrics>(name);
+    }
+
+    return stageMetrics;
 }
 
+std::vector<std::pair<std::string, StageMetricsHandle>> Metrics::getStagesStartingWith(const std::string &prefix)
+{
+    std::lock_guard<std::mutex> lg(registryMutex);
+
+    std::vector<std::pair<std::string, StageMetricsHandle>> stages;
 
+    for(auto it = stagesPerName.lower_bound(prefix); (it != stagesPerName.end()) && (it->first.compare(0, prefix.size(), prefix) == 0); ++it)
+    {
+        stages.emplace_back(*it);
+    }
+
+    return stages;
+}
+
+// handles which are still held stay valid
+void Metrics::clear()
+{
+    std::lock_guard<std::mutex> lg(registryMutex);
+    stagesPerName.clear();
+}
@@ -1,46 +1,148 @@
 /*
- * Copyright (C) 2024, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
 
 #pragma once
 
-#include <deque>
-#include <mutex>
+#include "Tracer.hpp"
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
 
 using namespace std::chrono;
 using namespace std::chrono_literals;
 
-class Stats
+struct LatencySummary
+{
+    microseconds p50{};
+    microseconds p99{};
+    microseconds max{};
+    uint64_t count{0};
+};
+
+// Log-linear histogram of durations in microseconds: every power of two is split into
+// 16 linear buckets, so a value is known within 1/16 of itself from 1 us up to about
+// two minutes. Percentiles are reported as the upper bound of their bucket.
+// record() may be called from one thread only and never blocks, any thread may read.
+class LatencyHistogram
 {
 public:
+    static constexpr uint32_t numberOfSubBucketBits{4};
+    static constexpr uint32_t numberOfSubBuckets{1u << numberOfSubBucketBits};
+    static constexpr uint32_t maxExponent{27};
+    static constexpr uint32_t numberOfBuckets{(maxExponent - numberOfSubBucketBits + 2) * numberOfSubBuckets};
 
-    void update();
+    using Snapshot = std::array<uint64_t, numberOfBuckets>;
+
+    void record(microseconds value);
+    Snapshot getSnapshot() const;
 
-    uint32_t getNumberOfCallsInLast(std::chrono::microseconds numberOfMiliSeconds);
+    // summary of values recorded between two snapshots
+    static LatencySummary summarize(const Snapshot &current, const Snapshot &previous=Snapshot{});
+    static uint32_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketUpperBound(uint32_t index);
 
 private:
-    static constexpr auto maxNumberOfMilliSecondsKeptInStats{3000ms};
-    std::deque<time_point<steady_clock>> queue;
+    std::array<std::atomic<uint64_t>, numberOfBuckets> buckets{};
 };
 
-class StatsManager
+// Number of events in the recent past counted in fixed 10 ms buckets. Each bucket packs
+// the number of its time slot with its counter into one word, so a bucket reused for
+// a newer slot is recognized without locks. Single writer, any number of readers.
+class RateCounter
 {
 public:
-    StatsManager(const std::string &name);
+    static constexpr milliseconds bucketDuration{10};
+    static constexpr uint32_t numberOfBuckets{512};
+
+    void increment(time_point<steady_clock> now);
+    uint32_t getNumberOfEventsInLast(microseconds duration, time_point<steady_clock> now) const;
+
+private:
+    static constexpr uint32_t numberOfCounterBits{24};
+    static uint64_t getSlot(time_point<steady_clock> timePoint);
+
+    std::array<std::atomic<uint64_t>, numberOfBuckets> buckets{};
+};
+
+// Metrics of one pipeline stage: its rate, the time between consecutive items, the
+// time spent on each of them and the age of the audio they carry when they leave it.
+// Written only by the thread running the stage. Every stage lives on its own cache
+// lines, so stages never share a line with each other. While the tracer is enabled
+// every processed item is also a slice of the timeline.
+class alignas(64) StageMetrics
+{
+public:
+    class ProcessingScope
+    {
+    public:
+        ProcessingScope(StageMetrics &stageMetrics);
+        ProcessingScope(const ProcessingScope &) = delete;
+        ProcessingScope& operator=(const ProcessingScope &) = delete;
+        ~ProcessingScope();
+
+    private:
+        StageMetrics &stageMetrics;
+        const time_point<steady_clock> startTime;
+        const TraceScope traceScope;
+    };
+
+    StageMetrics(const std::string &name);
+
+    // marks the arrival of an item
     void update();
-    static void clear();
-    static Stats getStatsFor(const std::string &name);
+    // marks the arrival of an item and measures its processing until the scope ends
+    ProcessingScope startProcessing();
+    // records the time from the capture of the audio an item is based on until now,
+    // items without a capture time are skipped
+    void recordLatency(time_point<steady_clock> captureTime);
+    // records processing which was measured elsewhere, e.g. on the GPU, without counting an item
+    void recordProcessingTime(microseconds duration);
+
+    uint64_t getNumberOfCalls() const;
+    // sum of all recorded processing times, a difference of two readings divided by the
+    // time between them is the part of that time the stage was busy
+    microseconds getTotalProcessingTime() const;
+    uint32_t getNumberOfCallsInLast(microseconds duration) const;
+    LatencyHistogram::Snapshot getInterArrivalTimes() const;
+    LatencyHistogram::Snapshot getProcessingTimes() const;
+    LatencyHistogram::Snapshot getLatencies() const;
 
 private:
-    static std::unique_ptr<std::map<std::string,Stats>> statsPerName;
-    static std::mutex queueMutex;
+    void recordArrival(time_point<steady_clock> now);
+    void addProcessingTime(microseconds duration);
+
     const std::string name;
+    RateCounter rateCounter;
+    LatencyHistogram interArrivalTimes;
+    LatencyHistogram processingTimes;
+    LatencyHistogram latencies;
+    std::atomic<uint64_t> numberOfCalls{0};
+    std::atomic<uint64_t> totalProcessingTimeInMicroseconds{0};
+    time_point<steady_clock> lastArrivalTime{};
 };
 
+using StageMetricsHandle = std::shared_ptr<StageMetrics>;
 
+// Registry of stage metrics. A stage registers once, before its loop, and keeps the
+// returned handle; the lock is taken only while registering. Registering a name again
+// returns the same metrics.
+class Metrics
+{
+public:
+    static StageMetricsHandle registerStage(const std::string &name);
+    static std::vector<std::pair<std::string, StageMetricsHandle>> getStagesStartingWith(const std::string &prefix);
+    static void clear();
+
+private:
+    static std::map<std::string, StageMetricsHandle> stagesPerName;
+    static std::mutex registryMutex;
+};
@@ -13,6 +13,7 @@
 #include "FrequenciesInfo.hpp"
 #include "FftBinCombiner.hpp"
 #include <optional>
+#include <memory>
 
 
 StereoRmsMeter::StereoRmsMeter(const Configuration &configuration, std::promise<AppEvent> &&appEvent):
@@ -32,7 +33,8 @@ void StereoRmsMeter::init()
 void StereoRmsMeter::fftCalculator()
 {
     const std::string processName{"fftCalculator"};
-    StatsManager statsManager(processName);
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::FftCalculator, processName);
 
     float overlapping = calculateOverlapping(config.get<SamplingRate>(), config.get<NumberOfSamples>(), config.get<DesiredFrameRate>());
 
@@ -42,9 +44,7 @@ void StereoRmsMeter::fftCalculator()
     while(shouldProceed)
     {
         const auto &dataInTimeDomain  = dataExchanger.get();
-        const auto &newOverlapping = flowControlDataExchanger.getWithoutBlocking();
-
-        if(newOverlapping != std::nullopt)
+        if(const auto *newOverlapping = overlappingMailbox.getNewValue())
         {
             overlapping = *newOverlapping;
         }
@@ -54,20 +54,23 @@ void StereoRmsMeter::fftCalculator()
             continue;
         }
 
-        statsManager.update();
+        const auto processingScope = stageMetrics->startProcessing();
 
         fftLeft.updateOverlapping(overlapping);
         fftRight.updateOverlapping(overlapping);
-        fftLeft.updateBuffer(std::any_cast<StereoData>(*dataInTimeDomain).left);
-        fftRight.updateBuffer(std::any_cast<StereoData>(*dataInTimeDomain).right);
+        const auto &stereoData = std::any_cast<const StereoData&>(*dataInTimeDomain);
+        fftLeft.updateBuffer(stereoData.left, stereoData.captureTime);
+        fftRight.updateBuffer(stereoData.right, stereoData.captureTime);
 
 
         auto fftResultLeft = fftLeft.calculate();
         auto fftResultRight = fftRight.calculate();
+        const auto &captureTimes = fftLeft.getCaptureTimes();
 
         for(uint32_t i=0; i<std::min(fftResultLeft.size(), fftResultRight.size()); ++i)
         {
-            fftDataExchanger.push_back(std::make_unique<std::any>(StereoFftData{std::move(fftResultLeft.at(i)), std::move(fftResultRight.at(i))}));
+            stageMetrics->recordLatency(captureTimes.at(i));
+            fftDataExchanger.push_back(std::make_unique<std::any>(Timestamped<StereoFftData>{StereoFftData{std::move(fftResultLeft.at(i)), std::move(fftResultRight.at(i))}, captureTimes.at(i)}));
         }
 
     }
@@ -78,19 +81,22 @@ void StereoRmsMeter::fftCalculator()
 void StereoRmsMeter::processing()
 {
     const std::string processName{"processing"};
-    StatsManager statsManager(processName);
+    const auto stageMetrics = Metrics::registerStage(processName);
+    applyThreadPolicy(PipelineStage::Processing, processName);
 
     FrequenciesInfo frequenciesInfo(config.get<SamplingRate>(), config.get<NumberOfSamples>(), config.get<Freqs>());
 
-    DataMaxHolder dataMaxHolderLeft(1, config.get<NumberOfSignalsForMaxHold>(), getFloorDbFs16bit());
+    float currentFloorDbFs = floorDbFs.load();
+
+    auto dataMaxHolderLeft = std::make_unique<DataMaxHolder>(1, config.get<NumberOfSignalsForMaxHold>(), currentFloorDbFs);
     DataAverager dataAveragerLeft(1, config.get<NumberOfSignalsForAveraging>());
     DataSmoother dataSmootherLeft(1, config.get<AlphaFactor>());
-    FftBinCombiner fftBinCombinerLeft(config.get<ScalingFactor>(), config.get<OffsetFactor>(), frequenciesInfo.getAllFrequencyIndexes());
+    FftBinCombiner fftBinCombinerLeft(config.get<ScalingFactor>(), config.get<OffsetFactor>(), currentFloorDbFs, frequenciesInfo.getAllFrequencyIndexes());
 
-    DataMaxHolder dataMaxHolderRight(1, config.get<NumberOfSignalsForMaxHold>(), getFloorDbFs16bit());
+    auto dataMaxHolderRight = std::make_unique<DataMaxHolder>(1, config.get<NumberOfSignalsForMaxHold>(), currentFloorDbFs);
     DataAverager dataAveragerRight(1, config.get<NumberOfSignalsForAveraging>());
     DataSmoother dataSmootherRight(1, config.get<AlphaFactor>());
-    FftBinCombiner fftBinCombinerRight(config.get<ScalingFactor>(), config.get<OffsetFactor>(), frequenciesInfo.getAllFrequencyIndexes());
+    FftBinCombiner fftBinCombinerRight(config.get<ScalingFactor>(), config.get<OffsetFactor>(), currentFloorDbFs, frequenciesInfo.getAllFrequencyIndexes());
 
 
     while(shouldProceed)
@@ -102,14 +108,24 @@ void StereoRmsMeter::processing()
             continue;
         }
 
-        statsManager.update();
+        const auto processingScope = stageMetrics->startProcessing();
+        const auto &timestampedFftData = std::any_cast<const Timestamped<StereoFftData>&>(*fftResult);
 
+        // the held maximum starts from the floor, so it is started again when the source changes it
+        if(const float demandedFloorDbFs = floorDbFs.load(); demandedFloorDbFs != currentFloorDbFs)
+        {
+            currentFloorDbFs = demandedFloorDbFs;
+            dataMaxHolderLeft = std::make_unique<DataMaxHolder>(1, config.get<NumberOfSignalsForMaxHold>(), currentFloorDbFs);
+            dataMaxHolderRight = std::make_unique<DataMaxHolder>(1, config.get<NumberOfSignalsForMaxHold>(), currentFloorDbFs);
+            fftBinCombinerLeft.updateFloorDbFs(currentFloorDbFs);
+            fftBinCombinerRight.updateFloorDbFs(currentFloorDbFs);
+        }
 
-        dataMaxHolderLeft.push_back({fftBinCombinerLeft.combineRmsValues(std::any_cast<StereoFftData>(*fftResult).left)});
-        dataMaxHolderRight.push_back({fftBinCombinerRight.combineRmsValues(std::any_cast<StereoFftData>(*fftResult).right)});
+        dataMaxHolderLeft->push_back({fftBinCombinerLeft.combineRmsValues(timestampedFftData.value.left)});
+        dataMaxHolderRight->push_back({fftBinCombinerRight.combineRmsValues(timestampedFftData.value.right)});
 
-        auto dataWithMaxValueLeft = dataMaxHolderLeft.calculate();
-        auto dataWithMaxValueRight = dataMaxHolderRight.calculate();
+        auto dataWithMaxValueLeft = dataMaxHolderLeft->calculate();
+        auto dataWithMaxValueRight = dataMaxHolderRight->calculate();
 
         if(!dataWithMaxValueLeft.empty() && !dataWithMaxValueRight.empty())
         {
@@ -127,12 +143,13 @@ void StereoRmsMeter::processing()
                 auto smoothedDataRight = dataSmootherRight.calculate();
 
 
-                processedDataExchanger.push_back(std::make_unique<std::any>(Data{getAverage(smoothedDataLeft), getAverage(smoothedDataRight)}));
+                stageMetrics->recordLatency(timestampedFftData.captureTime);
+                processedDataMailbox.publish(Timestamped<Data>{Data{getAverage(smoothedDataLeft), getAverage(smoothedDataRight)}, timestampedFftData.captureTime});
             }
         }
     }
 
-    processedDataExchanger.stop();
+    processedDataMailbox.stop();
 }
 
 StereoRmsMeter::~StereoRmsMeter()
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "ThreadPolicy.hpp"
+#include <iostream>
+
+ThreadPolicy::ThreadPolicy(const ThreadSettingsPerStage &settingsPerStage, const PipelineStage stage)
+{
+    const auto it = settingsPerStage.find(static_cast<uint32_t>(stage));
+
+    if(it == settingsPerStage.end())
+    {
+        return;
+    }
+
+    const auto &row = it->second;
+
+    if(row.size() > 0)
+    {
+        const auto policy = static_cast<uint16_t>(row.at(0));
+
+        if(policy <= static_cast<uint16_t>(SchedulingPolicy::RoundRobin))
+        {
+            settings.policy = static_cast<SchedulingPolicy>(policy);
+        }
+    }
+
+    if(row.size() > 1)
+    {
+        settings.priority = static_cast<int32_t>(row.at(1));
+    }
+
+    for(uint32_t i=2; i<row.size(); ++i)
+    {
+        if(row.at(i) >= 0)
+        {
+            settings.cpus.push_back(static_cast<uint32_t>(row.at(i)));
+        }
+    }
+}
+
+bool ThreadPolicy::applyToCurrentThread(const std::string &threadName)
+{
+    bool result{true};
+
+    if(settings.policy != SchedulingPolicy::Default)
+    {
+        if(!setScheduling())
+        {
+            std::cout<<"WARNING: realtime scheduling not permitted for: "<<threadName<<", keeping default scheduling"<<std::endl;
+            result = false;
+        }
+    }
+
+    if(!settings.cpus.empty())
+    {
+        if(!setAffinity())
+        {
+            std::cout<<"WARNING: cpu affinity could not be set for: "<<threadName<<", thread can run on any cpu"<<std::endl;
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+const ThreadSettings& ThreadPolicy::getSettings() const
+{
+    return settings;
+}
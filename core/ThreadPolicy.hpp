@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "CommonTypes.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+enum class PipelineStage : uint32_t
+{
+    SamplesUpdater = 0,
+    FftCalculator = 1,
+    Processing = 2,
+    Drafter = 3,
+    FlowController = 4
+};
+
+enum class SchedulingPolicy : uint16_t
+{
+    Default = 0,
+    Fifo = 1,
+    RoundRobin = 2
+};
+
+struct ThreadSettings
+{
+    SchedulingPolicy policy{SchedulingPolicy::Default};
+    int32_t priority{0};
+    std::vector<uint32_t> cpus;
+};
+
+class ThreadPolicy
+{
+public:
+    ThreadPolicy(const ThreadSettingsPerStage &settingsPerStage, const PipelineStage stage);
+
+    // Applies the settings to the calling thread. Every step which is not permitted
+    // is reported and skipped, so the thread always keeps running.
+    bool applyToCurrentThread(const std::string &threadName);
+    const ThreadSettings& getSettings() const;
+
+    static bool lockMemory();
+
+private:
+    bool setScheduling();
+    bool setAffinity();
+
+    ThreadSettings settings;
+};
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "ThreadPolicy.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+
+bool ThreadPolicy::setScheduling()
+{
+    const int policy = (settings.policy == SchedulingPolicy::Fifo) ? SCHED_FIFO : SCHED_RR;
+
+    sched_param param{};
+    param.sched_priority = std::clamp(settings.priority, sched_get_priority_min(policy), sched_get_priority_max(policy));
+
+    return pthread_setschedparam(pthread_self(), policy, &param) == 0;
+}
+
+bool ThreadPolicy::setAffinity()
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    for(const auto &cpu : settings.cpus)
+    {
+        if(cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+}
+
+bool ThreadPolicy::lockMemory()
+{
+    if(mlockall(MCL_CURRENT) != 0)
+    {
+        std::cout<<"WARNING: memory could not be locked: "<<std::strerror(errno)<<std::endl;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "ThreadPolicy.hpp"
+#include <windows.h>
+#include <iostream>
+
+bool ThreadPolicy::setScheduling()
+{
+    const int priority = (settings.policy == SchedulingPolicy::Fifo) ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_HIGHEST;
+
+    return SetThreadPriority(GetCurrentThread(), priority) != 0;
+}
+
+bool ThreadPolicy::setAffinity()
+{
+    DWORD_PTR mask{0};
+
+    for(const auto &cpu : settings.cpus)
+    {
+        if(cpu < sizeof(DWORD_PTR) * 8)
+        {
+            mask |= (static_cast<DWORD_PTR>(1) << cpu);
+        }
+    }
+
+    return (mask != 0) && (SetThreadAffinityMask(GetCurrentThread(), mask) != 0);
+}
+
+bool ThreadPolicy::lockMemory()
+{
+    std::cout<<"WARNING: memory locking is not supported on this platform"<<std::endl;
+    return false;
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "Tracer.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+std::atomic<bool> Tracer::enabled{false};
+std::vector<std::shared_ptr<TraceBuffer>> Tracer::buffers{};
+uint32_t Tracer::nextThreadId{1};
+std::mutex Tracer::registryMutex{};
+
+namespace
+{
+
+// marks the buffer when its thread exits, so it can be forgotten after the next clear
+struct BufferOfThread
+{
+    ~BufferOfThread()
+    {
+        if(buffer)
+        {
+            buffer->threadExited.store(true);
+        }
+    }
+
+    std::shared_ptr<TraceBuffer> buffer;
+};
+
+thread_local BufferOfThread bufferOfThread;
+
+void writeEscaped(std::ostream &os, std::string_view text)
+{
+    for(const char character : text)
+    {
+        if((character == '"') || (character == '\\'))
+        {
+            os<<'\\'<<character;
+        }
+        else if(static_cast<unsigned char>(character) < 0x20)
+        {
+            os<<' ';
+        }
+        else
+        {
+            os<<character;
+        }
+    }
+}
+
+}
+
+TraceBuffer::TraceBuffer(uint32_t threadId):
+    threadId(threadId),
+    slots(std::make_unique<Slot[]>(capacity))
+{
+}
+
+void TraceBuffer::add(char type, std::string_view name, double value)
+{
+    const auto index = numberOfEvents.load(std::memory_order_relaxed);
+    auto &slot = slots[index % capacity];
+    auto &event = slot.event;
+
+    // the event is written only after a reader can see that the slot is being written
+    slot.sequence.store(getSequenceOfWrittenEvent(index) - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    event.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    event.value = value;
+    event.type = type;
+
+    const auto nameLength = std::min<size_t>(name.size(), TraceEvent::maxNameLength);
+    std::copy_n(name.data(), nameLength, event.name.data());
+    event.name[nameLength] = '\0';
+
+    slot.sequence.store(getSequenceOfWrittenEvent(index), std::memory_order_release);
+    numberOfEvents.store(index + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> TraceBuffer::getEvents() const
+{
+    const auto numberOfWrittenEvents = numberOfEvents.load(std::memory_order_acquire);
+    const uint64_t firstIndex = std::max<uint64_t>((numberOfWrittenEvents > capacity) ? (numberOfWrittenEvents - capacity) : 0,
+                                                   numberOfClearedEvents.load(std::memory_order_relaxed));
+
+    std::vector<TraceEvent> copiedEvents;
+    copiedEvents.reserve(numberOfWrittenEvents - firstIndex);
+
+    for(uint64_t i=firstIndex; i<numberOfWrittenEvents; ++i)
+    {
+        const auto &slot = slots[i % capacity];
+        const auto sequenceBeforeCopying = slot.sequence.load(std::memory_order_acquire);
+
+        if(sequenceBeforeCopying != getSequenceOfWrittenEvent(i))
+        {
+            continue;
+        }
+
+        const TraceEvent event = slot.event;
+
+        // the copy is completed before the sequence number is read again
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if(slot.sequence.load(std::memory_order_relaxed) == sequenceBeforeCopying)
+        {
+            copiedEvents.push_back(event);
+        }
+    }
+
+    return copiedEvents;
+}
+
+// the counter of events belongs to the writer, so older events are only hidden
+void TraceBuffer::clear()
+{
+    numberOfClearedEvents.store(numberOfEvents.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+void Tracer::setEnabled(bool isEnabled)
+{
+    enabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+void Tracer::setCurrentThreadName(const std::string &name)
+{
+    if(!isEnabled())
+    {
+        return;
+    }
+
+    auto &buffer = getBufferOfCurrentThread();
+
+    std::lock_guard<std::mutex> lg(registryMutex);
+    buffer.threadName = name;
+}
+
+void Tracer::begin(std::string_view name)
+{
+    add('B', name, 0);
+}
+
+void Tracer::end(std::string_view name)
+{
+    add('E', name, 0);
+}
+
+void Tracer::counter(std::string_view name, double value)
+{
+    add('C', name, value);
+}
+
+void Tracer::clear()
+{
+    std::lock_guard<std::mutex> lg(registryMutex);
+
+    buffers.erase(std::remove_if(buffers.begin(), buffers.end(), [](const auto &buffer){
+        return buffer->threadExited.load();
+    }), buffers.end());
+
+    // a thread which is still running keeps writing to its buffer, so only its events go
+    for(auto &buffer : buffers)
+    {
+        buffer->clear();
+    }
+}
+
+std::string Tracer::getChromeTrace()
+{
+    std::ostringstream os;
+    os<<std::fixed<<std::setprecision(3);
+    os<<"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool isFirstEvent{true};
+    auto separate = [&]()
+    {
+        os<<(isFirstEvent ? "\n" : ",\n");
+        isFirstEvent = false;
+    };
+
+    std::lock_guard<std::mutex> lg(registryMutex);
+
+    for(const auto &buffer : buffers)
+    {
+        if(!buffer->threadName.empty())
+        {
+            separate();
+            os<<"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"<<buffer->threadId<<",\"args\":{\"name\":\"";
+            writeEscaped(os, buffer->threadName);
+            os<<"\"}}";
+        }
+
+        for(const auto &event : buffer->getEvents())
+        {
+            separate();
+            os<<"{\"name\":\"";
+            writeEscaped(os, event.name.data());
+            os<<"\",\"ph\":\""<<event.type<<"\",\"ts\":"<<event.timestamp / 1000.0<<",\"pid\":1,\"tid\":"<<buffer->threadId;
+
+            if(event.type == 'C')
+            {
+                os<<",\"args\":{\"value\":"<<event.value<<"}";
+            }
+            os<<"}";
+        }
+    }
+
+    os<<"\n]}\n";
+    return os.str();
+}
+
+bool Tracer::saveChromeTrace(const std::string &path)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if(!file)
+    {
+        return false;
+    }
+
+    file<<getChromeTrace();
+    return static_cast<bool>(file);
+}
+
+void Tracer::add(char type, std::string_view name, double value)
+{
+    if(!isEnabled())
+    {
+        return;
+    }
+
+    getBufferOfCurrentThread().add(type, name, value);
+}
+
+TraceBuffer& Tracer::getBufferOfCurrentThread()
+{
+    if(!bufferOfThread.buffer)
+    {
+        std::lock_guard<std::mutex> lg(registryMutex);
+        bufferOfThread.buffer = std::make_shared<TraceBuffer>(nextThreadId++);
+        buffers.push_back(bufferOfThread.buffer);
+    }
+
+    return *bufferOfThread.buffer;
+}
+
+TraceScope::TraceScope(std::string_view name):
+    name(name),
+    active(Tracer::isEnabled())
+{
+    if(active)
+    {
+        Tracer::begin(name);
+    }
+}
+
+TraceScope::~TraceScope()
+{
+    if(active)
+    {
+        Tracer::end(name);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+struct TraceEvent
+{
+    static constexpr uint32_t maxNameLength{46};
+
+    int64_t timestamp{0};
+    double value{0};
+    char type{0};
+    std::array<char, maxNameLength + 1> name{};
+};
+
+// Events of one thread kept in a fixed ring, so the oldest ones are overwritten once it is
+// full. Only the owning thread writes. Each slot holds a sequence number, which is made odd
+// before its event is written and even with the index of the event after that. A reader
+// checks it on both sides of copying an event and drops the event when it has changed.
+class TraceBuffer
+{
+public:
+    static constexpr uint32_t capacity{1u << 16};
+
+    TraceBuffer(uint32_t threadId);
+    void add(char type, std::string_view name, double value);
+    std::vector<TraceEvent> getEvents() const;
+    void clear();
+
+    const uint32_t threadId;
+    std::string threadName;
+    std::atomic<bool> threadExited{false};
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence{0};
+        TraceEvent event;
+    };
+
+    static uint64_t getSequenceOfWrittenEvent(uint64_t index)
+    {
+        return 2 * (index + 1);
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<uint64_t> numberOfEvents{0};
+    std::atomic<uint64_t> numberOfClearedEvents{0};
+};
+
+// Timeline of the pipeline written as Chrome trace-event JSON, which can be opened in
+// Perfetto or chrome://tracing. While disabled every call returns after checking one flag.
+class Tracer
+{
+public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled()
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    static void setCurrentThreadName(const std::string &name);
+    static void begin(std::string_view name);
+    static void end(std::string_view name);
+    static void counter(std::string_view name, double value);
+
+    // forgets all recorded events and the buffers of threads which have exited
+    static void clear();
+    static std::string getChromeTrace();
+    static bool saveChromeTrace(const std::string &path);
+
+private:
+    static void add(char type, std::string_view name, double value);
+    static TraceBuffer& getBufferOfCurrentThread();
+
+    static std::atomic<bool> enabled;
+    static std::vector<std::shared_ptr<TraceBuffer>> buffers;
+    static uint32_t nextThreadId;
+    static std::mutex registryMutex;
+};
+
+class TraceScope
+{
+public:
+    TraceScope(std::string_view name);
+    TraceScope(const TraceScope &) = delete;
+    TraceScope& operator=(const TraceScope &) = delete;
+    ~TraceScope();
+
+private:
+    const std::string_view name;
+    const bool active;
+};
@@ -8,11 +8,21 @@
 #include "FrequenciesInfo.hpp"
 #include "Helpers.hpp"
 #include "RectangleHighligther.hpp"
-#include "DynamicMaxHolder.hpp"
+#include "Tracer.hpp"
 #include "gpu/FigureGeometryCalculator.hpp"
+#include <iostream>
+#include <set>
+
+namespace
+{
+
+const std::set<std::string> namesOfExpensiveOperations{"transparentDynamicMaxHold"};
+
+}
 
 Window::Window(const Configuration &config, const bool isFullScreenEnabled) :
-    WindowBase(config, isFullScreenEnabled)
+    WindowBase(config, isFullScreenEnabled),
+    frameBudgetWatchdog(duration_cast<microseconds>(duration<float, std::milli>(config.get<FrameTimingSettings>().budgetInMilliseconds)))
 {
 
     FigureGeometryCalculator::setHorizontalDrawingArea(config.get<HorizontalDrawingArea>().first,config.get<HorizontalDrawingArea>().second);
@@ -23,9 +33,6 @@ Window::Window(const Configuration &config, const bool isFullScreenEnabled) :
     anyData.add(FigureGeometryCalculator::getHorizontalLines(scaleDbfsToPercents(config.get<HorizontalLinePositions>(), config.get<VerticalDbfsRange>().second, config.get<VerticalDbfsRange>().first)));
     anyData.add(FigureGeometryCalculator::getVerticalLines(config.get<NumberOfRectangles>(), config.get<GapWidthInRelationToRectangleWidth>(), anyData.get<FrequenciesInfo>().getRectangleIndexesClosestToFrequencies(config.get<VerticalLinePositions>())));
     anyData.add(FigureGeometryCalculator::getVerticalLineTextPositions(config.get<NumberOfRectangles>(), config.get<GapWidthInRelationToRectangleWidth>(), anyData.get<FrequenciesInfo>().getRectangleIndexesClosestToFrequencies(config.get<FrequencyTextPositions>())));
-    anyData.add(DynamicMaxHolders{{MaxHolderType::Dynamic,DynamicMaxHolder(config.get<NumberOfRectangles>(), config.get<DynamicMaxHoldSpeedOfFalling>(), config.get<DynamicMaxHoldAccelerationStateOfFalling>())},
-                                  {MaxHolderType::Transparent,DynamicMaxHolder(config.get<NumberOfRectangles>(), config.get<DynamicMaxHoldSecondarySpeedOfFalling>(), false)}});
-
     anyData.add(RectangleHighligther(config.get<NumberOfRectangles>(), anyData.get<FrequenciesInfo>().getFrequencyRangeForEachRectangle()));
 
     createWindow();
@@ -38,15 +45,16 @@ void Window::initializeGPU()
     gpu.initLines();
     gpu.initText();
     gpu.initRectangles(config.get<BackgroundColorSettings>(), config.get<AdvancedColorSettings>());
+    gpu.initDbfs();
+    gpu.initStaticLayerCache();
+    gpu.prepareDbfs(config.get<NumberOfRectangles>(), config.get<VerticalDbfsRange>(), {{MaxHolderType::Dynamic, MaxHoldSettings{config.get<DynamicMaxHoldSpeedOfFalling>(), config.get<DynamicMaxHoldAccelerationStateOfFalling>()}},
+                                                                                       {MaxHolderType::Transparent, MaxHoldSettings{config.get<DynamicMaxHoldSecondarySpeedOfFalling>(), false}}});
     gpu.prepareBackground(FigureGeometryCalculator::rectanglesFactory(100, 1,100,0,0,100));
-    gpu.prepareRectangles(FigureGeometryCalculator::rectanglesFactory(100, config.get<NumberOfRectangles>(), 0, config.get<GapWidthInRelationToRectangleWidth>()), config.get<ColorsOfRectangle>());
+    gpu.prepareRectangles(FigureGeometryCalculator::rectanglesFactory(100, config.get<NumberOfRectangles>(), 0, config.get<GapWidthInRelationToRectangleWidth>()), config.get<ColorsOfRectangle>(),
+                          FigureGeometryCalculator::rectanglesFactory(config.get<DynamicMaxHoldRectangleHeightInPercentOfScreenSize>(), config.get<NumberOfRectangles>(), 50 + config.get<DynamicMaxHoldRectangleHeightInPercentOfScreenSize>()/2, config.get<GapWidthInRelationToRectangleWidth>()), config.get<ColorsOfDynamicMaxHoldRectangle>());
     gpu.prepareDynamicMaxHoldSecondaryRectangles(FigureGeometryCalculator::rectanglesFactory(100, config.get<NumberOfRectangles>(), 0, config.get<GapWidthInRelationToRectangleWidth>()), config.get<ColorsOfDynamicMaxHoldSecondaryRectangle>());
-    gpu.prepareDynamicMaxHoldRectangles(FigureGeometryCalculator::rectanglesFactory(config.get<DynamicMaxHoldRectangleHeightInPercentOfScreenSize>(), config.get<NumberOfRectangles>(), 50 + config.get<DynamicMaxHoldRectangleHeightInPercentOfScreenSize>()/2, config.get<GapWidthInRelationToRectangleWidth>()), config.get<ColorsOfDynamicMaxHoldRectangle>());
-    gpu.prepareHorizontalLines(config.get<HorizontalLinePositions>().size(), config.get<ColorOfStaticLines>());
-    gpu.prepareVerticalLines(config.get<VerticalLinePositions>().size(), config.get<ColorOfStaticLines>());
-    gpu.prepareDynamicLines(config.get<NumberOfRectangles>()-1, config.get<ColorOfLine>());
-    gpu.prepareDynamicMaxHoldLines(config.get<NumberOfRectangles>()-1, config.get<ColorOfDynamicMaxHoldLine>());
-    gpu.prepareDynamicMaxHoldSecondaryLines(config.get<NumberOfRectangles>()-1, config.get<ColorOfDynamicMaxHoldSecondaryLine>());
+    gpu.prepareStaticLines(config.get<HorizontalLinePositions>().size(), config.get<VerticalLinePositions>().size(), config.get<ColorOfStaticLines>());
+    gpu.prepareDynamicLines(config.get<NumberOfRectangles>()-1, config.get<ColorOfLine>(), config.get<ColorOfDynamicMaxHoldLine>(), config.get<ColorOfDynamicMaxHoldSecondaryLine>());
     gpu.prepareHighlightedVerticalLine(Color{1,0,0,0.5});
     gpu.prepareHorizontalLineStaticTexts(config.get<HorizontalLinePositions>(), config.get<ColorOfStaticText>());
     gpu.prepareVerticalLineStaticTexts(config.get<FrequencyTextPositions>(), config.get<ColorOfStaticText>());
@@ -55,8 +63,8 @@ void Window::initializeGPU()
 
     operations.emplace_back("prepareData", [&](){
 
-        anyData.get<DynamicMaxHolders>().at(MaxHolderType::Dynamic).calculate(anyData.get<std::vector<float>>());
-        anyData.get<DynamicMaxHolders>().at(MaxHolderType::Transparent).calculate(anyData.get<std::vector<float>>());
+        auto timeInMs = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - anyData.get<time_point<steady_clock>>()).count();
+        gpu.updateDbfs(anyData.get<std::vector<float>>(), timeInMs);
         anyData.add(getWindowSize());
     });
 
@@ -69,56 +77,41 @@ void Window::initializeGPU()
         gpu.updateTime(timeInMs);
     });
 
-    operations.emplace_back("background", [&](){
-        gpu.drawBackground();
-    });
+    // a background changing with time is drawn every frame, otherwise it is cached with grid lines and their labels
+    const bool backgroundCached = !gpu.isBackgroundTimeDependent();
 
-    operations.emplace_back("horizontalLines", [&](){
-        gpu.drawHorizontalLines(anyData.get<FigureGeometryCalculator::HorizontalLines>().lines);
-    });
+    if(!backgroundCached)
+    {
+        operations.emplace_back("background", [&](){
+            gpu.drawBackground();
+        });
+    }
 
-    operations.emplace_back("verticalLines", [&](){
-        gpu.drawVerticalLines(anyData.get<FigureGeometryCalculator::VerticalLines>().lines);
-    });
+    operations.emplace_back("staticLayers", [&, backgroundCached](){
 
-    operations.emplace_back("horizontalLineStaticTexts", [&](){
+        const auto windowSize = anyData.get<WindowSize>();
 
-        if(config.get<SingleScaleMode>())
+        if(windowSize.x == 0 || windowSize.y == 0)
         {
-            gpu.drawHorizontalLineStaticTexts(anyData.get<FigureGeometryCalculator::HorizontalLines>().lines, anyData.get<WindowSize>());
+            return;
         }
-        else
+
+        if(!gpu.isStaticLayerCacheValid(windowSize))
         {
-            gpu.drawHorizontalLineStaticTexts(anyData.get<FigureGeometryCalculator::HorizontalLines>().lines, anyData.get<WindowSize>(), FigureGeometryCalculator::xDrawOffsetInPercents, FigureGeometryCalculator::xDrawSizeInPercents);
+            gpu.startRenderingStaticLayers(windowSize);
+            drawStaticLayers(backgroundCached);
+            gpu.finishRenderingStaticLayers();
         }
 
+        gpu.drawStaticLayers();
     });
 
-    operations.emplace_back("verticalLineStaticTexts", [&](){
-        gpu.drawVerticalLineStaticTexts(anyData.get<FigureGeometryCalculator::VerticalLineTextPositions>().positions, anyData.get<WindowSize>());
-    });
-
+    // max hold lines are drawn with the lines of the spectrum in one multi-draw, so the
+    // expensive transparent ones are left out by the operation itself
     if(config.get<LinesVisibilityState>())
     {
         operations.emplace_back("dynamicLines", [&](){
-            auto positions = scaleDbfsToPercents(anyData.get<std::vector<float>>(), config.get<VerticalDbfsRange>().second, config.get<VerticalDbfsRange>().first);
-            gpu.drawDynamicLines(FigureGeometryCalculator::getDynamicLines(positions));
-        });
-    }
-
-    if(config.get<LinesVisibilityState>() && config.get<DynamicMaxHoldVisibilityState>())
-    {
-        operations.emplace_back("dynamicMaxHoldLines", [&](){
-            const auto dynamicMaxHoldElementsPosition = scaleDbfsToPercents(anyData.get<DynamicMaxHolders>().at(MaxHolderType::Dynamic).get(), config.get<VerticalDbfsRange>().second, config.get<VerticalDbfsRange>().first);
-            gpu.drawDynamicMaxHoldLines(FigureGeometryCalculator::getDynamicLines(dynamicMaxHoldElementsPosition));
-        });
-    }
-
-    if(config.get<LinesVisibilityState>() && config.get<DynamicMaxHoldSecondaryVisibilityState>())
-    {
-        operations.emplace_back("dynamicMaxHoldTransparentLines", [&](){
-            const auto dynamicMaxHoldElementsPosition = scaleDbfsToPercents(anyData.get<DynamicMaxHolders>().at(MaxHolderType::Transparent).get(), config.get<VerticalDbfsRange>().second, config.get<VerticalDbfsRange>().first);
-            gpu.drawDynamicMaxHoldSecondaryLines(FigureGeometryCalculator::getDynamicLines(dynamicMaxHoldElementsPosition));
+            gpu.drawDynamicLines(config.get<DynamicMaxHoldVisibilityState>(), config.get<DynamicMaxHoldSecondaryVisibilityState>() && !expensiveLayersSkipped);
         });
     }
 
@@ -137,9 +130,10 @@ void Window::initializeGPU()
             {
                 const auto dBFsHighlightedValues = rectangleHighligther.getStringToBePrinted(hightlightData.current.frequencyRange,
                                                                                              averagedDBfs.value() ,
-                                                                                             anyData.get<DynamicMaxHolders>().at(MaxHolderType::Transparent).get().at(hightlightData.current.index),
-                                                                                             anyData.get<DynamicMaxHolders>().at(MaxHolderType::Dynamic).get().at(hightlightData.current.index));
+                                                                                             gpu.getDynamicMaxHoldValue(MaxHolderType::Transparent, hightlightData.current.index),
+                                                                                             gpu.getDynamicMaxHoldValue(MaxHolderType::Dynamic, hightlightData.current.index));
                 gpu.drawText(dBFsHighlightedValues, (cursorPosition.x > windowSize.x -128) ? HorizontalAligment::RIGHT : HorizontalAligment::LEFT , cursorPosition.x, cursorPosition.y);
+                gpu.drawTexts();
 
 
                 gpu.drawHighlightedVerticalLine(FigureGeometryCalculator::getHighlightedLine(config.get<NumberOfRectangles>(), config.get<GapWidthInRelationToRectangleWidth>(), hightlightData.current.index));
@@ -157,40 +151,121 @@ void Window::initializeGPU()
     if(config.get<RectanglesVisibilityState>() && config.get<DynamicMaxHoldSecondaryVisibilityState>())
     {
         operations.emplace_back("transparentDynamicMaxHold", [&](){
-            const auto dynamicMaxHoldElementsPosition = scaleDbfsToPercents(anyData.get<DynamicMaxHolders>().at(MaxHolderType::Transparent).get(), config.get<VerticalDbfsRange>().second, config.get<VerticalDbfsRange>().first);
-            gpu.drawDynamicMaxHoldSecondaryRectangles(dynamicMaxHoldElementsPosition);
+            gpu.drawDynamicMaxHoldSecondaryRectangles();
         });
     }
 
     if(config.get<RectanglesVisibilityState>())
     {
         operations.emplace_back("rectangles", [&](){
-            auto positions = scaleDbfsToPercents(anyData.get<std::vector<float>>(), config.get<VerticalDbfsRange>().second, config.get<VerticalDbfsRange>().first);
-            gpu.drawRectangles(positions);
+            gpu.drawRectangles(config.get<DynamicMaxHoldVisibilityState>());
         });
     }
 
-    if(config.get<RectanglesVisibilityState>() && config.get<DynamicMaxHoldVisibilityState>())
+    prepareOperationTimers();
+}
+
+void Window::drawStaticLayers(const bool backgroundIncluded)
+{
+    if(backgroundIncluded)
     {
-        operations.emplace_back("dynamicMaxHold", [&](){
-            const auto dynamicMaxHoldElementsPosition = scaleDbfsToPercents(anyData.get<DynamicMaxHolders>().at(MaxHolderType::Dynamic).get(), config.get<VerticalDbfsRange>().second, config.get<VerticalDbfsRange>().first);
-            gpu.drawDynamicMaxHoldRectangles(dynamicMaxHoldElementsPosition);
+        gpu.drawBackground();
+    }
 
-        });
+    gpu.drawStaticLines(anyData.get<FigureGeometryCalculator::HorizontalLines>().lines, anyData.get<FigureGeometryCalculator::VerticalLines>().lines);
+
+    if(config.get<SingleScaleMode>())
+    {
+        gpu.drawHorizontalLineStaticTexts(anyData.get<FigureGeometryCalculator::HorizontalLines>().lines, anyData.get<WindowSize>());
+    }
+    else
+    {
+        gpu.drawHorizontalLineStaticTexts(anyData.get<FigureGeometryCalculator::HorizontalLines>().lines, anyData.get<WindowSize>(), FigureGeometryCalculator::xDrawOffsetInPercents, FigureGeometryCalculator::xDrawSizeInPercents);
+    }
+
+    gpu.drawVerticalLineStaticTexts(anyData.get<FigureGeometryCalculator::VerticalLineTextPositions>().positions, anyData.get<WindowSize>());
+    gpu.drawTexts();
+}
+
+// operations are reported by the flowController under these names, see AudioSpectrumAnalyzerBase
+void Window::prepareOperationTimers()
+{
+    for(const auto &[name, operation] : operations)
+    {
+        operationMetrics.push_back(Metrics::registerStage("drawing/" + name));
+        operationTimes.push_back(OperationTime{name});
+        expensiveOperations.push_back(namesOfExpensiveOperations.count(name) > 0);
     }
 
+    if(config.get<FrameTimingSettings>().gpuTimerQueriesEnabled && GpuTimer::isSupported())
+    {
+        std::vector<StageMetricsHandle> gpuMetrics;
+
+        for(const auto &[name, operation] : operations)
+        {
+            gpuMetrics.push_back(Metrics::registerStage("gpu/" + name));
+        }
+
+        gpuTimer = std::make_unique<GpuTimer>(gpuMetrics);
+    }
 }
 
 void Window::draw(const std::vector<float> &data)
 {
     anyData.add(data);
-    for(auto &[name, operation]:operations)
+
+    if(gpuTimer)
     {
+        gpuTimer->startFrame();
+    }
+
+    for(uint32_t i=0; i<operations.size(); ++i)
+    {
+        auto &[name, operation] = operations.at(i);
+
+        if(expensiveLayersSkipped && expensiveOperations.at(i))
+        {
+            operationTimes.at(i).elapsedTime = microseconds::zero();
+            continue;
+        }
+        const TraceScope traceScope(name);
+        const auto startTime = steady_clock::now();
+
+        if(gpuTimer)
+        {
+            gpuTimer->begin(i);
+        }
+
         operation();
+
+        if(gpuTimer)
+        {
+            gpuTimer->end();
+        }
+
+        operationTimes.at(i).elapsedTime = duration_cast<microseconds>(steady_clock::now() - startTime);
+        operationMetrics.at(i)->recordProcessingTime(operationTimes.at(i).elapsedTime);
+    }
+
+    if(const auto report = frameBudgetWatchdog.check(operationTimes, steady_clock::now()))
+    {
+        std::cout<<*report<<std::endl;
     }
+
+    const TraceScope traceScope("swapBuffers");
     swapBuffers();
 }
 
+void Window::skipExpensiveLayers(const bool skipped)
+{
+    expensiveLayersSkipped = skipped;
+}
+
+void Window::updateFloorDbFs(const float floorDbFs)
+{
+    gpu.updateFloorDbFs(floorDbFs);
+}
+
 Window::~Window()
 {
 }
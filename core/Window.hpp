@@ -8,6 +8,9 @@
 
 #include "WindowBase.hpp"
 #include "gpu/Gpu.hpp"
+#include "gpu/GpuTimer.hpp"
+#include "FrameBudgetWatchdog.hpp"
+#include "Stats.hpp"
 #include <vector>
 
 class Window : public WindowBase
@@ -16,12 +19,24 @@ public:
     Window(const Configuration &config, const bool fullScreenEnabled);
     void initializeGPU();
     void draw(const std::vector<float> &data);
+    // secondary max hold layers, drawn with blending over the whole spectrum, are left out
+    void skipExpensiveLayers(const bool skipped);
+    // lowest level the source can deliver, max hold values fall down to it
+    void updateFloorDbFs(const float floorDbFs);
     ~Window();
 
 private:
+    void prepareOperationTimers();
+    void drawStaticLayers(const bool backgroundIncluded);
 
     Gpu gpu;
     AnyData anyData;
     std::vector<std::pair<std::string, std::function<void()>>> operations;
+    std::vector<StageMetricsHandle> operationMetrics;
+    std::vector<OperationTime> operationTimes;
+    std::vector<bool> expensiveOperations;
+    bool expensiveLayersSkipped{false};
+    std::unique_ptr<GpuTimer> gpuTimer;
+    FrameBudgetWatchdog frameBudgetWatchdog;
 
 };
@@ -16,6 +16,7 @@ public:
     bool checkIfWindowShouldBeClosed();
     bool checkIfWindowShouldBeRecreated();
     std::optional<uint16_t> getUpdatedThemeNumber();
+    bool checkIfTraceShouldBeSaved();
     void swapBuffers();
     CursorPosition getCursorPosition();
     WindowSize getWindowSize();
@@ -31,6 +32,7 @@ private:
 
     const Configuration &config;
     bool isFullScreenEnabled;
+    bool wasTraceKeyPressed{false};
     GLFWwindow* window;
 };
 
@@ -114,6 +116,18 @@ std::optional<uint16_t> WindowBase::WindowBaseImpl::getUpdatedThemeNumber()
     return std::nullopt;
 }
 
+// only the press itself counts, a held key does not save the trace again every frame
+bool WindowBase::WindowBaseImpl::checkIfTraceShouldBeSaved()
+{
+    glfwPollEvents();
+
+    const bool isTraceKeyPressed = (glfwGetKey(window, GLFW_KEY_F12) == GLFW_PRESS);
+    const bool wasPressedNow = isTraceKeyPressed && !wasTraceKeyPressed;
+    wasTraceKeyPressed = isTraceKeyPressed;
+
+    return wasPressedNow;
+}
+
 void WindowBase::WindowBaseImpl::framebufferSizeCallback(GLFWwindow* window, int width, int height)
 {
     glViewport(0, 0, width, height);
@@ -180,6 +194,11 @@ std::optional<ThemeConfig> WindowBase::checkIfThemeShouldBeChanged()
     return std::nullopt;
 }
 
+bool WindowBase::checkIfTraceShouldBeSaved()
+{
+    return windowBaseImpl->checkIfTraceShouldBeSaved();
+}
+
 bool WindowBase::checkIfWindowShouldBeRecreated()
 {
     return windowBaseImpl->checkIfWindowShouldBeRecreated();
@@ -19,6 +19,7 @@ public:
     bool checkIfWindowShouldBeClosed();
     bool checkIfWindowShouldBeRecreated();
     std::optional<ThemeConfig> checkIfThemeShouldBeChanged();
+    bool checkIfTraceShouldBeSaved();
     ~WindowBase();
 
 protected:
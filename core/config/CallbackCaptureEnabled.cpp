@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "CallbackCaptureEnabled.hpp"
+
+CallbackCaptureEnabled::CallbackCaptureEnabled(bool value) : value(value)
+{
+}
+
+std::string CallbackCaptureEnabled::getInfo()
+{
+    return std::string(
+        R"(//Description: If this value is true, the audio device delivers samples through a callback into a lock-free ring buffer and the capture thread is woken up as soon as a block is ready. If false, the blocking read API is used and the capture thread polls the device every millisecond.)");
+}
+
+std::ostream& operator<<(std::ostream& os, const CallbackCaptureEnabled &callbackCaptureEnabled)
+{
+    os <<"callbackCaptureEnabled: "<<callbackCaptureEnabled.value<<std::endl;
+    return os;
+}
+
+template<>
+bool CallbackCaptureEnabled::getCallbackCaptureEnabled<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return true;
+    }
+}
+
+template<>
+bool CallbackCaptureEnabled::getCallbackCaptureEnabled<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return true;
+    }
+}
+
+template<>
+bool CallbackCaptureEnabled::getCallbackCaptureEnabled<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return true;
+    }
+}
+
+CallbackCaptureEnabled::CallbackCaptureEnabled(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getCallbackCaptureEnabled<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getCallbackCaptureEnabled<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getCallbackCaptureEnabled<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
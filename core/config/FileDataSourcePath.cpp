@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FileDataSourcePath.hpp"
+
+FileDataSourcePath::FileDataSourcePath(const std::string &value) : value(value)
+{
+}
+
+std::string FileDataSourcePath::getInfo()
+{
+    return std::string(
+        R"(//Description: Path to a WAV, RF64 or raw PCM file which is played instead of capturing audio from a device.
+//The file is memory mapped and its first two channels are used (mono files feed both channels).
+//Files without a RIFF/RF64 header are treated as raw PCM described by FilePlaybackSettings.
+//Leave this file empty to capture audio from a device.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const FileDataSourcePath &fileDataSourcePath)
+{
+    os <<"fileDataSourcePath: "<<fileDataSourcePath.value<<std::endl;
+    return os;
+}
+
+template<>
+std::string FileDataSourcePath::getFileDataSourcePath<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string FileDataSourcePath::getFileDataSourcePath<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string FileDataSourcePath::getFileDataSourcePath<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+FileDataSourcePath::FileDataSourcePath(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getFileDataSourcePath<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getFileDataSourcePath<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getFileDataSourcePath<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
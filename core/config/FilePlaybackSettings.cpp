@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FilePlaybackSettings.hpp"
+
+FilePlaybackSettings::FilePlaybackSettings(const FilePlayback &value) : value(value)
+{
+}
+
+std::string FilePlaybackSettings::getInfo()
+{
+    return std::string(
+        R"(//Description: Controls how the file selected in FileDataSourcePath is played.
+//The values are: realtime pacing, looping, raw sample format, raw number of channels.
+//Realtime pacing: 1 - blocks are delivered at the configured sampling rate,
+//0 - blocks are delivered as fast as the pipeline consumes them (useful for benchmarking).
+//Looping: 1 - playback restarts from the beginning at the end of the file, 0 - silence follows the end of the file.
+//Raw sample format and raw number of channels are used only for files without a WAV/RF64 header:
+//0 - 16-bit integer, 1 - 24-bit integer, 2 - 32-bit integer, 3 - 32-bit float (all little endian).
+//Raw files are assumed to be sampled at SamplingRate.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const FilePlaybackSettings &filePlaybackSettings)
+{
+    const auto &value = filePlaybackSettings.value;
+    os <<"filePlaybackSettings: "<<value.realtimePacing<<" "<<value.looping<<" "<<static_cast<uint16_t>(value.rawSampleFormat)<<" "<<value.rawNumberOfChannels<<std::endl;
+    return os;
+}
+
+template<>
+FilePlayback FilePlaybackSettings::getFilePlaybackSettings<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {true, true, SampleFormat::Int16, 2};
+    }
+}
+
+template<>
+FilePlayback FilePlaybackSettings::getFilePlaybackSettings<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {true, true, SampleFormat::Int16, 2};
+    }
+}
+
+template<>
+FilePlayback FilePlaybackSettings::getFilePlaybackSettings<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {true, true, SampleFormat::Int16, 2};
+    }
+}
+
+FilePlaybackSettings::FilePlaybackSettings(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getFilePlaybackSettings<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getFilePlaybackSettings<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getFilePlaybackSettings<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
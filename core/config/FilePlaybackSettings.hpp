@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+#include "../CommonTypes.hpp"
+#include <string>
+#include <ostream>
+
+struct FilePlaybackSettings
+{
+    FilePlaybackSettings(const FilePlayback &value);
+    FilePlaybackSettings(const ThemeConfig themeConfig, const Mode mode);
+    std::string getInfo();
+    FilePlayback value;
+    const std::string name{"FilePlaybackSettings"};
+private:
+    template <Mode>
+    FilePlayback getFilePlaybackSettings(const ThemeConfig themeConfig);
+};
+
+std::ostream& operator<<(std::ostream& os, const FilePlaybackSettings &filePlaybackSettings);
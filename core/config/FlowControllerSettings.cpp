@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FlowControllerSettings.hpp"
+
+FlowControllerSettings::FlowControllerSettings(const FlowControl &value) : value(value)
+{
+}
+
+std::string FlowControllerSettings::getInfo()
+{
+    return std::string(
+        R"(//Description: Flow controller settings. The values are: proportional gain, integral gain, integral limit, hysteresis, target queue depth.
+//After every displayed frame the overlapping is adjusted, so that spectra are produced at the rate the display takes them (at most
+//DesiredFrameRate) and the target number of spectra is published between two frames. The gains convert the error of the number
+//of spectra per frame into frames per second (the integral gain per second of the error). The integral limit in frames per second bounds
+//the integral; the overlapping is changed only when it moves by more than the hysteresis.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const FlowControllerSettings &flowControllerSettings)
+{
+    const auto &value = flowControllerSettings.value;
+    os <<"flowControllerSettings: "<<value.proportionalGain<<" "<<value.integralGain<<" "<<value.integralLimit<<" "<<value.hysteresis<<" "<<value.targetQueueDepth<<std::endl;
+    return os;
+}
+
+template<>
+FlowControl FlowControllerSettings::getFlowControllerSettings<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {4, 20, 10, 0.002, 1};
+    }
+}
+
+template<>
+FlowControl FlowControllerSettings::getFlowControllerSettings<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {4, 20, 10, 0.002, 1};
+    }
+}
+
+template<>
+FlowControl FlowControllerSettings::getFlowControllerSettings<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {4, 20, 10, 0.002, 1};
+    }
+}
+
+FlowControllerSettings::FlowControllerSettings(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getFlowControllerSettings<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getFlowControllerSettings<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getFlowControllerSettings<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
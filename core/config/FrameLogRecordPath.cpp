@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FrameLogRecordPath.hpp"
+
+FrameLogRecordPath::FrameLogRecordPath(const std::string &value) : value(value)
+{
+}
+
+std::string FrameLogRecordPath::getInfo()
+{
+    return std::string(
+        R"(//Description: Path of a frame log which records every block of samples passed to the analysis pipeline
+//together with its capture time, see FrameLogSettings. Leave this file empty to disable recording.
+//A recorded log is replayed with FrameLogReplayPath.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const FrameLogRecordPath &frameLogRecordPath)
+{
+    const auto &value = frameLogRecordPath.value;
+    os <<"frameLogRecordPath: "<<value<<std::endl;
+    return os;
+}
+
+template<>
+std::string FrameLogRecordPath::getFrameLogRecordPath<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string FrameLogRecordPath::getFrameLogRecordPath<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string FrameLogRecordPath::getFrameLogRecordPath<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+FrameLogRecordPath::FrameLogRecordPath(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getFrameLogRecordPath<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getFrameLogRecordPath<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getFrameLogRecordPath<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FrameLogReplayPath.hpp"
+
+FrameLogReplayPath::FrameLogReplayPath(const std::string &value) : value(value)
+{
+}
+
+std::string FrameLogReplayPath::getInfo()
+{
+    return std::string(
+        R"(//Description: Path of a frame log which is replayed instead of capturing audio from a device.
+//Replayed blocks are identical to the recorded ones, so every run analyzes the same input.
+//It is used when FileDataSourcePath and StreamDataSourceAddress are empty. Leave this file empty to disable replay.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const FrameLogReplayPath &frameLogReplayPath)
+{
+    const auto &value = frameLogReplayPath.value;
+    os <<"frameLogReplayPath: "<<value<<std::endl;
+    return os;
+}
+
+template<>
+std::string FrameLogReplayPath::getFrameLogReplayPath<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string FrameLogReplayPath::getFrameLogReplayPath<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string FrameLogReplayPath::getFrameLogReplayPath<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+FrameLogReplayPath::FrameLogReplayPath(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getFrameLogReplayPath<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getFrameLogReplayPath<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getFrameLogReplayPath<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
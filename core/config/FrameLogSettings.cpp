@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FrameLogSettings.hpp"
+
+FrameLogSettings::FrameLogSettings(const FrameLog &value) : value(value)
+{
+}
+
+std::string FrameLogSettings::getInfo()
+{
+    return std::string(
+        R"(//Description: Frame log settings. The values are: encoding used for recording, replay timing.
+//Encoding: 0 - 32-bit float, 1 - 16-bit integer (rounded, half the size),
+//2 - lossless (integer samples are stored as predicted residuals with Rice codes, others as 32-bit float).
+//Replay timing: 1 - blocks are delivered with the recorded timing, 0 - as fast as the pipeline consumes them.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const FrameLogSettings &frameLogSettings)
+{
+    const auto &value = frameLogSettings.value;
+    os <<"frameLogSettings: "<<static_cast<uint16_t>(value.encoding)<<" "<<value.originalTiming<<std::endl;
+    return os;
+}
+
+template<>
+FrameLog FrameLogSettings::getFrameLogSettings<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {FrameLogEncoding::Lossless, true};
+    }
+}
+
+template<>
+FrameLog FrameLogSettings::getFrameLogSettings<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {FrameLogEncoding::Lossless, true};
+    }
+}
+
+template<>
+FrameLog FrameLogSettings::getFrameLogSettings<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {FrameLogEncoding::Lossless, true};
+    }
+}
+
+FrameLogSettings::FrameLogSettings(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getFrameLogSettings<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getFrameLogSettings<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getFrameLogSettings<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
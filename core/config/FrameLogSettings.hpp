@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+#include "../CommonTypes.hpp"
+#include <string>
+#include <ostream>
+
+struct FrameLogSettings
+{
+    FrameLogSettings(const FrameLog &value);
+    FrameLogSettings(const ThemeConfig themeConfig, const Mode mode);
+    std::string getInfo();
+    FrameLog value;
+    const std::string name{"FrameLogSettings"};
+private:
+    template <Mode>
+    FrameLog getFrameLogSettings(const ThemeConfig themeConfig);
+};
+
+std::ostream& operator<<(std::ostream& os, const FrameLogSettings &frameLogSettings);
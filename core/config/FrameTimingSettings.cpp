@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FrameTimingSettings.hpp"
+
+FrameTimingSettings::FrameTimingSettings(const FrameTiming &value) : value(value)
+{
+}
+
+std::string FrameTimingSettings::getInfo()
+{
+    return std::string(
+        R"(//Description: Frame timing settings. The values are: frame budget in milliseconds, GPU timer queries.
+//The drawing time of every operation of a frame is measured and reported once per second. When drawing a frame takes longer
+//than the budget, the operation which took most of it is reported (at most once per second). 0 disables the budget.
+//GPU timer queries: 1 - the GPU time of every operation is measured as well, when the OpenGL context supports it, 0 - disabled.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const FrameTimingSettings &frameTimingSettings)
+{
+    const auto &value = frameTimingSettings.value;
+    os <<"frameTimingSettings: "<<value.budgetInMilliseconds<<" "<<value.gpuTimerQueriesEnabled<<std::endl;
+    return os;
+}
+
+template<>
+FrameTiming FrameTimingSettings::getFrameTimingSettings<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {0, false};
+    }
+}
+
+template<>
+FrameTiming FrameTimingSettings::getFrameTimingSettings<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {0, false};
+    }
+}
+
+template<>
+FrameTiming FrameTimingSettings::getFrameTimingSettings<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {0, false};
+    }
+}
+
+FrameTimingSettings::FrameTimingSettings(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getFrameTimingSettings<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getFrameTimingSettings<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getFrameTimingSettings<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
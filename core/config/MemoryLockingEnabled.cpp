@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "MemoryLockingEnabled.hpp"
+
+MemoryLockingEnabled::MemoryLockingEnabled(bool value) : value(value)
+{
+}
+
+std::string MemoryLockingEnabled::getInfo()
+{
+    return std::string(
+        R"(//Description: If this value is true, all pages of the application are locked in RAM (mlockall) once the pipeline has allocated its buffers, so audio and FFT buffers are never paged out. Requires CAP_IPC_LOCK or a sufficient memlock limit, otherwise a warning is printed and the application runs unlocked.)");
+}
+
+std::ostream& operator<<(std::ostream& os, const MemoryLockingEnabled &memoryLockingEnabled)
+{
+    os <<"memoryLockingEnabled: "<<memoryLockingEnabled.value<<std::endl;
+    return os;
+}
+
+template<>
+bool MemoryLockingEnabled::getMemoryLockingEnabled<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+template<>
+bool MemoryLockingEnabled::getMemoryLockingEnabled<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+template<>
+bool MemoryLockingEnabled::getMemoryLockingEnabled<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+MemoryLockingEnabled::MemoryLockingEnabled(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getMemoryLockingEnabled<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getMemoryLockingEnabled<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getMemoryLockingEnabled<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
@@ -0,0 +1,67 @@
+#include "NumberOfSamplesCollectedFromHw.hpp"
+
+
+NumberOfSamplesCollectedFromHw::NumberOfSamplesCollectedFromHw(uint32_t value) : value(value)
+{
+}
+
+std::string NumberOfSamplesCollectedFromHw::getInfo()
+{
+    return std::string(
+        R"(//Description: Number of samples per channel read from the audio device each time the capture thread wakes up. Smaller blocks lower the capture latency, bigger blocks lower the number of wakeups and queue operations per second (e.g. 128 samples at 192 kHz gives 1500 wakeups per second).
+//0 means adaptive: the block size is derived at startup from SamplingRate, NumberOfSamples and DesiredFrameRate, so that at least two blocks arrive for every FFT hop.
+//Default value: 0
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const NumberOfSamplesCollectedFromHw &numberOfSamplesCollectedFromHw)
+{
+    os <<"numberOfSamplesCollectedFromHw: "<<numberOfSamplesCollectedFromHw.value<<std::endl;
+    return os;
+}
+
+template<>
+uint32_t NumberOfSamplesCollectedFromHw::getNumberOfSamplesCollectedFromHw<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return 0;
+    }
+}
+
+template<>
+uint32_t NumberOfSamplesCollectedFromHw::getNumberOfSamplesCollectedFromHw<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return 0;
+    }
+}
+
+template<>
+uint32_t NumberOfSamplesCollectedFromHw::getNumberOfSamplesCollectedFromHw<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return 0;
+    }
+}
+
+NumberOfSamplesCollectedFromHw::NumberOfSamplesCollectedFromHw(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getNumberOfSamplesCollectedFromHw<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getNumberOfSamplesCollectedFromHw<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getNumberOfSamplesCollectedFromHw<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
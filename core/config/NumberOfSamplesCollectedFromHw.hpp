@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+#include "../CommonTypes.hpp"
+#include <string>
+#include <cstdint>
+#include <ostream>
+
+struct NumberOfSamplesCollectedFromHw
+{
+    NumberOfSamplesCollectedFromHw(uint32_t value);
+    NumberOfSamplesCollectedFromHw(const ThemeConfig themeConfig, const Mode mode);
+    std::string getInfo();
+    uint32_t value;
+    const std::string name{"NumberOfSamplesCollectedFromHw"};
+private:
+    template <Mode>
+    uint32_t getNumberOfSamplesCollectedFromHw(const ThemeConfig themeConfig);
+};
+
+std::ostream& operator<<(std::ostream& os, const NumberOfSamplesCollectedFromHw &numberOfSamplesCollectedFromHw);
+
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "PythonProcessIsolationEnabled.hpp"
+
+PythonProcessIsolationEnabled::PythonProcessIsolationEnabled(const bool value) : value(value)
+{
+}
+
+std::string PythonProcessIsolationEnabled::getInfo()
+{
+    return std::string(
+        R"(//Description: If this value is true and the Python data source is enabled, the audioConfig module runs in a separate spectrum-analyzer-python-worker process which passes samples through a shared-memory ring. A hung or crashed script does not stall the analyzer and the worker is restarted automatically.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const PythonProcessIsolationEnabled &pythonProcessIsolationEnabled)
+{
+    const auto &value = pythonProcessIsolationEnabled.value;
+    os <<"pythonProcessIsolationEnabled: "<<value<<std::endl;
+    return os;
+}
+
+template<>
+bool PythonProcessIsolationEnabled::getPythonProcessIsolationEnabled<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+template<>
+bool PythonProcessIsolationEnabled::getPythonProcessIsolationEnabled<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+template<>
+bool PythonProcessIsolationEnabled::getPythonProcessIsolationEnabled<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+PythonProcessIsolationEnabled::PythonProcessIsolationEnabled(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getPythonProcessIsolationEnabled<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getPythonProcessIsolationEnabled<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getPythonProcessIsolationEnabled<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "QualityGovernorSettings.hpp"
+
+QualityGovernorSettings::QualityGovernorSettings(const QualityControl &value) : value(value)
+{
+}
+
+std::string QualityGovernorSettings::getInfo()
+{
+    return std::string(
+        R"(//Description: Quality governor settings. The values are: enabled (1 - enabled, 0 - disabled), CPU budget in percents, restore threshold in percents,
+//max queue depth, restore delay in seconds. Once per second the busiest of the FFT, processing and drawing stages is checked against the budget
+//(the percent of time its thread spends working) and the FFT queue against the max queue depth. After two overloaded checks in a row, or when
+//a queue overflows, the quality is lowered by one step: fewer Welch segments, half the FFT size, neighbouring bars merged, then the secondary
+//max hold layers are not drawn. One step is restored after the busiest stage stays below the restore threshold for the restore delay,
+//which doubles (up to 8 times) each time a restored step has to be lowered again within it.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const QualityGovernorSettings &qualityGovernorSettings)
+{
+    const auto &value = qualityGovernorSettings.value;
+    os <<"qualityGovernorSettings: "<<value.enabled<<" "<<value.cpuBudgetInPercents<<" "<<value.restoreThresholdInPercents<<" "<<value.maxQueueDepth<<" "<<value.restoreDelayInSeconds<<std::endl;
+    return os;
+}
+
+template<>
+QualityControl QualityGovernorSettings::getQualityGovernorSettings<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return QualityControl{true, 85, 40, 4, 5};
+    }
+}
+
+template<>
+QualityControl QualityGovernorSettings::getQualityGovernorSettings<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return QualityControl{true, 85, 40, 4, 5};
+    }
+}
+
+template<>
+QualityControl QualityGovernorSettings::getQualityGovernorSettings<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return QualityControl{true, 85, 40, 4, 5};
+    }
+}
+
+QualityGovernorSettings::QualityGovernorSettings(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getQualityGovernorSettings<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getQualityGovernorSettings<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getQualityGovernorSettings<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+#include "../CommonTypes.hpp"
+#include <string>
+#include <ostream>
+
+struct QualityGovernorSettings
+{
+    QualityGovernorSettings(const QualityControl &value);
+    QualityGovernorSettings(const ThemeConfig themeConfig, const Mode mode);
+    std::string getInfo();
+    QualityControl value;
+    const std::string name{"QualityGovernorSettings"};
+private:
+    template <Mode>
+    QualityControl getQualityGovernorSettings(const ThemeConfig themeConfig);
+};
+
+std::ostream& operator<<(std::ostream& os, const QualityGovernorSettings &qualityGovernorSettings);
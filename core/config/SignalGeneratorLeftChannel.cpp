@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SignalGeneratorLeftChannel.hpp"
+
+SignalGeneratorLeftChannel::SignalGeneratorLeftChannel(const GeneratorSignal &value) : value(value)
+{
+}
+
+std::string SignalGeneratorLeftChannel::getInfo()
+{
+    return std::string(
+        R"(//Description: Built-in signal generator for the left channel, see also SignalGeneratorRightChannel.
+//The values are: signal type, amplitude in dBFS, frequency, second frequency, period in seconds, seed.
+//Signal type: 0 - off, 1 - sine, 2 - multitone (one tone per octave from frequency to second frequency),
+//3 - exponential sweep from frequency to second frequency repeated every period,
+//4 - white noise, 5 - pink noise, 6 - impulse repeated every period (0 - a single impulse).
+//Noise with the same seed is identical in every run.
+//The generator is used when any channel is not off and FileDataSourcePath and StreamDataSourceAddress are empty.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const SignalGeneratorLeftChannel &signalGeneratorLeftChannel)
+{
+    const auto &value = signalGeneratorLeftChannel.value;
+    os <<"signalGeneratorLeftChannel: "<<static_cast<uint16_t>(value.type)<<" "<<value.amplitudeDbfs<<" "<<value.frequency<<" "<<value.secondFrequency<<" "<<value.period<<" "<<value.seed<<std::endl;
+    return os;
+}
+
+template<>
+GeneratorSignal SignalGeneratorLeftChannel::getSignalGeneratorLeftChannel<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SignalType::Off, -6, 1000, 10000, 10, 1};
+    }
+}
+
+template<>
+GeneratorSignal SignalGeneratorLeftChannel::getSignalGeneratorLeftChannel<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SignalType::Off, -6, 1000, 10000, 10, 1};
+    }
+}
+
+template<>
+GeneratorSignal SignalGeneratorLeftChannel::getSignalGeneratorLeftChannel<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SignalType::Off, -6, 1000, 10000, 10, 1};
+    }
+}
+
+SignalGeneratorLeftChannel::SignalGeneratorLeftChannel(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getSignalGeneratorLeftChannel<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getSignalGeneratorLeftChannel<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getSignalGeneratorLeftChannel<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
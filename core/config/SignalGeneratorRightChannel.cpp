@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SignalGeneratorRightChannel.hpp"
+
+SignalGeneratorRightChannel::SignalGeneratorRightChannel(const GeneratorSignal &value) : value(value)
+{
+}
+
+std::string SignalGeneratorRightChannel::getInfo()
+{
+    return std::string(
+        R"(//Description: Built-in signal generator for the right channel, see also SignalGeneratorLeftChannel.
+//The values are: signal type, amplitude in dBFS, frequency, second frequency, period in seconds, seed.
+//Signal type: 0 - off, 1 - sine, 2 - multitone (one tone per octave from frequency to second frequency),
+//3 - exponential sweep from frequency to second frequency repeated every period,
+//4 - white noise, 5 - pink noise, 6 - impulse repeated every period (0 - a single impulse).
+//Noise with the same seed is identical in every run.
+//The generator is used when any channel is not off and FileDataSourcePath and StreamDataSourceAddress are empty.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const SignalGeneratorRightChannel &signalGeneratorRightChannel)
+{
+    const auto &value = signalGeneratorRightChannel.value;
+    os <<"signalGeneratorRightChannel: "<<static_cast<uint16_t>(value.type)<<" "<<value.amplitudeDbfs<<" "<<value.frequency<<" "<<value.secondFrequency<<" "<<value.period<<" "<<value.seed<<std::endl;
+    return os;
+}
+
+template<>
+GeneratorSignal SignalGeneratorRightChannel::getSignalGeneratorRightChannel<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SignalType::Off, -6, 1000, 10000, 10, 2};
+    }
+}
+
+template<>
+GeneratorSignal SignalGeneratorRightChannel::getSignalGeneratorRightChannel<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SignalType::Off, -6, 1000, 10000, 10, 2};
+    }
+}
+
+template<>
+GeneratorSignal SignalGeneratorRightChannel::getSignalGeneratorRightChannel<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SignalType::Off, -6, 1000, 10000, 10, 2};
+    }
+}
+
+SignalGeneratorRightChannel::SignalGeneratorRightChannel(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getSignalGeneratorRightChannel<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getSignalGeneratorRightChannel<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getSignalGeneratorRightChannel<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
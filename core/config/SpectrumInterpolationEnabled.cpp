@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SpectrumInterpolationEnabled.hpp"
+
+SpectrumInterpolationEnabled::SpectrumInterpolationEnabled(const bool value) : value(value)
+{
+}
+
+std::string SpectrumInterpolationEnabled::getInfo()
+{
+    return std::string(
+        R"(//Description: Interpolation between the two newest spectra: 1 - enabled, 0 - disabled.
+//When enabled a frame is drawn at every refresh of the display, also when no new spectrum has arrived, and bars move
+//from the previous spectrum to the newest one over the time between them. Motion is smoother on displays refreshed faster
+//than spectra are calculated, at the cost of delaying the picture by the time between two spectra.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const SpectrumInterpolationEnabled &spectrumInterpolationEnabled)
+{
+    const auto &value = spectrumInterpolationEnabled.value;
+    os <<"spectrumInterpolationEnabled: "<<value<<std::endl;
+    return os;
+}
+
+template<>
+bool SpectrumInterpolationEnabled::getSpectrumInterpolationEnabled<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+template<>
+bool SpectrumInterpolationEnabled::getSpectrumInterpolationEnabled<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+template<>
+bool SpectrumInterpolationEnabled::getSpectrumInterpolationEnabled<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return false;
+    }
+}
+
+SpectrumInterpolationEnabled::SpectrumInterpolationEnabled(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getSpectrumInterpolationEnabled<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getSpectrumInterpolationEnabled<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getSpectrumInterpolationEnabled<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
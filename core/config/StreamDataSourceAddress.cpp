@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "StreamDataSourceAddress.hpp"
+
+StreamDataSourceAddress::StreamDataSourceAddress(const std::string &value) : value(value)
+{
+}
+
+std::string StreamDataSourceAddress::getInfo()
+{
+    return std::string(
+        R"(//Description: Address from which interleaved PCM samples are read instead of capturing audio from a device.
+//"-" reads from the standard input, "unix:<path>" listens on a Unix domain socket and any other value is opened as a named pipe (FIFO).
+//A socket or named pipe may be reconnected at any time. The samples are described by StreamDataSourceFormat and are expected at SamplingRate.
+//Leave this file empty to capture audio from a device.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const StreamDataSourceAddress &streamDataSourceAddress)
+{
+    os <<"streamDataSourceAddress: "<<streamDataSourceAddress.value<<std::endl;
+    return os;
+}
+
+template<>
+std::string StreamDataSourceAddress::getStreamDataSourceAddress<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string StreamDataSourceAddress::getStreamDataSourceAddress<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string StreamDataSourceAddress::getStreamDataSourceAddress<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+StreamDataSourceAddress::StreamDataSourceAddress(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getStreamDataSourceAddress<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getStreamDataSourceAddress<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getStreamDataSourceAddress<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "StreamDataSourceFormat.hpp"
+
+StreamDataSourceFormat::StreamDataSourceFormat(const PcmFormat &value) : value(value)
+{
+}
+
+std::string StreamDataSourceFormat::getInfo()
+{
+    return std::string(
+        R"(//Description: Format of the samples read from StreamDataSourceAddress: sample format, number of channels.
+//Sample format: 0 - 16-bit integer, 1 - 24-bit integer, 2 - 32-bit integer, 3 - 32-bit float (all little endian).
+//The first two channels are analyzed, a single channel feeds both of them.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const StreamDataSourceFormat &streamDataSourceFormat)
+{
+    const auto &value = streamDataSourceFormat.value;
+    os <<"streamDataSourceFormat: "<<static_cast<uint16_t>(value.sampleFormat)<<" "<<value.numberOfChannels<<std::endl;
+    return os;
+}
+
+template<>
+PcmFormat StreamDataSourceFormat::getStreamDataSourceFormat<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SampleFormat::Int16, 2};
+    }
+}
+
+template<>
+PcmFormat StreamDataSourceFormat::getStreamDataSourceFormat<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SampleFormat::Int16, 2};
+    }
+}
+
+template<>
+PcmFormat StreamDataSourceFormat::getStreamDataSourceFormat<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return {SampleFormat::Int16, 2};
+    }
+}
+
+StreamDataSourceFormat::StreamDataSourceFormat(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getStreamDataSourceFormat<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getStreamDataSourceFormat<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getStreamDataSourceFormat<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "ThreadSchedulingSettings.hpp"
+
+
+ThreadSchedulingSettings::ThreadSchedulingSettings(const ThreadSettingsPerStage &value) : value(value)
+{
+}
+
+std::string ThreadSchedulingSettings::getInfo()
+{
+    return std::string(
+        R"(//Description: Scheduling of the pipeline threads. Each line describes one stage in the following order: samplesUpdater, fftCalculator, processing, drafter, flowController.
+//Line format: policy, priority, cpu, cpu, ...
+//policy: 0 - default scheduling of the operating system, 1 - realtime FIFO, 2 - realtime round robin
+//priority: realtime priority (Linux: 1-99), ignored for the default policy
+//cpu: optional list of CPU indexes the thread is allowed to run on, no list means no affinity
+//If the operating system does not permit the requested setting (e.g. missing CAP_SYS_NICE or rtprio limit) a warning is printed and the thread keeps running with default settings.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const ThreadSchedulingSettings &threadSchedulingSettings)
+{
+    os <<"threadSchedulingSettings: "<<std::endl;
+    for(auto &[stage, settings]: threadSchedulingSettings.value)
+    {
+        os<<"stage: "<<stage<<" settings: ";
+        for(auto & setting: settings)
+        {
+            os<<setting<<" ";
+        }
+        os<<std::endl;
+    }
+
+    return os;
+}
+
+template<>
+ThreadSettingsPerStage ThreadSchedulingSettings::getThreadSchedulingSettings<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    const ThreadSettingsPerStage defaultValue{
+        {0,{1, 70}},
+        {1,{1, 60}},
+        {2,{0, 0}},
+        {3,{0, 0}},
+        {4,{0, 0}}
+    };
+
+    switch(themeConfig)
+    {
+        default:
+            return defaultValue;
+    }
+}
+
+template<>
+ThreadSettingsPerStage ThreadSchedulingSettings::getThreadSchedulingSettings<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    const ThreadSettingsPerStage defaultValue{
+        {0,{1, 70}},
+        {1,{1, 60}},
+        {2,{0, 0}},
+        {3,{0, 0}},
+        {4,{0, 0}}
+    };
+
+    switch(themeConfig)
+    {
+        default:
+            return defaultValue;
+    }
+}
+
+template<>
+ThreadSettingsPerStage ThreadSchedulingSettings::getThreadSchedulingSettings<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    const ThreadSettingsPerStage defaultValue{
+        {0,{1, 70}},
+        {1,{1, 60}},
+        {2,{0, 0}},
+        {3,{0, 0}},
+        {4,{0, 0}}
+    };
+
+    switch(themeConfig)
+    {
+        default:
+            return defaultValue;
+    }
+}
+
+ThreadSchedulingSettings::ThreadSchedulingSettings(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getThreadSchedulingSettings<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getThreadSchedulingSettings<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getThreadSchedulingSettings<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "../CommonTypes.hpp"
+#include <string>
+#include <ostream>
+
+struct ThreadSchedulingSettings
+{
+    ThreadSchedulingSettings(const ThreadSettingsPerStage &value);
+    ThreadSchedulingSettings(const ThemeConfig themeConfig, const Mode mode);
+    std::string getInfo();
+    ThreadSettingsPerStage value;
+    const std::string name{"ThreadSchedulingSettings"};
+
+private:
+    template <Mode>
+    ThreadSettingsPerStage getThreadSchedulingSettings(const ThemeConfig themeConfig);
+};
+
+std::ostream& operator<<(std::ostream& os, const ThreadSchedulingSettings &threadSchedulingSettings);
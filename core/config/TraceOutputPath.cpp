@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "TraceOutputPath.hpp"
+
+TraceOutputPath::TraceOutputPath(const std::string &value) : value(value)
+{
+}
+
+std::string TraceOutputPath::getInfo()
+{
+    return std::string(
+        R"(//Description: Path of a Chrome trace-event JSON file with the timeline of the pipeline: every item processed by each stage,
+//every drawing operation of a frame, queue sizes and overlapping changes. It is written when the analyzer stops and
+//each time F12 is pressed, the file can be opened in Perfetto or chrome://tracing. Leave this field empty to disable tracing.
+)");
+}
+
+std::ostream& operator<<(std::ostream& os, const TraceOutputPath &traceOutputPath)
+{
+    const auto &value = traceOutputPath.value;
+    os <<"traceOutputPath: "<<value<<std::endl;
+    return os;
+}
+
+template<>
+std::string TraceOutputPath::getTraceOutputPath<Mode::Analyzer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string TraceOutputPath::getTraceOutputPath<Mode::Visualizer>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+template<>
+std::string TraceOutputPath::getTraceOutputPath<Mode::StereoRmsMeter>(const ThemeConfig themeConfig)
+{
+    switch(themeConfig)
+    {
+        default:
+            return "";
+    }
+}
+
+TraceOutputPath::TraceOutputPath(const ThemeConfig themeConfig, const Mode mode)
+{
+    switch(mode)
+    {
+    case Mode::Analyzer:
+        value = getTraceOutputPath<Mode::Analyzer>(themeConfig);
+        break;
+    case Mode::Visualizer:
+        value = getTraceOutputPath<Mode::Visualizer>(themeConfig);
+        break;
+    case Mode::StereoRmsMeter:
+        value = getTraceOutputPath<Mode::StereoRmsMeter>(themeConfig);
+        break;
+    }
+}
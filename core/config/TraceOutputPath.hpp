@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+#include "../CommonTypes.hpp"
+#include <string>
+#include <ostream>
+
+struct TraceOutputPath
+{
+    TraceOutputPath(const std::string &value);
+    TraceOutputPath(const ThemeConfig themeConfig, const Mode mode);
+    std::string getInfo();
+    std::string value;
+    const std::string name{"TraceOutputPath"};
+private:
+    template <Mode>
+    std::string getTraceOutputPath(const ThemeConfig themeConfig);
+};
+
+std::ostream& operator<<(std::ostream& os, const TraceOutputPath &traceOutputPath);
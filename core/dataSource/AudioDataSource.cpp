@@ -1,18 +1,19 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
 
 #include "AudioDataSource.hpp"
 #include "AudioDataSourceDevice.hpp"
+#include "SampleConverter.hpp"
 #include "../Helpers.hpp"
 #include <iostream>
 #include <chrono>
 #include <thread>
 #include <algorithm>
 
-AudioDataSource::AudioDataSource(bool loopbackEnabled) : loopbackEnabled(loopbackEnabled)
+AudioDataSource::AudioDataSource(bool loopbackEnabled, bool callbackCaptureEnabled) : loopbackEnabled(loopbackEnabled), callbackCaptureEnabled(callbackCaptureEnabled)
 {
     initFunctions.emplace_back("initialize", [](){
         return Pa_Initialize();
@@ -34,17 +35,10 @@ AudioDataSource::AudioDataSource(bool loopbackEnabled) : loopbackEnabled(loopbac
 
         inputParams.device = device;
         inputParams.channelCount = numberOfChannels;
-        inputParams.sampleFormat = paInt16;
         inputParams.suggestedLatency = Pa_GetDeviceInfo(device)->defaultLowInputLatency;
         inputParams.hostApiSpecificStreamInfo = nullptr;
 
-        PaError err = Pa_IsFormatSupported(
-            &inputParams,
-            nullptr,
-            samplingRate
-            );
-
-        if(err != paNoError)
+        if(!selectSampleFormat())
         {
             auto deviceInfo = Pa_GetDeviceInfo(device);
             const auto supportedSampleRate = deviceInfo->defaultSampleRate;
@@ -72,7 +66,25 @@ FIX OPTION 2: CHANGE THE DEFAULT AUDIO FORMAT IN WINDOWS:
     });
 
 
+    initFunctions.emplace_back("allocateBuffers", [&](){
+
+        buffer.emplace(std::vector<uint8_t>(dataLength * numberOfChannels * bytesPerSample));
+
+        if(this->callbackCaptureEnabled)
+        {
+            ringBuffer = std::make_unique<SpscRingBuffer<uint8_t>>(buffer.value().size() * numberOfBlocksKeptInRingBuffer);
+        }
+
+        return paNoError;
+    });
+
     initFunctions.emplace_back("openStream", [&](){
+
+        if(this->callbackCaptureEnabled)
+        {
+            return Pa_OpenStream(&stream, &inputParams, nullptr, samplingRate, dataLength, paClipOff, &AudioDataSource::streamCallback, this);
+        }
+
         return Pa_OpenStream(&stream, &inputParams, nullptr, samplingRate, dataLength, paClipOff, nullptr, nullptr);
     });
 
@@ -87,8 +99,6 @@ bool AudioDataSource::initialize(uint32_t numberOfSamples, uint32_t sampleRate)
     samplingRate = sampleRate;
     errorOccured = false;
 
-    buffer.emplace(std::vector<int16_t>(dataLength * numberOfChannels));
-
     for(auto &[procedureName, procedure]: initFunctions)
     {
         const auto result = procedure();
@@ -110,10 +120,46 @@ bool AudioDataSource::checkIfErrorOccured()
     return errorOccured;
 }
 
+PaTime AudioDataSource::getInputBufferAdcTime() const
+{
+    return inputBufferAdcTime.load(std::memory_order_relaxed);
+}
+
+uint32_t AudioDataSource::getNumberOfOverflows() const
+{
+    return numberOfOverflows.load(std::memory_order_relaxed);
+}
+
+SampleFormat AudioDataSource::getSampleFormat() const
+{
+    switch(sampleFormat)
+    {
+    case paFloat32:
+        return SampleFormat::Float32;
+    case paInt32:
+        return SampleFormat::Int32;
+    case paInt24:
+        return SampleFormat::Int24;
+    default:
+        return SampleFormat::Int16;
+    }
+}
+
 void AudioDataSource::updateBuffer()
 {
+    if(callbackCaptureEnabled)
+    {
+        ringBuffer->read(buffer.value().data(), buffer.value().size());
+        return;
+    }
+
     PaError err = Pa_ReadStream(stream, buffer.value().data(), dataLength);
 
+    if (err == paInputOverflowed)
+    {
+        numberOfOverflows.fetch_add(1, std::memory_order_relaxed);
+    }
+
     if ((err != paNoError) && (err != paInputOverflowed))
     {
         std::cout << "PortAudio error while collecting samples from hw: " << Pa_GetErrorText(err) << std::endl;
@@ -130,14 +176,12 @@ StereoData AudioDataSource::collectStereoDataFromHw()
 
         if(buffer != std::nullopt)
         {
-            StereoData channels;
+            StereoData channels{std::vector<float>(dataLength), std::vector<float>(dataLength)};
+            convertBuffer(channels);
 
-            channels.left.reserve(dataLength);
-            channels.right.reserve(dataLength);
-
-            for (uint32_t i = 0; i < buffer.value().size(); ++i)
+            if(callbackCaptureEnabled)
             {
-                (i % 2) ? channels.right.emplace_back(buffer.value()[i]) : channels.left.emplace_back(buffer.value()[i]);
+                channels.captureTime = getCaptureTimeOfReadBlock();
             }
             return channels;
         }
@@ -147,6 +191,70 @@ StereoData AudioDataSource::collectStereoDataFromHw()
     return {};
 }
 
+// blocks still waiting in the ring were captured before the newest one
+std::chrono::steady_clock::time_point AudioDataSource::getCaptureTimeOfReadBlock() const
+{
+    const auto newestSampleCaptureTimeSinceEpoch = newestSampleCaptureTime.load(std::memory_order_relaxed);
+
+    if(newestSampleCaptureTimeSinceEpoch == 0)
+    {
+        return {};
+    }
+
+    const auto numberOfFramesInRing = ringBuffer->getSize() / (numberOfChannels * bytesPerSample);
+    const std::chrono::duration<double> ageOfBlock(static_cast<double>(numberOfFramesInRing) / samplingRate);
+    const std::chrono::steady_clock::time_point newestSampleTime{std::chrono::steady_clock::duration(newestSampleCaptureTimeSinceEpoch)};
+
+    return newestSampleTime - std::chrono::duration_cast<std::chrono::steady_clock::duration>(ageOfBlock);
+}
+
+bool AudioDataSource::selectSampleFormat()
+{
+    const std::pair<PaSampleFormat, uint32_t> preferredFormats[] = {
+        {paFloat32, 4},
+        {paInt32, 4},
+        {paInt24, 3},
+        {paInt16, 2}
+    };
+
+    for(const auto &[format, numberOfBytes] : preferredFormats)
+    {
+        inputParams.sampleFormat = format;
+
+        if(Pa_IsFormatSupported(&inputParams, nullptr, samplingRate) == paNoError)
+        {
+            sampleFormat = format;
+            bytesPerSample = numberOfBytes;
+            return true;
+        }
+    }
+
+    inputParams.sampleFormat = sampleFormat = paInt16;
+    bytesPerSample = 2;
+    return false;
+}
+
+void AudioDataSource::convertBuffer(StereoData &channels)
+{
+    const auto *data = buffer.value().data();
+
+    switch(sampleFormat)
+    {
+    case paFloat32:
+        deinterleaveFloat32(reinterpret_cast<const float*>(data), channels.left.data(), channels.right.data(), dataLength);
+        break;
+    case paInt32:
+        deinterleaveInt32(reinterpret_cast<const int32_t*>(data), channels.left.data(), channels.right.data(), dataLength);
+        break;
+    case paInt24:
+        deinterleaveInt24(data, channels.left.data(), channels.right.data(), dataLength);
+        break;
+    default:
+        deinterleaveInt16(reinterpret_cast<const int16_t*>(data), channels.left.data(), channels.right.data(), dataLength);
+        break;
+    }
+}
+
 void AudioDataSource::checkIfCriticalErrorOccured(const PaError &err)
 {
     const PaError criticalErrors[] = {
@@ -183,6 +291,17 @@ bool AudioDataSource::isDataAvailable()
     constexpr int maxWaitMs = 60;
     constexpr int delayInMs = 1;
 
+    if(callbackCaptureEnabled)
+    {
+        const size_t numberOfRequiredBytes = dataLength * numberOfChannels * bytesPerSample;
+
+        std::unique_lock<std::mutex> ul(dataAvailableMutex);
+
+        return dataAvailableConditionVariable.wait_for(ul, std::chrono::milliseconds(maxWaitMs), [&](){
+            return ringBuffer->getSize() >= numberOfRequiredBytes;
+        });
+    }
+
     int waitedMs = 0;
 
     while (waitedMs < maxWaitMs)
@@ -199,6 +318,55 @@ bool AudioDataSource::isDataAvailable()
     return false;
 }
 
+int AudioDataSource::streamCallback(const void *input, void */*output*/, unsigned long frameCount, const PaStreamCallbackTimeInfo* timeInfo, PaStreamCallbackFlags statusFlags, void *userData)
+{
+    auto &dataSource = *static_cast<AudioDataSource*>(userData);
+
+    if(input)
+    {
+        auto &ringBuffer = *dataSource.ringBuffer;
+        const size_t numberOfBytes = frameCount * numberOfChannels * dataSource.bytesPerSample;
+
+        // whole blocks only, so a frame is never split when the consumer falls behind
+        if(ringBuffer.getCapacity() - ringBuffer.getSize() >= numberOfBytes)
+        {
+            ringBuffer.write(static_cast<const uint8_t*>(input), numberOfBytes);
+        }
+        else
+        {
+            dataSource.numberOfOverflows.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if(statusFlags & paInputOverflow)
+    {
+        dataSource.numberOfOverflows.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if(timeInfo)
+    {
+        dataSource.inputBufferAdcTime.store(timeInfo->inputBufferAdcTime, std::memory_order_relaxed);
+
+        // the stream clock is translated to steady_clock through the current time of both clocks,
+        // host APIs which do not provide timestamps report zeros
+        const PaTime newestSampleAdcTime = timeInfo->inputBufferAdcTime + static_cast<PaTime>(frameCount) / dataSource.samplingRate;
+        const PaTime ageOfNewestSample = ((timeInfo->currentTime > 0) && (timeInfo->inputBufferAdcTime > 0)) ? std::clamp(timeInfo->currentTime - newestSampleAdcTime, 0.0, 1.0) : 0.0;
+        const auto captureTime = std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<PaTime>(ageOfNewestSample));
+
+        dataSource.newestSampleCaptureTime.store(captureTime.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    // The callback never waits for the consumer. If the consumer currently holds the mutex
+    // the notification can be missed, the next callback notifies again.
+    if(dataSource.dataAvailableMutex.try_lock())
+    {
+        dataSource.dataAvailableMutex.unlock();
+    }
+
+    dataSource.dataAvailableConditionVariable.notify_one();
+
+    return paContinue;
+}
 
 AudioDataSource::~AudioDataSource()
 {
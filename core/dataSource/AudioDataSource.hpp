@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -7,20 +7,29 @@
 #pragma once
 
 #include "DataSourceBase.hpp"
+#include "../SpscRingBuffer.hpp"
 #include <vector>
 #include <portaudio.h>
 #include <functional>
 #include <string>
 #include <optional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
 
 class AudioDataSource : public DataSourceBase
 {
 public:
-    AudioDataSource(bool loopbackEnabled);
+    AudioDataSource(bool loopbackEnabled, bool callbackCaptureEnabled = false);
     ~AudioDataSource();
     bool initialize(uint32_t numberOfSamples, uint32_t sampleRate) override;
     bool checkIfErrorOccured() override;
     StereoData collectStereoDataFromHw() override;
+    PaTime getInputBufferAdcTime() const;
+    uint32_t getNumberOfOverflows() const;
+    SampleFormat getSampleFormat() const override;
 
     AudioDataSource(AudioDataSource&) = delete;
     AudioDataSource(AudioDataSource&&) = delete;
@@ -32,15 +41,31 @@ private:
     void checkIfCriticalErrorOccured(const PaError &err);
     void closeStreamAndBuffer();
     bool isDataAvailable();
+    bool selectSampleFormat();
+    void convertBuffer(StereoData &channels);
+    std::chrono::steady_clock::time_point getCaptureTimeOfReadBlock() const;
+    static int streamCallback(const void *input, void *output, unsigned long frameCount, const PaStreamCallbackTimeInfo* timeInfo, PaStreamCallbackFlags statusFlags, void *userData);
 
     std::vector<std::pair<std::string, std::function<PaError()>>> initFunctions;
     PaStreamParameters inputParams{};
     PaStream* stream{};
     PaDeviceIndex device{paNoDevice};
     bool loopbackEnabled;
+    bool callbackCaptureEnabled;
     uint32_t samplingRate{};
-    std::optional<std::vector<int16_t>> buffer;
+    PaSampleFormat sampleFormat{paInt16};
+    uint32_t bytesPerSample{2};
+    std::optional<std::vector<uint8_t>> buffer;
     bool errorOccured{};
+
+    std::unique_ptr<SpscRingBuffer<uint8_t>> ringBuffer;
+    std::mutex dataAvailableMutex;
+    std::condition_variable dataAvailableConditionVariable;
+    std::atomic<PaTime> inputBufferAdcTime{0};
+    std::atomic<int64_t> newestSampleCaptureTime{0};
+    std::atomic<uint32_t> numberOfOverflows{0};
+
+    static constexpr uint32_t numberOfBlocksKeptInRingBuffer{64};
 };
 
 
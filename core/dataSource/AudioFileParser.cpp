@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "AudioFileParser.hpp"
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <algorithm>
+
+namespace
+{
+
+constexpr size_t chunkHeaderSize{8};
+constexpr uint32_t sizeStoredInDs64Chunk{0xFFFFFFFF};
+constexpr uint16_t waveFormatPcm{1};
+constexpr uint16_t waveFormatIeeeFloat{3};
+constexpr uint16_t waveFormatExtensible{0xFFFE};
+
+bool checkId(const uint8_t *data, const char *id)
+{
+    return std::memcmp(data, id, 4) == 0;
+}
+
+uint16_t readUint16(const uint8_t *data)
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+uint32_t readUint32(const uint8_t *data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+uint64_t readUint64(const uint8_t *data)
+{
+    return static_cast<uint64_t>(readUint32(data)) | (static_cast<uint64_t>(readUint32(data + 4)) << 32);
+}
+
+SampleFormat getSampleFormat(const uint16_t formatTag, const uint16_t bitsPerSample)
+{
+    if((formatTag == waveFormatPcm) && (bitsPerSample == 16))
+    {
+        return SampleFormat::Int16;
+    }
+    if((formatTag == waveFormatPcm) && (bitsPerSample == 24))
+    {
+        return SampleFormat::Int24;
+    }
+    if((formatTag == waveFormatPcm) && (bitsPerSample == 32))
+    {
+        return SampleFormat::Int32;
+    }
+    if((formatTag == waveFormatIeeeFloat) && (bitsPerSample == 32))
+    {
+        return SampleFormat::Float32;
+    }
+
+    throw std::runtime_error("Unsupported WAVE encoding: format " + std::to_string(formatTag) + ", " + std::to_string(bitsPerSample) + " bits per sample");
+}
+
+}
+
+uint32_t getBytesPerSample(const SampleFormat sampleFormat)
+{
+    switch(sampleFormat)
+    {
+        case SampleFormat::Int16:
+            return 2;
+        case SampleFormat::Int24:
+            return 3;
+        case SampleFormat::Int32:
+        case SampleFormat::Float32:
+            return 4;
+    }
+
+    return 0;
+}
+
+std::optional<AudioFileLayout> parseWaveFile(const uint8_t *data, const size_t size)
+{
+    if((size < 12) || !(checkId(data, "RIFF") || checkId(data, "RF64")) || !checkId(data + 8, "WAVE"))
+    {
+        return std::nullopt;
+    }
+
+    AudioFileLayout layout;
+    std::optional<uint64_t> dataSizeFromDs64;
+    bool formatFound{false};
+    bool dataFound{false};
+    size_t dataSize{0};
+    size_t offset{12};
+
+    while((offset + chunkHeaderSize <= size) && !dataFound)
+    {
+        const uint8_t *chunk = data + offset;
+        const uint32_t chunkSize = readUint32(chunk + 4);
+        const uint8_t *chunkData = chunk + chunkHeaderSize;
+        const size_t availableChunkSize = size - offset - chunkHeaderSize;
+
+        if(checkId(chunk, "ds64") && (availableChunkSize >= 16))
+        {
+            dataSizeFromDs64 = readUint64(chunkData + 8);
+        }
+        else if(checkId(chunk, "fmt ") && (availableChunkSize >= 16))
+        {
+            uint16_t formatTag = readUint16(chunkData);
+            const uint16_t bitsPerSample = readUint16(chunkData + 14);
+
+            if((formatTag == waveFormatExtensible) && (chunkSize >= 40) && (availableChunkSize >= 40))
+            {
+                // the first two bytes of the sub format GUID hold the actual format tag
+                formatTag = readUint16(chunkData + 24);
+            }
+
+            layout.numberOfChannels = readUint16(chunkData + 2);
+            layout.samplingRate = readUint32(chunkData + 4);
+            layout.sampleFormat = getSampleFormat(formatTag, bitsPerSample);
+
+            const uint16_t blockAlign = readUint16(chunkData + 12);
+
+            if((layout.numberOfChannels == 0) || (blockAlign != layout.numberOfChannels * getBytesPerSample(layout.sampleFormat)))
+            {
+                throw std::runtime_error("Unsupported WAVE layout: " + std::to_string(layout.numberOfChannels) + " channels, block align " + std::to_string(blockAlign));
+            }
+
+            formatFound = true;
+        }
+        else if(checkId(chunk, "data"))
+        {
+            layout.dataOffset = offset + chunkHeaderSize;
+            dataSize = ((chunkSize == sizeStoredInDs64Chunk) && dataSizeFromDs64) ? *dataSizeFromDs64 : chunkSize;
+            dataFound = true;
+        }
+
+        // chunks are word aligned
+        offset += chunkHeaderSize + chunkSize + (chunkSize & 1);
+    }
+
+    if(!formatFound || !dataFound)
+    {
+        throw std::runtime_error("WAVE file without fmt or data chunk");
+    }
+
+    // a truncated recording still plays up to its last complete frame
+    dataSize = std::min(dataSize, size - layout.dataOffset);
+    layout.numberOfFrames = dataSize / (layout.numberOfChannels * getBytesPerSample(layout.sampleFormat));
+
+    return layout;
+}
+
+AudioFileLayout getRawFileLayout(const size_t size, const SampleFormat sampleFormat, const uint16_t numberOfChannels, const uint32_t samplingRate)
+{
+    AudioFileLayout layout;
+
+    layout.sampleFormat = sampleFormat;
+    layout.numberOfChannels = std::max<uint16_t>(numberOfChannels, 1);
+    layout.samplingRate = samplingRate;
+    layout.dataOffset = 0;
+    layout.numberOfFrames = size / (layout.numberOfChannels * getBytesPerSample(sampleFormat));
+
+    return layout;
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "../CommonTypes.hpp"
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+struct AudioFileLayout
+{
+    SampleFormat sampleFormat{SampleFormat::Int16};
+    uint16_t numberOfChannels{0};
+    uint32_t samplingRate{0};
+    size_t dataOffset{0};
+    size_t numberOfFrames{0};
+};
+
+uint32_t getBytesPerSample(const SampleFormat sampleFormat);
+
+// Describes where the samples of a RIFF/RF64 WAVE file are located. Returns nothing if the
+// buffer does not start with a RIFF or RF64 header and throws std::runtime_error if the
+// header is recognized but the encoding is not supported.
+std::optional<AudioFileLayout> parseWaveFile(const uint8_t *data, const size_t size);
+
+// Describes a headerless file with interleaved little endian samples.
+AudioFileLayout getRawFileLayout(const size_t size, const SampleFormat sampleFormat, const uint16_t numberOfChannels, const uint32_t samplingRate);
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Helper process started from an executable. The process is killed when the object
+// is destroyed, so it never outlives its owner.
+class ChildProcess
+{
+public:
+    ChildProcess(const std::string &executablePath, const std::vector<std::string> &arguments);
+    ChildProcess(const ChildProcess &) = delete;
+    ChildProcess& operator=(const ChildProcess &) = delete;
+    ~ChildProcess();
+
+    bool start();
+    bool isRunning();
+    void terminate();
+    uint64_t getProcessId() const;
+
+    static uint64_t getCurrentProcessId();
+    static bool checkIfParentIsAlive(uint64_t parentProcessId);
+
+    // path of an executable installed next to the running one
+    static std::string getSiblingExecutablePath(const std::string &executableName);
+
+private:
+    const std::string executablePath;
+    const std::vector<std::string> arguments;
+    uint64_t processId{0};
+    void *processHandle{nullptr};
+};
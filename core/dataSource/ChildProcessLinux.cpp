@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "ChildProcess.hpp"
+#include <spawn.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+
+extern char **environ;
+
+ChildProcess::ChildProcess(const std::string &executablePath, const std::vector<std::string> &arguments):
+    executablePath(executablePath),
+    arguments(arguments)
+{
+}
+
+ChildProcess::~ChildProcess()
+{
+    terminate();
+}
+
+bool ChildProcess::start()
+{
+    terminate();
+
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>(executablePath.c_str()));
+
+    for(const auto &argument : arguments)
+    {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+
+    argv.push_back(nullptr);
+
+    pid_t pid{0};
+    const int result = posix_spawn(&pid, executablePath.c_str(), nullptr, nullptr, argv.data(), environ);
+
+    if(result != 0)
+    {
+        std::cout<<"ERROR: cannot start process: "<<executablePath<<": "<<std::strerror(result)<<std::endl;
+        return false;
+    }
+
+    processId = pid;
+    return true;
+}
+
+bool ChildProcess::isRunning()
+{
+    if(processId == 0)
+    {
+        return false;
+    }
+
+    int status{0};
+
+    if(waitpid(static_cast<pid_t>(processId), &status, WNOHANG) == 0)
+    {
+        return true;
+    }
+
+    // the process has exited and has been reaped
+    processId = 0;
+    return false;
+}
+
+void ChildProcess::terminate()
+{
+    if(processId == 0)
+    {
+        return;
+    }
+
+    kill(static_cast<pid_t>(processId), SIGKILL);
+
+    int status{0};
+    while((waitpid(static_cast<pid_t>(processId), &status, 0) < 0) && (errno == EINTR))
+    {
+    }
+
+    processId = 0;
+}
+
+uint64_t ChildProcess::getProcessId() const
+{
+    return processId;
+}
+
+uint64_t ChildProcess::getCurrentProcessId()
+{
+    return static_cast<uint64_t>(getpid());
+}
+
+bool ChildProcess::checkIfParentIsAlive(uint64_t parentProcessId)
+{
+    // an orphaned process is adopted by init or a subreaper
+    return static_cast<uint64_t>(getppid()) == parentProcessId;
+}
+
+std::string ChildProcess::getSiblingExecutablePath(const std::string &executableName)
+{
+    char path[PATH_MAX]{};
+    const auto length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+
+    if(length <= 0)
+    {
+        return executableName;
+    }
+
+    std::string directory(path, length);
+    return directory.substr(0, directory.find_last_of('/') + 1) + executableName;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "ChildProcess.hpp"
+#include <windows.h>
+#include <iostream>
+
+ChildProcess::ChildProcess(const std::string &executablePath, const std::vector<std::string> &arguments):
+    executablePath(executablePath),
+    arguments(arguments)
+{
+}
+
+ChildProcess::~ChildProcess()
+{
+    terminate();
+}
+
+bool ChildProcess::start()
+{
+    terminate();
+
+    std::string commandLine = "\"" + executablePath + "\"";
+
+    for(const auto &argument : arguments)
+    {
+        commandLine += " \"" + argument + "\"";
+    }
+
+    STARTUPINFOA startupInfo{};
+    startupInfo.cb = sizeof(startupInfo);
+    PROCESS_INFORMATION processInformation{};
+
+    if(!CreateProcessA(executablePath.c_str(), commandLine.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startupInfo, &processInformation))
+    {
+        std::cout<<"ERROR: cannot start process: "<<executablePath<<" error code: "<<GetLastError()<<std::endl;
+        return false;
+    }
+
+    CloseHandle(processInformation.hThread);
+    processHandle = processInformation.hProcess;
+    processId = processInformation.dwProcessId;
+    return true;
+}
+
+bool ChildProcess::isRunning()
+{
+    if(processHandle == nullptr)
+    {
+        return false;
+    }
+
+    if(WaitForSingleObject(static_cast<HANDLE>(processHandle), 0) == WAIT_TIMEOUT)
+    {
+        return true;
+    }
+
+    CloseHandle(static_cast<HANDLE>(processHandle));
+    processHandle = nullptr;
+    processId = 0;
+    return false;
+}
+
+void ChildProcess::terminate()
+{
+    if(processHandle == nullptr)
+    {
+        return;
+    }
+
+    TerminateProcess(static_cast<HANDLE>(processHandle), 1);
+    WaitForSingleObject(static_cast<HANDLE>(processHandle), INFINITE);
+    CloseHandle(static_cast<HANDLE>(processHandle));
+    processHandle = nullptr;
+    processId = 0;
+}
+
+uint64_t ChildProcess::getProcessId() const
+{
+    return processId;
+}
+
+uint64_t ChildProcess::getCurrentProcessId()
+{
+    return GetCurrentProcessId();
+}
+
+bool ChildProcess::checkIfParentIsAlive(uint64_t parentProcessId)
+{
+    HANDLE parent = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(parentProcessId));
+
+    if(parent == nullptr)
+    {
+        return false;
+    }
+
+    const bool alive = (WaitForSingleObject(parent, 0) == WAIT_TIMEOUT);
+    CloseHandle(parent);
+    return alive;
+}
+
+std::string ChildProcess::getSiblingExecutablePath(const std::string &executableName)
+{
+    char path[MAX_PATH]{};
+    const auto length = GetModuleFileNameA(nullptr, path, MAX_PATH);
+
+    if(length == 0)
+    {
+        return executableName + ".exe";
+    }
+
+    std::string directory(path, length);
+    return directory.substr(0, directory.find_last_of("\\/") + 1) + executableName + ".exe";
+}
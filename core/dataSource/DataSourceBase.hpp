@@ -6,13 +6,17 @@
 
 #pragma once
 
+#include "../CommonTypes.hpp"
 #include <vector>
+#include <chrono>
 #include <cstdint>
 
 struct StereoData
 {
     std::vector<float> left;
     std::vector<float> right;
+    // when the newest sample of the block was captured, left empty if the source does not know
+    std::chrono::steady_clock::time_point captureTime{};
 };
 
 class DataSourceBase
@@ -24,6 +28,13 @@ public:
     bool virtual checkIfErrorOccured()=0;
     virtual StereoData collectStereoDataFromHw() =0;
 
+    // Sources which are not paced by a clock deliver data as fast as they are asked for,
+    // so the caller has to apply backpressure itself.
+    virtual bool isRealtime() { return true; }
+
+    // format of the delivered samples, it decides how quiet a signal can be shown
+    virtual SampleFormat getSampleFormat() const { return SampleFormat::Int16; }
+
 protected:
     uint8_t static constexpr numberOfChannels{2};
     uint32_t dataLength{0};
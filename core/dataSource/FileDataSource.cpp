@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FileDataSource.hpp"
+#include "SampleConverter.hpp"
+#include <iostream>
+#include <thread>
+#include <stdexcept>
+
+using namespace std::chrono;
+
+FileDataSource::FileDataSource(const std::string &path, const FilePlayback &playback):
+    path(path),
+    playback(playback)
+{
+}
+
+bool FileDataSource::initialize(uint32_t numberOfSamples, uint32_t samplingRate)
+{
+    dataLength = numberOfSamples;
+    position = 0;
+    endOfFileReached = false;
+    errorOccured = !openFile(samplingRate);
+
+    blockDuration = duration_cast<nanoseconds>(duration<double>(static_cast<double>(dataLength) / samplingRate));
+    nextBlockTime = steady_clock::now();
+
+    return !errorOccured;
+}
+
+bool FileDataSource::openFile(uint32_t samplingRate)
+{
+    file = std::make_unique<MappedFile>(path);
+
+    if(!file->isMapped())
+    {
+        return false;
+    }
+
+    try
+    {
+        const auto waveLayout = parseWaveFile(file->getData(), file->getSize());
+        layout = waveLayout ? *waveLayout : getRawFileLayout(file->getSize(), playback.rawSampleFormat, playback.rawNumberOfChannels, samplingRate);
+    }
+    catch(const std::exception &exception)
+    {
+        std::cout<<"ERROR: "<<path<<": "<<exception.what()<<std::endl;
+        return false;
+    }
+
+    if(layout.numberOfFrames < dataLength)
+    {
+        std::cout<<"ERROR: "<<path<<" is shorter than a single block of "<<dataLength<<" samples"<<std::endl;
+        return false;
+    }
+
+    if(layout.samplingRate != samplingRate)
+    {
+        std::cout<<"WARNING: "<<path<<" is sampled at "<<layout.samplingRate<<" Hz but SamplingRate is "<<samplingRate<<" Hz, frequencies will be shown scaled"<<std::endl;
+    }
+
+    frameSize = layout.numberOfChannels * getBytesPerSample(layout.sampleFormat);
+
+    std::cout<<"Playing "<<path<<": "<<layout.numberOfChannels<<" channels, "<<getBytesPerSample(layout.sampleFormat)<<" bytes per sample, "<<layout.numberOfFrames<<" frames"<<std::endl;
+
+    return true;
+}
+
+bool FileDataSource::checkIfErrorOccured()
+{
+    return errorOccured;
+}
+
+bool FileDataSource::isRealtime()
+{
+    return playback.realtimePacing;
+}
+
+SampleFormat FileDataSource::getSampleFormat() const
+{
+    return layout.sampleFormat;
+}
+
+const AudioFileLayout& FileDataSource::getLayout() const
+{
+    return layout;
+}
+
+bool FileDataSource::checkIfEndOfFileReached() const
+{
+    return endOfFileReached;
+}
+
+StereoData FileDataSource::collectStereoDataFromHw()
+{
+    if(position + dataLength > layout.numberOfFrames)
+    {
+        if(playback.looping)
+        {
+            position = 0;
+        }
+        else
+        {
+            // nothing is left to analyze, so silence is delivered at the natural pace
+            endOfFileReached = true;
+            std::this_thread::sleep_for(blockDuration);
+            return StereoData{};
+        }
+    }
+
+    StereoData data{std::vector<float>(dataLength), std::vector<float>(dataLength)};
+
+    extractStereo(file->getData() + layout.dataOffset + position * frameSize, layout.sampleFormat, layout.numberOfChannels, data.left.data(), data.right.data(), dataLength);
+    position += dataLength;
+
+    if(playback.realtimePacing)
+    {
+        waitForNextBlock();
+    }
+
+    return data;
+}
+
+void FileDataSource::waitForNextBlock()
+{
+    nextBlockTime += blockDuration;
+
+    const auto now = steady_clock::now();
+
+    // after a stall the schedule is restarted instead of bursting to catch up
+    if(nextBlockTime < now - 100ms)
+    {
+        nextBlockTime = now;
+    }
+
+    std::this_thread::sleep_until(nextBlockTime);
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "DataSourceBase.hpp"
+#include "AudioFileParser.hpp"
+#include "MappedFile.hpp"
+#include <memory>
+#include <string>
+#include <chrono>
+
+class FileDataSource : public DataSourceBase
+{
+public:
+    FileDataSource(const std::string &path, const FilePlayback &playback);
+    bool initialize(uint32_t numberOfSamples, uint32_t samplingRate) override;
+    bool checkIfErrorOccured() override;
+    StereoData collectStereoDataFromHw() override;
+    bool isRealtime() override;
+    SampleFormat getSampleFormat() const override;
+
+    const AudioFileLayout& getLayout() const;
+    bool checkIfEndOfFileReached() const;
+
+private:
+    bool openFile(uint32_t samplingRate);
+    void waitForNextBlock();
+
+    const std::string path;
+    const FilePlayback playback;
+    std::unique_ptr<MappedFile> file;
+    AudioFileLayout layout;
+    size_t frameSize{0};
+    size_t position{0};
+    bool endOfFileReached{false};
+    bool errorOccured{false};
+    std::chrono::nanoseconds blockDuration{0};
+    std::chrono::steady_clock::time_point nextBlockTime;
+};
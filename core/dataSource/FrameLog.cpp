@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FrameLog.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace
+{
+
+constexpr char magic[4]{'S', 'A', 'F', 'L'};
+constexpr uint32_t version{1};
+constexpr size_t headerSize{12};
+constexpr size_t recordHeaderSize{12};
+constexpr size_t channelHeaderSize{5};
+
+// integers up to 2^24 are exact in a float
+constexpr float maxLosslessMagnitude{16777216.0f};
+constexpr uint32_t maxRiceQuotient{32};
+constexpr uint32_t maxRiceParameter{30};
+// every channel of a record takes at least one bit per sample
+constexpr size_t minNumberOfSamplesPerByte{8};
+
+enum class ChannelCoding : uint8_t
+{
+    Float32 = 0,
+    Int16 = 1,
+    Rice = 2
+};
+
+template<typename T>
+void append(std::vector<uint8_t> &bytes, T value)
+{
+    uint8_t buffer[sizeof(T)];
+    std::memcpy(buffer, &value, sizeof(T));
+    bytes.insert(bytes.end(), buffer, buffer + sizeof(T));
+}
+
+template<typename T>
+T load(const uint8_t *data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+class BitWriter
+{
+public:
+    BitWriter(std::vector<uint8_t> &bytes) : bytes(bytes)
+    {
+    }
+
+    ~BitWriter()
+    {
+        if(numberOfBits > 0)
+        {
+            bytes.push_back(static_cast<uint8_t>(accumulator << (8 - numberOfBits)));
+        }
+    }
+
+    void write(uint64_t value, uint32_t count)
+    {
+        for(uint32_t i=count; i>0; --i)
+        {
+            accumulator = (accumulator << 1) | ((value >> (i - 1)) & 1);
+
+            if(++numberOfBits == 8)
+            {
+                bytes.push_back(static_cast<uint8_t>(accumulator));
+                accumulator = 0;
+                numberOfBits = 0;
+            }
+        }
+    }
+
+private:
+    std::vector<uint8_t> &bytes;
+    uint32_t accumulator{0};
+    uint32_t numberOfBits{0};
+};
+
+class BitReader
+{
+public:
+    BitReader(const uint8_t *data, size_t size) : data(data), size(size)
+    {
+    }
+
+    uint64_t read(uint32_t count)
+    {
+        uint64_t value{0};
+
+        for(uint32_t i=0; i<count; ++i)
+        {
+            if(position >= size * 8)
+            {
+                throw std::runtime_error("truncated Rice coded block");
+            }
+
+            value = (value << 1) | ((data[position / 8] >> (7 - position % 8)) & 1);
+            ++position;
+        }
+        return value;
+    }
+
+private:
+    const uint8_t *data;
+    const size_t size;
+    size_t position{0};
+};
+
+bool checkIfIntegerSamples(const std::vector<float> &channel)
+{
+    return std::all_of(channel.begin(), channel.end(), [](float value)
+    {
+        return (std::fabs(value) < maxLosslessMagnitude) && (value == std::nearbyint(value));
+    });
+}
+
+// residual of the fixed second order predictor 2*x[n-1] - x[n-2], zigzag mapped to unsigned
+std::vector<uint64_t> getResiduals(const std::vector<float> &channel)
+{
+    std::vector<uint64_t> residuals(channel.size());
+    int64_t previous{0};
+    int64_t beforePrevious{0};
+
+    for(size_t i=0; i<channel.size(); ++i)
+    {
+        const auto value = static_cast<int64_t>(channel[i]);
+        const auto residual = value - 2 * previous + beforePrevious;
+
+        residuals[i] = (residual < 0) ? ((static_cast<uint64_t>(-residual) << 1) - 1) : (static_cast<uint64_t>(residual) << 1);
+        beforePrevious = previous;
+        previous = value;
+    }
+    return residuals;
+}
+
+uint32_t getRiceParameter(const std::vector<uint64_t> &residuals)
+{
+    uint64_t sum{0};
+
+    for(const auto residual : residuals)
+    {
+        sum += residual;
+    }
+
+    const auto mean = residuals.empty() ? 0 : sum / residuals.size();
+    uint32_t parameter{0};
+
+    while((parameter < maxRiceParameter) && ((1ull << (parameter + 1)) <= mean))
+    {
+        ++parameter;
+    }
+    return parameter;
+}
+
+void encodeRice(const std::vector<float> &channel, std::vector<uint8_t> &payload)
+{
+    const auto residuals = getResiduals(channel);
+    const auto parameter = getRiceParameter(residuals);
+
+    payload.push_back(static_cast<uint8_t>(parameter));
+
+    BitWriter writer(payload);
+
+    for(const auto residual : residuals)
+    {
+        const auto quotient = residual >> parameter;
+
+        if(quotient < maxRiceQuotient)
+        {
+            writer.write((1ull << (quotient + 1)) - 2, quotient + 1);
+            writer.write(residual, parameter);
+        }
+        else
+        {
+            // escape: a run of ones too long for a plain code is followed by the whole residual
+            writer.write((1ull << maxRiceQuotient) - 1, maxRiceQuotient);
+            writer.write(residual, 64);
+        }
+    }
+}
+
+void decodeRice(const uint8_t *payload, size_t size, std::vector<float> &channel)
+{
+    if(size < 1)
+    {
+        throw std::runtime_error("empty Rice coded block");
+    }
+
+    const uint32_t parameter = payload[0];
+
+    if(parameter > maxRiceParameter)
+    {
+        throw std::runtime_error("invalid Rice parameter");
+    }
+
+    BitReader reader(payload + 1, size - 1);
+    int64_t previous{0};
+    int64_t beforePrevious{0};
+
+    for(auto &sample : channel)
+    {
+        uint32_t quotient{0};
+
+        while((quotient < maxRiceQuotient) && reader.read(1))
+        {
+            ++quotient;
+        }
+
+        const uint64_t residual = (quotient < maxRiceQuotient) ? ((static_cast<uint64_t>(quotient) << parameter) | reader.read(parameter)) : reader.read(64);
+        const int64_t signedResidual = (residual & 1) ? -static_cast<int64_t>((residual + 1) >> 1) : static_cast<int64_t>(residual >> 1);
+        const int64_t value = signedResidual + 2 * previous - beforePrevious;
+
+        sample = static_cast<float>(value);
+        beforePrevious = previous;
+        previous = value;
+    }
+}
+
+}
+
+FrameLogWriter::FrameLogWriter(const std::string &path, uint32_t samplingRate, FrameLogEncoding encoding):
+    file(path, std::ios::binary | std::ios::trunc),
+    encoding(encoding)
+{
+    if(!file)
+    {
+        std::cout<<"ERROR: cannot create frame log: "<<path<<std::endl;
+        return;
+    }
+
+    std::vector<uint8_t> header(magic, magic + sizeof(magic));
+    append<uint32_t>(header, version);
+    append<uint32_t>(header, samplingRate);
+
+    file.write(reinterpret_cast<const char*>(header.data()), header.size());
+}
+
+bool FrameLogWriter::isOpen() const
+{
+    return static_cast<bool>(file);
+}
+
+void FrameLogWriter::write(const StereoData &data, std::chrono::nanoseconds captureTime)
+{
+    payload.clear();
+
+    append<uint64_t>(payload, captureTime.count());
+    append<uint32_t>(payload, data.left.size());
+
+    writeChannel(data.left);
+    writeChannel(data.right);
+
+    file.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+}
+
+void FrameLogWriter::writeChannel(const std::vector<float> &channel)
+{
+    const auto headerPosition = payload.size();
+    payload.resize(headerPosition + channelHeaderSize);
+
+    ChannelCoding coding{ChannelCoding::Float32};
+
+    if((encoding == FrameLogEncoding::Lossless) && checkIfIntegerSamples(channel))
+    {
+        coding = ChannelCoding::Rice;
+        encodeRice(channel, payload);
+    }
+    else if(encoding == FrameLogEncoding::Int16)
+    {
+        coding = ChannelCoding::Int16;
+
+        for(const auto sample : channel)
+        {
+            append<int16_t>(payload, static_cast<int16_t>(std::clamp(std::nearbyint(sample), -32768.0f, 32767.0f)));
+        }
+    }
+    else
+    {
+        for(const auto sample : channel)
+        {
+            append<float>(payload, sample);
+        }
+    }
+
+    const uint32_t payloadSize = payload.size() - headerPosition - channelHeaderSize;
+    payload[headerPosition] = static_cast<uint8_t>(coding);
+    std::memcpy(payload.data() + headerPosition + 1, &payloadSize, sizeof(payloadSize));
+}
+
+FrameLogReader::FrameLogReader(const std::string &path) : file(path)
+{
+    if(!file.isMapped())
+    {
+        return;
+    }
+
+    if((file.getSize() < headerSize) || (std::memcmp(file.getData(), magic, sizeof(magic)) != 0) || (load<uint32_t>(file.getData() + 4) != version))
+    {
+        std::cout<<"ERROR: "<<path<<" is not a frame log"<<std::endl;
+        return;
+    }
+
+    samplingRate = load<uint32_t>(file.getData() + 8);
+    position = headerSize;
+    valid = true;
+}
+
+bool FrameLogReader::isOpen() const
+{
+    return valid;
+}
+
+uint32_t FrameLogReader::getSamplingRate() const
+{
+    return samplingRate;
+}
+
+void FrameLogReader::rewind()
+{
+    position = headerSize;
+}
+
+std::optional<FrameLogRecord> FrameLogReader::readNext()
+{
+    if(!valid || (position + recordHeaderSize > file.getSize()))
+    {
+        return std::nullopt;
+    }
+
+    const auto *data = file.getData() + position;
+    const auto numberOfSamples = load<uint32_t>(data + 8);
+    const auto remainingSize = file.getSize() - position - recordHeaderSize;
+
+    // checked before anything is allocated for a damaged number of samples
+    if(numberOfSamples > remainingSize * minNumberOfSamplesPerByte)
+    {
+        throw std::runtime_error("frame log record larger than the file");
+    }
+
+    FrameLogRecord record{std::chrono::nanoseconds(load<uint64_t>(data)), StereoData{std::vector<float>(numberOfSamples), std::vector<float>(numberOfSamples)}};
+
+    position += recordHeaderSize;
+
+    if(!readChannel(record.data.left) || !readChannel(record.data.right))
+    {
+        throw std::runtime_error("truncated frame log record");
+    }
+
+    return record;
+}
+
+bool FrameLogReader::readChannel(std::vector<float> &channel)
+{
+    if(position + channelHeaderSize > file.getSize())
+    {
+        return false;
+    }
+
+    const auto *data = file.getData() + position;
+    const auto coding = static_cast<ChannelCoding>(data[0]);
+    const auto payloadSize = load<uint32_t>(data + 1);
+    const auto *payload = data + channelHeaderSize;
+
+    if(position + channelHeaderSize + payloadSize > file.getSize())
+    {
+        return false;
+    }
+
+    position += channelHeaderSize + payloadSize;
+
+    switch(coding)
+    {
+    case ChannelCoding::Float32:
+        if(payloadSize != channel.size() * sizeof(float))
+        {
+            return false;
+        }
+        std::memcpy(channel.data(), payload, payloadSize);
+        return true;
+    case ChannelCoding::Int16:
+        if(payloadSize != channel.size() * sizeof(int16_t))
+        {
+            return false;
+        }
+        for(size_t i=0; i<channel.size(); ++i)
+        {
+            channel[i] = load<int16_t>(payload + i * sizeof(int16_t));
+        }
+        return true;
+    case ChannelCoding::Rice:
+        decodeRice(payload, payloadSize, channel);
+        return true;
+    default:
+        throw std::runtime_error("unknown frame log channel coding");
+    }
+}
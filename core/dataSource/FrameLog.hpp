@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "DataSourceBase.hpp"
+#include "MappedFile.hpp"
+#include "CommonTypes.hpp"
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Frame log layout (little endian): "SAFL", uint32 version, uint32 sampling rate, then for
+// every block: uint64 capture time in nanoseconds since the first block, uint32 number of
+// samples and for the left and the right channel: uint8 coding, uint32 payload size, payload.
+// Codings: 32-bit float, 16-bit integer and Rice coded residuals of a second order predictor
+// (used by the lossless encoding for blocks holding integer samples only).
+
+struct FrameLogRecord
+{
+    std::chrono::nanoseconds captureTime;
+    StereoData data;
+};
+
+class FrameLogWriter
+{
+public:
+    FrameLogWriter(const std::string &path, uint32_t samplingRate, FrameLogEncoding encoding);
+    bool isOpen() const;
+    void write(const StereoData &data, std::chrono::nanoseconds captureTime);
+
+private:
+    void writeChannel(const std::vector<float> &channel);
+
+    std::ofstream file;
+    const FrameLogEncoding encoding;
+    std::vector<uint8_t> payload;
+};
+
+class FrameLogReader
+{
+public:
+    FrameLogReader(const std::string &path);
+    bool isOpen() const;
+    uint32_t getSamplingRate() const;
+
+    // Returns nothing at the end of the log, throws std::runtime_error for a damaged record.
+    std::optional<FrameLogRecord> readNext();
+    void rewind();
+
+private:
+    bool readChannel(std::vector<float> &channel);
+
+    MappedFile file;
+    bool valid{false};
+    uint32_t samplingRate{0};
+    size_t position{0};
+};
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "FrameLogDataSource.hpp"
+#include <iostream>
+#include <thread>
+#include <stdexcept>
+
+using namespace std::chrono;
+
+FrameLogDataSource::FrameLogDataSource(const std::string &path, const bool originalTiming):
+    path(path),
+    originalTiming(originalTiming)
+{
+}
+
+bool FrameLogDataSource::initialize(uint32_t numberOfSamples, uint32_t samplingRate)
+{
+    dataLength = numberOfSamples;
+    endOfLogReached = false;
+    reader = std::make_unique<FrameLogReader>(path);
+    errorOccured = !reader->isOpen();
+
+    if(errorOccured)
+    {
+        return false;
+    }
+
+    if(reader->getSamplingRate() != samplingRate)
+    {
+        std::cout<<"WARNING: "<<path<<" was recorded at "<<reader->getSamplingRate()<<" Hz but SamplingRate is "<<samplingRate<<" Hz, frequencies will be shown scaled"<<std::endl;
+    }
+
+    replayStartTime = steady_clock::now();
+
+    return true;
+}
+
+bool FrameLogDataSource::checkIfErrorOccured()
+{
+    return errorOccured;
+}
+
+bool FrameLogDataSource::isRealtime()
+{
+    return originalTiming;
+}
+
+SampleFormat FrameLogDataSource::getSampleFormat() const
+{
+    return SampleFormat::Float32;
+}
+
+bool FrameLogDataSource::checkIfEndOfLogReached() const
+{
+    return endOfLogReached;
+}
+
+StereoData FrameLogDataSource::collectStereoDataFromHw()
+{
+    auto record = readNextRecord();
+
+    if(!record)
+    {
+        return StereoData{};
+    }
+
+    if(originalTiming)
+    {
+        // blocks keep their recorded spacing, a slow consumer delays the rest of the replay
+        const auto releaseTime = replayStartTime + record->captureTime;
+        const auto now = steady_clock::now();
+
+        if(releaseTime < now - 100ms)
+        {
+            replayStartTime += now - releaseTime;
+        }
+
+        std::this_thread::sleep_until(replayStartTime + record->captureTime);
+    }
+
+    return std::move(record->data);
+}
+
+std::optional<FrameLogRecord> FrameLogDataSource::readNextRecord()
+{
+    try
+    {
+        auto record = reader->readNext();
+
+        if(!record)
+        {
+            endOfLogReached = true;
+            reader->rewind();
+            replayStartTime = steady_clock::now();
+            record = reader->readNext();
+        }
+
+        return record;
+    }
+    catch(const std::exception &exception)
+    {
+        std::cout<<"ERROR: "<<path<<": "<<exception.what()<<std::endl;
+        errorOccured = true;
+        return std::nullopt;
+    }
+}
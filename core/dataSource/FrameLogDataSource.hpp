@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "DataSourceBase.hpp"
+#include "FrameLog.hpp"
+#include <memory>
+#include <string>
+#include <chrono>
+
+// Replays a frame log block by block, exactly as the blocks were recorded, either with the
+// recorded timing or as fast as the pipeline consumes them. The log is replayed in a loop.
+class FrameLogDataSource : public DataSourceBase
+{
+public:
+    FrameLogDataSource(const std::string &path, const bool originalTiming);
+    bool initialize(uint32_t numberOfSamples, uint32_t samplingRate) override;
+    bool checkIfErrorOccured() override;
+    StereoData collectStereoDataFromHw() override;
+    bool isRealtime() override;
+    SampleFormat getSampleFormat() const override;
+
+    bool checkIfEndOfLogReached() const;
+
+private:
+    std::optional<FrameLogRecord> readNextRecord();
+
+    const std::string path;
+    const bool originalTiming;
+    std::unique_ptr<FrameLogReader> reader;
+    bool errorOccured{false};
+    bool endOfLogReached{false};
+    std::chrono::steady_clock::time_point replayStartTime;
+};
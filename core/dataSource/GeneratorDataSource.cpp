@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "GeneratorDataSource.hpp"
+#include <thread>
+
+using namespace std::chrono;
+
+bool checkIfGeneratorEnabled(const GeneratorSignal &leftSignal, const GeneratorSignal &rightSignal)
+{
+    return (leftSignal.type != SignalType::Off) || (rightSignal.type != SignalType::Off);
+}
+
+GeneratorDataSource::GeneratorDataSource(const GeneratorSignal &leftSignal, const GeneratorSignal &rightSignal, const bool realtimePacing):
+    leftSignal(leftSignal),
+    rightSignal(rightSignal),
+    realtimePacing(realtimePacing)
+{
+}
+
+bool GeneratorDataSource::initialize(uint32_t numberOfSamples, uint32_t samplingRate)
+{
+    dataLength = numberOfSamples;
+
+    leftGenerator = std::make_unique<SignalGenerator>(leftSignal, samplingRate);
+    rightGenerator = std::make_unique<SignalGenerator>(rightSignal, samplingRate);
+
+    blockDuration = duration_cast<nanoseconds>(duration<double>(static_cast<double>(dataLength) / samplingRate));
+    nextBlockTime = steady_clock::now();
+
+    return true;
+}
+
+bool GeneratorDataSource::checkIfErrorOccured()
+{
+    return false;
+}
+
+bool GeneratorDataSource::isRealtime()
+{
+    return realtimePacing;
+}
+
+SampleFormat GeneratorDataSource::getSampleFormat() const
+{
+    return SampleFormat::Float32;
+}
+
+StereoData GeneratorDataSource::collectStereoDataFromHw()
+{
+    StereoData data{std::vector<float>(dataLength), std::vector<float>(dataLength)};
+
+    leftGenerator->generate(data.left.data(), dataLength);
+    rightGenerator->generate(data.right.data(), dataLength);
+
+    if(realtimePacing)
+    {
+        waitForNextBlock();
+    }
+
+    return data;
+}
+
+void GeneratorDataSource::waitForNextBlock()
+{
+    nextBlockTime += blockDuration;
+
+    const auto now = steady_clock::now();
+
+    // after a stall the schedule is restarted instead of bursting to catch up
+    if(nextBlockTime < now - 100ms)
+    {
+        nextBlockTime = now;
+    }
+
+    std::this_thread::sleep_until(nextBlockTime);
+}
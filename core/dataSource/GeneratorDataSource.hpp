@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "DataSourceBase.hpp"
+#include "SignalGenerator.hpp"
+#include <memory>
+#include <chrono>
+
+bool checkIfGeneratorEnabled(const GeneratorSignal &leftSignal, const GeneratorSignal &rightSignal);
+
+// Synthetic stereo signal, each channel configured separately. Without realtime pacing blocks
+// are produced as fast as they are requested, which lets tests and benchmarks drive the
+// pipeline at any rate.
+class GeneratorDataSource : public DataSourceBase
+{
+public:
+    GeneratorDataSource(const GeneratorSignal &leftSignal, const GeneratorSignal &rightSignal, const bool realtimePacing=true);
+    bool initialize(uint32_t numberOfSamples, uint32_t samplingRate) override;
+    bool checkIfErrorOccured() override;
+    StereoData collectStereoDataFromHw() override;
+    bool isRealtime() override;
+    SampleFormat getSampleFormat() const override;
+
+private:
+    void waitForNextBlock();
+
+    const GeneratorSignal leftSignal;
+    const GeneratorSignal rightSignal;
+    const bool realtimePacing;
+    std::unique_ptr<SignalGenerator> leftGenerator;
+    std::unique_ptr<SignalGenerator> rightGenerator;
+    std::chrono::nanoseconds blockDuration{0};
+    std::chrono::steady_clock::time_point nextBlockTime;
+};
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "IsolatedPythonDataSource.hpp"
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+using namespace std::chrono;
+
+namespace
+{
+
+std::string createSharedMemoryName()
+{
+    static std::atomic<uint32_t> counter{0};
+    return "spectrum-analyzer-" + std::to_string(ChildProcess::getCurrentProcessId()) + "-" + std::to_string(counter++);
+}
+
+}
+
+IsolatedPythonDataSource::IsolatedPythonDataSource(const std::string &moduleName, const std::string &workerPath):
+    moduleName(moduleName),
+    workerPath(workerPath),
+    sharedMemoryName(createSharedMemoryName())
+{
+}
+
+IsolatedPythonDataSource::~IsolatedPythonDataSource()
+{
+    stopWorker();
+}
+
+bool IsolatedPythonDataSource::initialize(uint32_t numberOfSamples, uint32_t samplingRate)
+{
+    stopWorker();
+    ring.reset();
+    sharedMemory.reset();
+
+    dataLength = numberOfSamples;
+
+    // a few blocks, so a script delivering irregularly does not have to wait for the analyzer
+    const uint32_t capacity = 8 * numberOfSamples;
+
+    sharedMemory = std::make_unique<SharedMemory>(sharedMemoryName, SharedSamplesRing::calculateSize(capacity));
+    errorOccured = !sharedMemory->isMapped();
+
+    if(errorOccured)
+    {
+        return false;
+    }
+
+    ring = std::make_unique<SharedSamplesRing>(sharedMemory->getData(), capacity, numberOfSamples, samplingRate);
+    worker = std::make_unique<ChildProcess>(workerPath, std::vector<std::string>{sharedMemoryName, moduleName, std::to_string(ChildProcess::getCurrentProcessId())});
+
+    errorOccured = !startWorker() || !waitForWorker();
+
+    if(errorOccured)
+    {
+        stopWorker();
+        return false;
+    }
+
+    std::cout<<"Python data source "<<moduleName<<" runs in process "<<worker->getProcessId()<<std::endl;
+    return true;
+}
+
+bool IsolatedPythonDataSource::checkIfErrorOccured()
+{
+    return errorOccured;
+}
+
+StereoData IsolatedPythonDataSource::collectStereoDataFromHw()
+{
+    if(!ring || !waitForBlock())
+    {
+        return {};
+    }
+
+    StereoData stereoData;
+    stereoData.left.resize(dataLength);
+    stereoData.right.resize(dataLength);
+
+    ring->read(stereoData.left.data(), stereoData.right.data(), dataLength);
+    return stereoData;
+}
+
+uint32_t IsolatedPythonDataSource::getNumberOfRestarts() const
+{
+    return numberOfRestarts;
+}
+
+uint64_t IsolatedPythonDataSource::getWorkerProcessId() const
+{
+    return worker ? worker->getProcessId() : 0;
+}
+
+bool IsolatedPythonDataSource::startWorker()
+{
+    ring->clear();
+    lastHeartbeat = 0;
+    lastHeartbeatTime = workerStartTime = steady_clock::now();
+
+    return worker->start();
+}
+
+void IsolatedPythonDataSource::stopWorker()
+{
+    if(!worker || !ring)
+    {
+        return;
+    }
+
+    ring->getHeader().stopRequested.store(1);
+
+    const auto deadline = steady_clock::now() + milliseconds(500);
+
+    while(worker->isRunning() && (steady_clock::now() < deadline))
+    {
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+
+    worker->terminate();
+}
+
+// the module is imported and initialized before the first block is requested
+bool IsolatedPythonDataSource::waitForWorker()
+{
+    auto &state = ring->getHeader().workerState;
+
+    while(state.load() == static_cast<uint32_t>(WorkerState::Starting))
+    {
+        if(!worker->isRunning() || (steady_clock::now() - workerStartTime > startupTimeout))
+        {
+            std::cout<<"ERROR: Python worker did not start: "<<workerPath<<std::endl;
+            return false;
+        }
+
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+
+    if(state.load() == static_cast<uint32_t>(WorkerState::Failed))
+    {
+        std::cout<<"ERROR: Python worker cannot initialize module: "<<moduleName<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool IsolatedPythonDataSource::waitForBlock()
+{
+    const auto deadline = steady_clock::now() + blockTimeout;
+
+    while(ring->getNumberOfAvailableFrames() < dataLength)
+    {
+        if(!checkIfWorkerIsHealthy())
+        {
+            restartWorker();
+        }
+
+        if(steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+
+        std::this_thread::sleep_for(microseconds(200));
+    }
+
+    return true;
+}
+
+bool IsolatedPythonDataSource::checkIfWorkerIsHealthy()
+{
+    const auto &header = ring->getHeader();
+    const auto now = steady_clock::now();
+    const auto heartbeat = header.heartbeat.load(std::memory_order_relaxed);
+
+    if(heartbeat != lastHeartbeat)
+    {
+        lastHeartbeat = heartbeat;
+        lastHeartbeatTime = now;
+    }
+
+    const auto state = static_cast<WorkerState>(header.workerState.load());
+    const auto timeout = (state == WorkerState::Starting) ? startupTimeout : heartbeatTimeout;
+
+    return (state != WorkerState::Failed) && (now - lastHeartbeatTime < timeout) && worker->isRunning();
+}
+
+void IsolatedPythonDataSource::restartWorker()
+{
+    // a script failing right at the start is not restarted in a busy loop
+    if(steady_clock::now() - workerStartTime < restartDelay)
+    {
+        return;
+    }
+
+    std::cout<<"WARNING: Python worker is not responding, restarting it"<<std::endl;
+
+    worker->terminate();
+    ++numberOfRestarts;
+    startWorker();
+}
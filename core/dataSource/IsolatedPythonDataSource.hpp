@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "DataSourceBase.hpp"
+#include "ChildProcess.hpp"
+#include "SharedMemory.hpp"
+#include "SharedSamplesRing.hpp"
+#include <chrono>
+#include <memory>
+#include <string>
+
+// Runs the Python data source in a spectrum-analyzer-python-worker process. The worker
+// imports the same module, so scripts work unchanged, and writes its blocks into a ring
+// in shared memory. Neither the GIL nor a hung or crashed script can stall the analyzer:
+// a worker which exits, reports a failure or stops bumping its heartbeat is killed and
+// started again, empty blocks are returned meanwhile.
+class IsolatedPythonDataSource : public DataSourceBase
+{
+public:
+    IsolatedPythonDataSource(const std::string &moduleName="audioConfig", const std::string &workerPath=ChildProcess::getSiblingExecutablePath("spectrum-analyzer-python-worker"));
+    ~IsolatedPythonDataSource();
+    bool initialize(uint32_t numberOfSamples, uint32_t samplingRate) override;
+    bool checkIfErrorOccured() override;
+    StereoData collectStereoDataFromHw() override;
+
+    uint32_t getNumberOfRestarts() const;
+    uint64_t getWorkerProcessId() const;
+
+private:
+    bool startWorker();
+    void stopWorker();
+    bool waitForWorker();
+    bool waitForBlock();
+    bool checkIfWorkerIsHealthy();
+    void restartWorker();
+
+    static constexpr std::chrono::milliseconds blockTimeout{100};
+    static constexpr std::chrono::milliseconds heartbeatTimeout{2000};
+    static constexpr std::chrono::milliseconds startupTimeout{10000};
+    static constexpr std::chrono::milliseconds restartDelay{1000};
+
+    const std::string moduleName;
+    const std::string workerPath;
+    const std::string sharedMemoryName;
+    std::unique_ptr<SharedMemory> sharedMemory;
+    std::unique_ptr<SharedSamplesRing> ring;
+    std::unique_ptr<ChildProcess> worker;
+    bool errorOccured{false};
+    uint32_t numberOfRestarts{0};
+    uint64_t lastHeartbeat{0};
+    std::chrono::steady_clock::time_point lastHeartbeatTime;
+    std::chrono::steady_clock::time_point workerStartTime;
+};
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Read-only view of a whole file mapped into the address space.
+class MappedFile
+{
+public:
+    MappedFile(const std::string &path);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile& operator=(const MappedFile &) = delete;
+    ~MappedFile();
+
+    bool isMapped() const;
+    const uint8_t* getData() const;
+    size_t getSize() const;
+
+private:
+    const uint8_t *data{nullptr};
+    size_t size{0};
+    void *mappingHandle{nullptr};
+};
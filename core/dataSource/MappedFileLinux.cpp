@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "MappedFile.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+
+MappedFile::MappedFile(const std::string &path)
+{
+    const int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+    if(fileDescriptor < 0)
+    {
+        std::cout<<"ERROR: cannot open file: "<<path<<": "<<std::strerror(errno)<<std::endl;
+        return;
+    }
+
+    struct stat fileStatus{};
+
+    if((fstat(fileDescriptor, &fileStatus) == 0) && (fileStatus.st_size > 0))
+    {
+        void *address = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        if(address != MAP_FAILED)
+        {
+            madvise(address, fileStatus.st_size, MADV_SEQUENTIAL);
+            data = static_cast<const uint8_t*>(address);
+            size = fileStatus.st_size;
+        }
+        else
+        {
+            std::cout<<"ERROR: cannot map file: "<<path<<": "<<std::strerror(errno)<<std::endl;
+        }
+    }
+    else
+    {
+        std::cout<<"ERROR: file is empty or cannot be read: "<<path<<std::endl;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    close(fileDescriptor);
+}
+
+MappedFile::~MappedFile()
+{
+    if(data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+}
+
+bool MappedFile::isMapped() const
+{
+    return data != nullptr;
+}
+
+const uint8_t* MappedFile::getData() const
+{
+    return data;
+}
+
+size_t MappedFile::getSize() const
+{
+    return size;
+}
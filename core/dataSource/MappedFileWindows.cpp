@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "MappedFile.hpp"
+#include <windows.h>
+#include <iostream>
+
+MappedFile::MappedFile(const std::string &path)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if(file == INVALID_HANDLE_VALUE)
+    {
+        std::cout<<"ERROR: cannot open file: "<<path<<" error code: "<<GetLastError()<<std::endl;
+        return;
+    }
+
+    LARGE_INTEGER fileSize{};
+
+    if(GetFileSizeEx(file, &fileSize) && (fileSize.QuadPart > 0))
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if(mapping != nullptr)
+        {
+            void *address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+            if(address != nullptr)
+            {
+                data = static_cast<const uint8_t*>(address);
+                size = static_cast<size_t>(fileSize.QuadPart);
+                mappingHandle = mapping;
+            }
+            else
+            {
+                std::cout<<"ERROR: cannot map file: "<<path<<" error code: "<<GetLastError()<<std::endl;
+                CloseHandle(mapping);
+            }
+        }
+        else
+        {
+            std::cout<<"ERROR: cannot map file: "<<path<<" error code: "<<GetLastError()<<std::endl;
+        }
+    }
+    else
+    {
+        std::cout<<"ERROR: file is empty or cannot be read: "<<path<<std::endl;
+    }
+
+    // the mapping keeps its own reference to the file
+    CloseHandle(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if(data != nullptr)
+    {
+        UnmapViewOfFile(data);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+    }
+}
+
+bool MappedFile::isMapped() const
+{
+    return data != nullptr;
+}
+
+const uint8_t* MappedFile::getData() const
+{
+    return data;
+}
+
+size_t MappedFile::getSize() const
+{
+    return size;
+}
@@ -8,7 +8,9 @@
 #include <stdexcept>
 
 
-PythonCodeRunner::PythonCodeRunner(const char *moduleName,  const std::vector<std::string> &pythonFunctionsNames): pythonFunctionsNames(pythonFunctionsNames)
+PythonCodeRunner::PythonCodeRunner(const char *moduleName,  const std::vector<std::string> &pythonFunctionsNames, const std::vector<std::string> &optionalPythonFunctionsNames):
+    pythonFunctionsNames(pythonFunctionsNames),
+    optionalPythonFunctionsNames(optionalPythonFunctionsNames)
 {
     Py_Initialize();
 
@@ -51,6 +53,14 @@ void PythonCodeRunner::updateMapOfPointersToPythonFunctions()
     {
         pointersToPythonFunctions.emplace(functionName, getPointerToFunction(functionName.c_str()));
     }
+
+    for(const auto &functionName: optionalPythonFunctionsNames)
+    {
+        if(auto pFunction = getPointerToOptionalFunction(functionName.c_str()))
+        {
+            pointersToPythonFunctions.emplace(functionName, pFunction);
+        }
+    }
 }
 
 PyObject * PythonCodeRunner::getPointerToFunction(const char* functionName)
@@ -68,6 +78,31 @@ PyObject * PythonCodeRunner::getPointerToFunction(const char* functionName)
     return pFunction;
 }
 
+PyObject * PythonCodeRunner::getPointerToOptionalFunction(const char* functionName)
+{
+    if(!PyObject_HasAttrString(pModule, functionName))
+    {
+        return nullptr;
+    }
+
+    return getPointerToFunction(functionName);
+}
+
+PyObject * PythonCodeRunner::callFunction(PyObject *pointerToPythonFunction, PyObject *args)
+{
+    PyObject *pValue = PyObject_CallObject(pointerToPythonFunction, args);
+
+    if (pValue == nullptr)
+    {
+        Py_DECREF(pointerToPythonFunction);
+        Py_DECREF(pModule);
+
+        std::string error("Call failed");
+        throw std::runtime_error(error);
+    }
+    return pValue;
+}
+
 double PythonCodeRunner::getValue(PyObject *pointerToPythonFunction, PyObject *args)
 {
     double value{};
@@ -133,30 +168,38 @@ std::string PythonCodeRunner::getStringValue(PyObject *pointerToPythonFunction)
 
 std::vector<float> PythonCodeRunner::getValues(PyObject *pointerToPythonFunction, PyObject *args)
 {
-      PyObject *pValue = PyObject_CallObject(pointerToPythonFunction, args);
+    PyObject *pValue = callFunction(pointerToPythonFunction, args);
 
-      std::vector<float> values;
+    try
+    {
+        auto values = getValuesFromTuple(pValue);
+        Py_DECREF(pValue);
+        return values;
+    }
+    catch(...)
+    {
+        Py_DECREF(pValue);
+        throw;
+    }
+}
 
-      if (pValue != nullptr)
-      {
-        uint32_t dataSize = PyTuple_GET_SIZE(pValue);
+std::vector<float> PythonCodeRunner::getValuesFromTuple(PyObject *tuple)
+{
+    if(!PyTuple_Check(tuple))
+    {
+        std::string error("A tuple of samples is expected");
+        throw std::runtime_error(error);
+    }
 
-        values.reserve(dataSize);
+    uint32_t dataSize = PyTuple_GET_SIZE(tuple);
 
-        for(uint32_t i=0;i<dataSize;++i)
-        {
-            values.push_back(PyFloat_AsDouble(PyTuple_GetItem(pValue, i)));
-        }
+    std::vector<float> values;
+    values.reserve(dataSize);
 
-        Py_DECREF(pValue);
-      }
-      else
-      {
-        Py_DECREF(pointerToPythonFunction);
-        Py_DECREF(pModule);
+    for(uint32_t i=0;i<dataSize;++i)
+    {
+        values.push_back(PyFloat_AsDouble(PyTuple_GET_ITEM(tuple, i)));
+    }
 
-        std::string error("Call failed");
-        throw std::runtime_error(error);
-      }
-      return values;
+    return values;
 }
@@ -16,7 +16,7 @@ class PythonCodeRunner
 {
 public:
 
-    PythonCodeRunner(const char *moduleName,  const std::vector<std::string> &pythonFunctionsNames);
+    PythonCodeRunner(const char *moduleName,  const std::vector<std::string> &pythonFunctionsNames, const std::vector<std::string> &optionalPythonFunctionsNames={});
     ~PythonCodeRunner();
 
 protected:
@@ -24,12 +24,16 @@ protected:
     void closePython();
     void updateMapOfPointersToPythonFunctions();
     PyObject * getPointerToFunction(const char* functionName);
+    PyObject * getPointerToOptionalFunction(const char* functionName);
+    PyObject * callFunction(PyObject *pointerToPythonFunction, PyObject *args=nullptr);
     bool getBooleanValue(PyObject *pointerToPythonFunction);
     std::string getStringValue(PyObject *pointerToPythonFunction);
     double getValue(PyObject *pointerToPythonFunction, PyObject *args=nullptr);
     std::vector<float> getValues(PyObject *pointerToPythonFunction, PyObject *args=nullptr);
+    std::vector<float> getValuesFromTuple(PyObject *tuple);
 
     const std::vector<std::string> pythonFunctionsNames;
+    const std::vector<std::string> optionalPythonFunctionsNames;
     std::map<std::string, PyObject *> pointersToPythonFunctions;
     PyObject *pName;
     PyObject *pModule;
@@ -5,16 +5,205 @@
  */
 
 #include "PythonDataSource.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
 #include <vector>
 #include <map>
 
+namespace
+{
+
+template<typename T>
+void convertSamples(const T *__restrict input, float *__restrict output, size_t numberOfSamples)
+{
+    for(size_t i = 0; i < numberOfSamples; ++i)
+    {
+        output[i] = input[i];
+    }
+}
+
+template<typename T>
+void deinterleaveSamples(const T *__restrict input, float *__restrict left, float *__restrict right, size_t numberOfFrames)
+{
+    for(size_t i = 0; i < numberOfFrames; ++i)
+    {
+        left[i] = input[2 * i];
+        right[i] = input[2 * i + 1];
+    }
+}
+
+class PythonBuffer
+{
+public:
+    PythonBuffer(PyObject *object)
+    {
+        if(!PyObject_CheckBuffer(object) || (PyObject_GetBuffer(object, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0))
+        {
+            PyErr_Clear();
+            return;
+        }
+
+        acquired = true;
+        sampleType = getSampleType(object, view.format);
+    }
+
+    PythonBuffer(const PythonBuffer &) = delete;
+    PythonBuffer& operator=(const PythonBuffer &) = delete;
+
+    ~PythonBuffer()
+    {
+        if(acquired)
+        {
+            PyBuffer_Release(&view);
+        }
+    }
+
+    bool isValid() const
+    {
+        return acquired && (sampleType != SampleType::Unsupported);
+    }
+
+    size_t getNumberOfSamples() const
+    {
+        return view.len / getSampleSize();
+    }
+
+    void copyTo(float *output, size_t numberOfSamples) const
+    {
+        switch(sampleType)
+        {
+        case SampleType::Int16:
+            return convertSamples(static_cast<const int16_t*>(view.buf), output, numberOfSamples);
+        case SampleType::Float32:
+            std::memcpy(output, view.buf, numberOfSamples * sizeof(float));
+            return;
+        case SampleType::Float64:
+            return convertSamples(static_cast<const double*>(view.buf), output, numberOfSamples);
+        default:
+            return;
+        }
+    }
+
+    void deinterleaveTo(float *left, float *right, size_t numberOfFrames) const
+    {
+        switch(sampleType)
+        {
+        case SampleType::Int16:
+            return deinterleaveSamples(static_cast<const int16_t*>(view.buf), left, right, numberOfFrames);
+        case SampleType::Float32:
+            return deinterleaveSamples(static_cast<const float*>(view.buf), left, right, numberOfFrames);
+        case SampleType::Float64:
+            return deinterleaveSamples(static_cast<const double*>(view.buf), left, right, numberOfFrames);
+        default:
+            return;
+        }
+    }
+
+private:
+    enum class SampleType
+    {
+        Int16,
+        Float32,
+        Float64,
+        Unsupported
+    };
+
+    static SampleType getSampleType(PyObject *object, const char *format)
+    {
+        // bytes and bytearray carry raw int16 PCM, other buffers of single bytes hold 8-bit
+        // values, which are not supported
+        if(PyBytes_Check(object) || PyByteArray_Check(object))
+        {
+            return SampleType::Int16;
+        }
+
+        if(format == nullptr)
+        {
+            return SampleType::Unsupported;
+        }
+
+        std::string type = format;
+
+        if(!type.empty() && ((type.front() == '@') || (type.front() == '=') || (type.front() == '<')))
+        {
+            type.erase(0, 1);
+        }
+
+        if(type == "h")
+        {
+            return SampleType::Int16;
+        }
+        if(type == "f")
+        {
+            return SampleType::Float32;
+        }
+        if(type == "d")
+        {
+            return SampleType::Float64;
+        }
+        return SampleType::Unsupported;
+    }
+
+    size_t getSampleSize() const
+    {
+        switch(sampleType)
+        {
+        case SampleType::Float32:
+            return sizeof(float);
+        case SampleType::Float64:
+            return sizeof(double);
+        default:
+            return sizeof(int16_t);
+        }
+    }
+
+    Py_buffer view{};
+    bool acquired{false};
+    SampleType sampleType{SampleType::Unsupported};
+};
+
+// owns a new reference returned by a call
+class PythonObject
+{
+public:
+    PythonObject(PyObject *object) : object(object)
+    {
+    }
+
+    PythonObject(const PythonObject &) = delete;
+    PythonObject& operator=(const PythonObject &) = delete;
+
+    ~PythonObject()
+    {
+        Py_XDECREF(object);
+    }
+
+    PyObject * get() const
+    {
+        return object;
+    }
+
+private:
+    PyObject *object;
+};
+
+}
 
 PythonDataSource::PythonDataSource(const char *moduleName):
     PythonCodeRunner(moduleName,
-                     {"initialize",
+                     {"initialize"},
+                     {"getStereoData",
                       "getLeftChannelData",
                       "getRightChannelData"})
 {
+    const bool channelFunctionsFound = pointersToPythonFunctions.count("getLeftChannelData") && pointersToPythonFunctions.count("getRightChannelData");
+
+    if(!pointersToPythonFunctions.count("getStereoData") && !channelFunctionsFound)
+    {
+        std::string error("Cannot find function: getStereoData or getLeftChannelData and getRightChannelData");
+        throw std::runtime_error(error);
+    }
 }
 
 bool PythonDataSource::initialize(uint32_t dataLength, uint32_t samplingRate)
@@ -45,6 +234,11 @@ bool PythonDataSource::initialize(uint32_t dataLength, uint32_t samplingRate)
 
 StereoData PythonDataSource::collectStereoDataFromHw()
 {
+    if(pointersToPythonFunctions.count("getStereoData"))
+    {
+        return getStereoData();
+    }
+
     return StereoData{getLeftChannelData(), getRightChannelData()};
 }
 
@@ -58,24 +252,74 @@ PythonDataSource::~PythonDataSource()
     Py_Finalize();
 }
 
-std::vector<float> PythonDataSource::getLeftChannelData()
+StereoData PythonDataSource::getStereoData()
 {
     try
     {
-        return getValues(pointersToPythonFunctions.at(__func__));
+        PythonObject result(callFunction(pointersToPythonFunctions.at(__func__)));
+
+        if(PyTuple_Check(result.get()) && (PyTuple_GET_SIZE(result.get()) == 2))
+        {
+            PythonBuffer left(PyTuple_GET_ITEM(result.get(), 0));
+            PythonBuffer right(PyTuple_GET_ITEM(result.get(), 1));
+
+            if(left.isValid() && right.isValid())
+            {
+                const auto numberOfSamples = std::min(left.getNumberOfSamples(), right.getNumberOfSamples());
+                StereoData data{std::vector<float>(numberOfSamples), std::vector<float>(numberOfSamples)};
+
+                left.copyTo(data.left.data(), numberOfSamples);
+                right.copyTo(data.right.data(), numberOfSamples);
+                return data;
+            }
+        }
+
+        PythonBuffer interleaved(result.get());
+
+        if(interleaved.isValid())
+        {
+            const auto numberOfFrames = interleaved.getNumberOfSamples() / numberOfChannels;
+            StereoData data{std::vector<float>(numberOfFrames), std::vector<float>(numberOfFrames)};
+
+            interleaved.deinterleaveTo(data.left.data(), data.right.data(), numberOfFrames);
+            return data;
+        }
+
+        std::string error("getStereoData must return a buffer or a pair of buffers of int16, float32 or float64 samples");
+        throw std::runtime_error(error);
     }
     catch(...)
     {
         errorOccured = true;
     }
-    return std::vector<float>{};
+    return StereoData{};
+}
+
+std::vector<float> PythonDataSource::getLeftChannelData()
+{
+    return getChannelData(pointersToPythonFunctions.at(__func__));
 }
 
 std::vector<float> PythonDataSource::getRightChannelData()
+{
+    return getChannelData(pointersToPythonFunctions.at(__func__));
+}
+
+std::vector<float> PythonDataSource::getChannelData(PyObject *pointerToPythonFunction)
 {
     try
     {
-        return getValues(pointersToPythonFunctions.at(__func__));
+        PythonObject result(callFunction(pointerToPythonFunction));
+        PythonBuffer buffer(result.get());
+
+        if(buffer.isValid())
+        {
+            std::vector<float> values(buffer.getNumberOfSamples());
+            buffer.copyTo(values.data(), values.size());
+            return values;
+        }
+
+        return getValuesFromTuple(result.get());
     }
     catch(...)
     {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -11,6 +11,12 @@
 #include <vector>
 
 
+// Samples come from getStereoData(), which returns one interleaved stereo buffer or a pair of
+// planar buffers, or from getLeftChannelData() and getRightChannelData(), which return a buffer
+// or a tuple each. Buffers are any objects implementing the buffer protocol (NumPy arrays,
+// array.array, bytes) of int16, float32 or float64 samples and are copied once without touching
+// single Python objects. Bytes are read as int16. Samples are taken as they are, in the scale
+// used by the pipeline, exactly like values of a tuple.
 class PythonDataSource : public PythonCodeRunner, public DataSourceBase
 {
 public:
@@ -22,8 +28,10 @@ public:
 
 private:
 
+    StereoData getStereoData();
     std::vector<float> getLeftChannelData();
     std::vector<float> getRightChannelData();
+    std::vector<float> getChannelData(PyObject *pointerToPythonFunction);
     bool errorOccured{};
 
 };
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SampleConverter.hpp"
+#include "../CommonData.hpp"
+#include <cstring>
+
+// The loops below are kept branch-free with a fixed stride and non-aliasing outputs
+// so the compiler can vectorize them.
+
+void deinterleaveInt16(const int16_t *__restrict input, float *__restrict left, float *__restrict right, size_t numberOfFrames)
+{
+    for(size_t i = 0; i < numberOfFrames; ++i)
+    {
+        left[i] = input[2 * i];
+        right[i] = input[2 * i + 1];
+    }
+}
+
+void deinterleaveInt24(const uint8_t *__restrict input, float *__restrict left, float *__restrict right, size_t numberOfFrames)
+{
+    constexpr float scale = getFullScaleAmplitude() / 2147483648.0f;
+
+    for(size_t i = 0; i < numberOfFrames; ++i)
+    {
+        const uint8_t *frame = input + 6 * i;
+
+        const int32_t leftSample = static_cast<int32_t>((static_cast<uint32_t>(frame[0]) << 8) | (static_cast<uint32_t>(frame[1]) << 16) | (static_cast<uint32_t>(frame[2]) << 24));
+        const int32_t rightSample = static_cast<int32_t>((static_cast<uint32_t>(frame[3]) << 8) | (static_cast<uint32_t>(frame[4]) << 16) | (static_cast<uint32_t>(frame[5]) << 24));
+
+        left[i] = leftSample * scale;
+        right[i] = rightSample * scale;
+    }
+}
+
+void deinterleaveInt32(const int32_t *__restrict input, float *__restrict left, float *__restrict right, size_t numberOfFrames)
+{
+    constexpr float scale = getFullScaleAmplitude() / 2147483648.0f;
+
+    for(size_t i = 0; i < numberOfFrames; ++i)
+    {
+        left[i] = input[2 * i] * scale;
+        right[i] = input[2 * i + 1] * scale;
+    }
+}
+
+void deinterleaveFloat32(const float *__restrict input, float *__restrict left, float *__restrict right, size_t numberOfFrames)
+{
+    constexpr float scale = getFullScaleAmplitude();
+
+    for(size_t i = 0; i < numberOfFrames; ++i)
+    {
+        left[i] = input[2 * i] * scale;
+        right[i] = input[2 * i + 1] * scale;
+    }
+}
+
+namespace
+{
+
+template<typename T>
+T loadSample(const uint8_t *input)
+{
+    T sample;
+    std::memcpy(&sample, input, sizeof(T));
+    return sample;
+}
+
+template<typename ConvertSample>
+void extractChannels(const uint8_t *__restrict input, float *__restrict left, float *__restrict right, size_t numberOfFrames, size_t frameSize, size_t rightChannelOffset, ConvertSample convertSample)
+{
+    for(size_t i = 0; i < numberOfFrames; ++i)
+    {
+        const uint8_t *frame = input + frameSize * i;
+
+        left[i] = convertSample(frame);
+        right[i] = convertSample(frame + rightChannelOffset);
+    }
+}
+
+bool checkIfAligned(const uint8_t *input, size_t alignment)
+{
+    return (reinterpret_cast<uintptr_t>(input) % alignment) == 0;
+}
+
+}
+
+void extractStereo(const uint8_t *input, const SampleFormat sampleFormat, const uint32_t numberOfChannels, float *left, float *right, size_t numberOfFrames)
+{
+    constexpr float int32Scale = getFullScaleAmplitude() / 2147483648.0f;
+    constexpr float float32Scale = getFullScaleAmplitude();
+
+    switch(sampleFormat)
+    {
+        case SampleFormat::Int16:
+        {
+            if((numberOfChannels == 2) && checkIfAligned(input, alignof(int16_t)))
+            {
+                return deinterleaveInt16(reinterpret_cast<const int16_t*>(input), left, right, numberOfFrames);
+            }
+
+            const size_t rightChannelOffset = (numberOfChannels > 1) ? sizeof(int16_t) : 0;
+            return extractChannels(input, left, right, numberOfFrames, numberOfChannels * sizeof(int16_t), rightChannelOffset,
+                                   [](const uint8_t *sample){return static_cast<float>(loadSample<int16_t>(sample));});
+        }
+        case SampleFormat::Int24:
+        {
+            if(numberOfChannels == 2)
+            {
+                return deinterleaveInt24(input, left, right, numberOfFrames);
+            }
+
+            const size_t rightChannelOffset = (numberOfChannels > 1) ? 3 : 0;
+            return extractChannels(input, left, right, numberOfFrames, numberOfChannels * 3, rightChannelOffset,
+                                   [](const uint8_t *sample){return static_cast<int32_t>((static_cast<uint32_t>(sample[0]) << 8) | (static_cast<uint32_t>(sample[1]) << 16) | (static_cast<uint32_t>(sample[2]) << 24)) * int32Scale;});
+        }
+        case SampleFormat::Int32:
+        {
+            if((numberOfChannels == 2) && checkIfAligned(input, alignof(int32_t)))
+            {
+                return deinterleaveInt32(reinterpret_cast<const int32_t*>(input), left, right, numberOfFrames);
+            }
+
+            const size_t rightChannelOffset = (numberOfChannels > 1) ? sizeof(int32_t) : 0;
+            return extractChannels(input, left, right, numberOfFrames, numberOfChannels * sizeof(int32_t), rightChannelOffset,
+                                   [](const uint8_t *sample){return loadSample<int32_t>(sample) * int32Scale;});
+        }
+        case SampleFormat::Float32:
+        {
+            if((numberOfChannels == 2) && checkIfAligned(input, alignof(float)))
+            {
+                return deinterleaveFloat32(reinterpret_cast<const float*>(input), left, right, numberOfFrames);
+            }
+
+            const size_t rightChannelOffset = (numberOfChannels > 1) ? sizeof(float) : 0;
+            return extractChannels(input, left, right, numberOfFrames, numberOfChannels * sizeof(float), rightChannelOffset,
+                                   [](const uint8_t *sample){return loadSample<float>(sample) * float32Scale;});
+        }
+    }
+}
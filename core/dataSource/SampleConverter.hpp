@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "../CommonTypes.hpp"
+#include <cstdint>
+#include <cstddef>
+
+// Deinterleave stereo frames and convert them to the full scale used by the pipeline
+// (see getFullScaleAmplitude()). Output buffers must hold numberOfFrames elements.
+void deinterleaveInt16(const int16_t *input, float *left, float *right, size_t numberOfFrames);
+void deinterleaveInt24(const uint8_t *input, float *left, float *right, size_t numberOfFrames);
+void deinterleaveInt32(const int32_t *input, float *left, float *right, size_t numberOfFrames);
+void deinterleaveFloat32(const float *input, float *left, float *right, size_t numberOfFrames);
+
+// Takes the first two channels (a mono channel feeds both outputs) of frames with any number
+// of interleaved channels. The input does not have to be aligned, so it may point into a mapped file.
+void extractStereo(const uint8_t *input, const SampleFormat sampleFormat, const uint32_t numberOfChannels, float *left, float *right, size_t numberOfFrames);
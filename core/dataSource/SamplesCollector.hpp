@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "DataSourceBase.hpp"
+#include "../Config.hpp"
 #include <vector>
 #include <memory>
 #include <cstdint>
@@ -15,10 +16,12 @@
 class SamplesCollector
 {
 public:
-    SamplesCollector(const bool pythonDataSourceEnabled, bool loopbackEnabled, const std::string &audioConfigFile="audioConfig");
+    SamplesCollector(const Configuration &config, const std::string &audioConfigFile="audioConfig");
 
     bool initialize(uint32_t numberOfSamples, uint32_t sampleRate);
     bool checkIfErrorOccured();
+    bool isRealtime();
+    SampleFormat getSampleFormat() const;
     StereoData collectStereoDataFromHw();
 
 private:
@@ -1,18 +1,48 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
 
 #include "SamplesCollector.hpp"
 #include "AudioDataSource.hpp"
+#include "FileDataSource.hpp"
+#include "FrameLogDataSource.hpp"
+#include "GeneratorDataSource.hpp"
+#include "StreamDataSource.hpp"
 #include "PythonDataSource.hpp"
+#include "IsolatedPythonDataSource.hpp"
 
-SamplesCollector::SamplesCollector(const bool pythonDataSourceEnabled, bool loopbackEnabled,  const std::string &audioConfigFile)
+SamplesCollector::SamplesCollector(const Configuration &config, const std::string &audioConfigFile)
 {
-    dataSourceImpl = pythonDataSourceEnabled ?
-    std::unique_ptr<DataSourceBase>(std::make_unique<PythonDataSource>(audioConfigFile.c_str())) :
-    std::unique_ptr<DataSourceBase>(std::make_unique<AudioDataSource>(loopbackEnabled));
+    if(!config.get<FileDataSourcePath>().empty())
+    {
+        dataSourceImpl = std::make_unique<FileDataSource>(config.get<FileDataSourcePath>(), config.get<FilePlaybackSettings>());
+    }
+    else if(!config.get<StreamDataSourceAddress>().empty())
+    {
+        dataSourceImpl = std::make_unique<StreamDataSource>(config.get<StreamDataSourceAddress>(), config.get<StreamDataSourceFormat>());
+    }
+    else if(!config.get<FrameLogReplayPath>().empty())
+    {
+        dataSourceImpl = std::make_unique<FrameLogDataSource>(config.get<FrameLogReplayPath>(), config.get<FrameLogSettings>().originalTiming);
+    }
+    else if(checkIfGeneratorEnabled(config.get<SignalGeneratorLeftChannel>(), config.get<SignalGeneratorRightChannel>()))
+    {
+        dataSourceImpl = std::make_unique<GeneratorDataSource>(config.get<SignalGeneratorLeftChannel>(), config.get<SignalGeneratorRightChannel>());
+    }
+    else if(config.get<PythonDataSourceEnabled>() && config.get<PythonProcessIsolationEnabled>())
+    {
+        dataSourceImpl = std::make_unique<IsolatedPythonDataSource>(audioConfigFile);
+    }
+    else if(config.get<PythonDataSourceEnabled>())
+    {
+        dataSourceImpl = std::make_unique<PythonDataSource>(audioConfigFile.c_str());
+    }
+    else
+    {
+        dataSourceImpl = std::make_unique<AudioDataSource>(config.get<LoopbackEnabled>(), config.get<CallbackCaptureEnabled>());
+    }
 }
 
 bool SamplesCollector::initialize(uint32_t numberOfSamples, uint32_t sampleRate)
@@ -29,3 +59,13 @@ bool SamplesCollector::checkIfErrorOccured()
 {
     return dataSourceImpl->checkIfErrorOccured();
 }
+
+bool SamplesCollector::isRealtime()
+{
+    return dataSourceImpl->isRealtime();
+}
+
+SampleFormat SamplesCollector::getSampleFormat() const
+{
+    return dataSourceImpl->getSampleFormat();
+}
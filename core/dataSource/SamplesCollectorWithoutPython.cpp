@@ -1,17 +1,45 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
 
 #include "SamplesCollector.hpp"
 #include "AudioDataSource.hpp"
+#include "FileDataSource.hpp"
+#include "FrameLogDataSource.hpp"
+#include "GeneratorDataSource.hpp"
+#include "StreamDataSource.hpp"
 #include <iostream>
 
-SamplesCollector::SamplesCollector(const bool pythonDataSourceEnabled, bool loopbackEnabled, const std::string &/*audioConfigFile*/)
+SamplesCollector::SamplesCollector(const Configuration &config, const std::string &/*audioConfigFile*/)
 {
-    dataSourceImpl = std::make_unique<AudioDataSource>(loopbackEnabled);
-    if(pythonDataSourceEnabled)
+    if(!config.get<FileDataSourcePath>().empty())
+    {
+        dataSourceImpl = std::make_unique<FileDataSource>(config.get<FileDataSourcePath>(), config.get<FilePlaybackSettings>());
+        return;
+    }
+
+    if(!config.get<StreamDataSourceAddress>().empty())
+    {
+        dataSourceImpl = std::make_unique<StreamDataSource>(config.get<StreamDataSourceAddress>(), config.get<StreamDataSourceFormat>());
+        return;
+    }
+
+    if(!config.get<FrameLogReplayPath>().empty())
+    {
+        dataSourceImpl = std::make_unique<FrameLogDataSource>(config.get<FrameLogReplayPath>(), config.get<FrameLogSettings>().originalTiming);
+        return;
+    }
+
+    if(checkIfGeneratorEnabled(config.get<SignalGeneratorLeftChannel>(), config.get<SignalGeneratorRightChannel>()))
+    {
+        dataSourceImpl = std::make_unique<GeneratorDataSource>(config.get<SignalGeneratorLeftChannel>(), config.get<SignalGeneratorRightChannel>());
+        return;
+    }
+
+    dataSourceImpl = std::make_unique<AudioDataSource>(config.get<LoopbackEnabled>(), config.get<CallbackCaptureEnabled>());
+    if(config.get<PythonDataSourceEnabled>())
     {
         std::cout<<"This software build does not include Python."<<std::endl;
     }
@@ -31,3 +59,13 @@ bool SamplesCollector::checkIfErrorOccured()
 {
     return dataSourceImpl->checkIfErrorOccured();
 }
+
+bool SamplesCollector::isRealtime()
+{
+    return dataSourceImpl->isRealtime();
+}
+
+SampleFormat SamplesCollector::getSampleFormat() const
+{
+    return dataSourceImpl->getSampleFormat();
+}
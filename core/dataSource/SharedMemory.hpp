@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Named memory shared between processes. With a non-zero size a new, zero filled region
+// is created and removed again by the destructor, otherwise an existing region is opened.
+class SharedMemory
+{
+public:
+    SharedMemory(const std::string &name, size_t size=0);
+    SharedMemory(const SharedMemory &) = delete;
+    SharedMemory& operator=(const SharedMemory &) = delete;
+    ~SharedMemory();
+
+    bool isMapped() const;
+    uint8_t* getData() const;
+    size_t getSize() const;
+
+private:
+    const std::string name;
+    uint8_t *data{nullptr};
+    size_t size{0};
+    bool owner{false};
+    void *mappingHandle{nullptr};
+};
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SharedMemory.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+
+// POSIX names of shared memory objects start with a slash
+SharedMemory::SharedMemory(const std::string &name, size_t requestedSize):
+    name("/" + name),
+    owner(requestedSize > 0)
+{
+    int fileDescriptor{-1};
+
+    if(owner)
+    {
+        // a region left behind by a crashed analyzer is replaced
+        shm_unlink(this->name.c_str());
+        fileDescriptor = shm_open(this->name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    }
+    else
+    {
+        fileDescriptor = shm_open(this->name.c_str(), O_RDWR, 0);
+    }
+
+    if(fileDescriptor < 0)
+    {
+        std::cout<<"ERROR: cannot open shared memory: "<<name<<": "<<std::strerror(errno)<<std::endl;
+        owner = false;
+        return;
+    }
+
+    struct stat fileStatus{};
+
+    if(owner && (ftruncate(fileDescriptor, requestedSize) != 0))
+    {
+        std::cout<<"ERROR: cannot resize shared memory: "<<name<<": "<<std::strerror(errno)<<std::endl;
+    }
+    else if((fstat(fileDescriptor, &fileStatus) == 0) && (fileStatus.st_size > 0))
+    {
+        void *address = mmap(nullptr, fileStatus.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+
+        if(address != MAP_FAILED)
+        {
+            data = static_cast<uint8_t*>(address);
+            size = fileStatus.st_size;
+        }
+        else
+        {
+            std::cout<<"ERROR: cannot map shared memory: "<<name<<": "<<std::strerror(errno)<<std::endl;
+        }
+    }
+
+    close(fileDescriptor);
+}
+
+SharedMemory::~SharedMemory()
+{
+    if(data != nullptr)
+    {
+        munmap(data, size);
+    }
+
+    if(owner)
+    {
+        shm_unlink(name.c_str());
+    }
+}
+
+bool SharedMemory::isMapped() const
+{
+    return data != nullptr;
+}
+
+uint8_t* SharedMemory::getData() const
+{
+    return data;
+}
+
+size_t SharedMemory::getSize() const
+{
+    return size;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SharedMemory.hpp"
+#include <windows.h>
+#include <iostream>
+
+// pagefile backed mappings live in the session namespace and vanish with their last handle
+SharedMemory::SharedMemory(const std::string &name, size_t requestedSize):
+    name("Local\\" + name),
+    owner(requestedSize > 0)
+{
+    HANDLE mapping{nullptr};
+
+    if(owner)
+    {
+        const uint64_t mappingSize = requestedSize;
+        mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(mappingSize >> 32), static_cast<DWORD>(mappingSize), this->name.c_str());
+    }
+    else
+    {
+        mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, this->name.c_str());
+    }
+
+    if(mapping == nullptr)
+    {
+        std::cout<<"ERROR: cannot open shared memory: "<<this->name<<" error code: "<<GetLastError()<<std::endl;
+        return;
+    }
+
+    void *address = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION memoryInformation{};
+
+    if((address != nullptr) && (VirtualQuery(address, &memoryInformation, sizeof(memoryInformation)) != 0))
+    {
+        data = static_cast<uint8_t*>(address);
+        size = owner ? requestedSize : memoryInformation.RegionSize;
+        mappingHandle = mapping;
+    }
+    else
+    {
+        std::cout<<"ERROR: cannot map shared memory: "<<this->name<<" error code: "<<GetLastError()<<std::endl;
+        CloseHandle(mapping);
+    }
+}
+
+SharedMemory::~SharedMemory()
+{
+    if(data != nullptr)
+    {
+        UnmapViewOfFile(data);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+    }
+}
+
+bool SharedMemory::isMapped() const
+{
+    return data != nullptr;
+}
+
+uint8_t* SharedMemory::getData() const
+{
+    return data;
+}
+
+size_t SharedMemory::getSize() const
+{
+    return size;
+}
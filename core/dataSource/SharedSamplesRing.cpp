@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SharedSamplesRing.hpp"
+#include <algorithm>
+#include <new>
+
+namespace
+{
+
+void copyToRing(float *ring, uint32_t mask, uint64_t index, const float *input, size_t numberOfFrames)
+{
+    const size_t position = index & mask;
+    const size_t firstPart = std::min<size_t>(numberOfFrames, mask + 1 - position);
+
+    std::copy(input, input + firstPart, ring + position);
+    std::copy(input + firstPart, input + numberOfFrames, ring);
+}
+
+void copyFromRing(const float *ring, uint32_t mask, uint64_t index, float *output, size_t numberOfFrames)
+{
+    const size_t position = index & mask;
+    const size_t firstPart = std::min<size_t>(numberOfFrames, mask + 1 - position);
+
+    std::copy(ring + position, ring + position + firstPart, output);
+    std::copy(ring, ring + numberOfFrames - firstPart, output + firstPart);
+}
+
+}
+
+size_t SharedSamplesRing::calculateSize(uint32_t minimalCapacity)
+{
+    return sizeof(Header) + 2 * sizeof(float) * roundUpToPowerOfTwo(minimalCapacity);
+}
+
+SharedSamplesRing::SharedSamplesRing(uint8_t *memory, uint32_t minimalCapacity, uint32_t blockLength, uint32_t samplingRate):
+    header(new (memory) Header{})
+{
+    header->capacity = roundUpToPowerOfTwo(minimalCapacity);
+    header->blockLength = blockLength;
+    header->samplingRate = samplingRate;
+    header->version = version;
+    header->magic = magic;
+    setChannels();
+}
+
+SharedSamplesRing::SharedSamplesRing(uint8_t *memory, size_t size)
+{
+    auto candidate = reinterpret_cast<Header*>(memory);
+
+    if((memory == nullptr) || (size < sizeof(Header)) || (candidate->magic != magic) || (candidate->version != version))
+    {
+        return;
+    }
+
+    if((candidate->capacity == 0) || (size < calculateSize(candidate->capacity)))
+    {
+        return;
+    }
+
+    header = candidate;
+    setChannels();
+}
+
+bool SharedSamplesRing::isValid() const
+{
+    return header != nullptr;
+}
+
+SharedSamplesRing::Header& SharedSamplesRing::getHeader() const
+{
+    return *header;
+}
+
+size_t SharedSamplesRing::write(const float *leftInput, const float *rightInput, size_t numberOfFrames)
+{
+    const auto write = header->writeIndex.load(std::memory_order_relaxed);
+    numberOfFrames = std::min(numberOfFrames, getNumberOfFreeFrames());
+
+    copyToRing(left, mask, write, leftInput, numberOfFrames);
+    copyToRing(right, mask, write, rightInput, numberOfFrames);
+
+    header->writeIndex.store(write + numberOfFrames, std::memory_order_release);
+    return numberOfFrames;
+}
+
+size_t SharedSamplesRing::read(float *leftOutput, float *rightOutput, size_t numberOfFrames)
+{
+    const auto read = header->readIndex.load(std::memory_order_relaxed);
+    numberOfFrames = std::min(numberOfFrames, getNumberOfAvailableFrames());
+
+    copyFromRing(left, mask, read, leftOutput, numberOfFrames);
+    copyFromRing(right, mask, read, rightOutput, numberOfFrames);
+
+    header->readIndex.store(read + numberOfFrames, std::memory_order_release);
+    return numberOfFrames;
+}
+
+size_t SharedSamplesRing::getNumberOfAvailableFrames() const
+{
+    return header->writeIndex.load(std::memory_order_acquire) - header->readIndex.load(std::memory_order_relaxed);
+}
+
+size_t SharedSamplesRing::getNumberOfFreeFrames() const
+{
+    return header->capacity - (header->writeIndex.load(std::memory_order_relaxed) - header->readIndex.load(std::memory_order_acquire));
+}
+
+// only allowed while no worker is attached
+void SharedSamplesRing::clear()
+{
+    header->writeIndex.store(0);
+    header->readIndex.store(0);
+    header->heartbeat.store(0);
+    header->stopRequested.store(0);
+    header->workerState.store(static_cast<uint32_t>(WorkerState::Starting));
+}
+
+uint32_t SharedSamplesRing::roundUpToPowerOfTwo(uint32_t value)
+{
+    uint32_t result{1};
+
+    while(result < value)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+void SharedSamplesRing::setChannels()
+{
+    mask = header->capacity - 1;
+    left = reinterpret_cast<float*>(reinterpret_cast<uint8_t*>(header) + sizeof(Header));
+    right = left + header->capacity;
+}
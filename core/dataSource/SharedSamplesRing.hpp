@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+enum class WorkerState : uint32_t
+{
+    Starting = 0,
+    Running = 1,
+    Failed = 2
+};
+
+// Single producer / single consumer ring of planar stereo samples placed in memory shared
+// by the analyzer and a worker process. The control header holds the stream parameters
+// set by the analyzer, the ring indices, a heartbeat bumped by the worker on every loop
+// and the state of the worker. Indices count frames and only grow, the capacity is a
+// power of two. Layout: header, left channel samples, right channel samples (float32).
+class SharedSamplesRing
+{
+public:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t blockLength;
+        uint32_t samplingRate;
+        std::atomic<uint32_t> workerState;
+        std::atomic<uint32_t> stopRequested;
+        alignas(64) std::atomic<uint64_t> writeIndex;
+        alignas(64) std::atomic<uint64_t> readIndex;
+        alignas(64) std::atomic<uint64_t> heartbeat;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared ring indices have to be lock free");
+
+    static constexpr uint32_t magic{0x53525341}; // "ASRS"
+    static constexpr uint32_t version{1};
+
+    static size_t calculateSize(uint32_t minimalCapacity);
+
+    // placed at zero filled memory of calculateSize() bytes
+    SharedSamplesRing(uint8_t *memory, uint32_t minimalCapacity, uint32_t blockLength, uint32_t samplingRate);
+    // attached to memory prepared by the analyzer, isValid() tells if the layout matches
+    SharedSamplesRing(uint8_t *memory, size_t size);
+
+    bool isValid() const;
+    Header& getHeader() const;
+
+    size_t write(const float *left, const float *right, size_t numberOfFrames);
+    size_t read(float *left, float *right, size_t numberOfFrames);
+    size_t getNumberOfAvailableFrames() const;
+    size_t getNumberOfFreeFrames() const;
+    void clear();
+
+private:
+    static uint32_t roundUpToPowerOfTwo(uint32_t value);
+    void setChannels();
+
+    Header *header{nullptr};
+    float *left{nullptr};
+    float *right{nullptr};
+    uint32_t mask{0};
+};
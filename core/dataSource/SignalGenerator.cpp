@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "SignalGenerator.hpp"
+#include "CommonData.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+constexpr double twoPi = 2 * M_PI;
+
+// Paul Kellet's economy pink noise filter, scaled to about the level of the white noise feeding it
+constexpr float pinkNoiseScale{0.3f};
+
+}
+
+SignalGenerator::SignalGenerator(const GeneratorSignal &signal, uint32_t samplingRate):
+    signal(signal),
+    samplingRate(samplingRate),
+    amplitude(getFullScaleAmplitude() * std::pow(10.0f, signal.amplitudeDbfs / 20.0f)),
+    randomState((signal.seed * 2654435761u) | 1u)
+{
+    const double nyquistFrequency = samplingRate / 2.0;
+
+    if(signal.type == SignalType::Sine)
+    {
+        tones.push_back({0, twoPi * signal.frequency / samplingRate});
+    }
+    else if(signal.type == SignalType::Multitone)
+    {
+        for(double frequency = std::max(signal.frequency, 1.0f); (frequency <= signal.secondFrequency) && (frequency < nyquistFrequency); frequency *= 2)
+        {
+            tones.push_back({0, twoPi * frequency / samplingRate});
+        }
+    }
+
+    toneAmplitude = tones.empty() ? 0 : amplitude / tones.size();
+
+    const double startFrequency = std::max(signal.frequency, 1.0f);
+    const double stopFrequency = std::max(signal.secondFrequency, 1.0f);
+
+    sweepLength = std::max<uint64_t>(std::llround((signal.period > 0 ? signal.period : 1) * samplingRate), 1);
+    sweepPhaseIncrement = twoPi * startFrequency / samplingRate;
+    sweepRatio = std::pow(stopFrequency / startFrequency, 1.0 / sweepLength);
+
+    impulsePeriod = std::llround(signal.period * samplingRate);
+}
+
+void SignalGenerator::generate(float *output, size_t numberOfSamples)
+{
+    switch(signal.type)
+    {
+    case SignalType::Sine:
+    case SignalType::Multitone:
+        return generateTones(output, numberOfSamples);
+    case SignalType::Sweep:
+        return generateSweep(output, numberOfSamples);
+    case SignalType::WhiteNoise:
+        return generateWhiteNoise(output, numberOfSamples);
+    case SignalType::PinkNoise:
+        return generatePinkNoise(output, numberOfSamples);
+    case SignalType::Impulse:
+        return generateImpulses(output, numberOfSamples);
+    default:
+        std::fill(output, output + numberOfSamples, 0.0f);
+    }
+}
+
+void SignalGenerator::generateTones(float *__restrict output, size_t numberOfSamples)
+{
+    prepareRotationTables(numberOfSamples);
+    std::fill(output, output + numberOfSamples, 0.0f);
+
+    for(size_t toneIndex=0; toneIndex<tones.size(); ++toneIndex)
+    {
+        auto &tone = tones[toneIndex];
+
+        // sin(phase + i*w) = sin(phase)*cos(i*w) + cos(phase)*sin(i*w)
+        const float sineOfPhase = toneAmplitude * std::sin(tone.phase);
+        const float cosineOfPhase = toneAmplitude * std::cos(tone.phase);
+        const float *__restrict cosineTable = cosines.data() + toneIndex * numberOfSamples;
+        const float *__restrict sineTable = sines.data() + toneIndex * numberOfSamples;
+
+        for(size_t i=0; i<numberOfSamples; ++i)
+        {
+            output[i] += sineOfPhase * cosineTable[i] + cosineOfPhase * sineTable[i];
+        }
+
+        tone.phase = std::fmod(tone.phase + numberOfSamples * tone.phaseIncrement, twoPi);
+    }
+}
+
+void SignalGenerator::prepareRotationTables(size_t numberOfSamples)
+{
+    if(cosines.size() == tones.size() * numberOfSamples)
+    {
+        return;
+    }
+
+    cosines.resize(tones.size() * numberOfSamples);
+    sines.resize(tones.size() * numberOfSamples);
+
+    for(size_t toneIndex=0; toneIndex<tones.size(); ++toneIndex)
+    {
+        for(size_t i=0; i<numberOfSamples; ++i)
+        {
+            const double phase = i * tones[toneIndex].phaseIncrement;
+            cosines[toneIndex * numberOfSamples + i] = std::cos(phase);
+            sines[toneIndex * numberOfSamples + i] = std::sin(phase);
+        }
+    }
+}
+
+void SignalGenerator::generateSweep(float *output, size_t numberOfSamples)
+{
+    const double startPhaseIncrement = twoPi * std::max(signal.frequency, 1.0f) / samplingRate;
+
+    for(size_t i=0; i<numberOfSamples; ++i)
+    {
+        if(sweepPosition == sweepLength)
+        {
+            sweepPosition = 0;
+            sweepPhaseIncrement = startPhaseIncrement;
+        }
+
+        output[i] = amplitude * std::sin(sweepPhase);
+
+        sweepPhase = std::fmod(sweepPhase + sweepPhaseIncrement, twoPi);
+        sweepPhaseIncrement *= sweepRatio;
+        ++sweepPosition;
+    }
+}
+
+void SignalGenerator::generateWhiteNoise(float *output, size_t numberOfSamples)
+{
+    for(size_t i=0; i<numberOfSamples; ++i)
+    {
+        output[i] = amplitude * getNextRandomValue();
+    }
+}
+
+void SignalGenerator::generatePinkNoise(float *output, size_t numberOfSamples)
+{
+    for(size_t i=0; i<numberOfSamples; ++i)
+    {
+        const float white = getNextRandomValue();
+
+        pinkState[0] = 0.99765f * pinkState[0] + white * 0.0990460f;
+        pinkState[1] = 0.96300f * pinkState[1] + white * 0.2965164f;
+        pinkState[2] = 0.57000f * pinkState[2] + white * 1.0526913f;
+
+        output[i] = amplitude * pinkNoiseScale * (pinkState[0] + pinkState[1] + pinkState[2] + white * 0.1848f);
+    }
+}
+
+void SignalGenerator::generateImpulses(float *output, size_t numberOfSamples)
+{
+    std::fill(output, output + numberOfSamples, 0.0f);
+
+    for(size_t i=0; i<numberOfSamples; ++i)
+    {
+        if(impulsePending && (samplesUntilImpulse == 0))
+        {
+            output[i] = amplitude;
+            impulsePending = (impulsePeriod > 0);
+            samplesUntilImpulse = impulsePeriod;
+        }
+
+        if(samplesUntilImpulse > 0)
+        {
+            --samplesUntilImpulse;
+        }
+    }
+}
+
+float SignalGenerator::getNextRandomValue()
+{
+    // xorshift32, uniformly distributed in [-1, 1)
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    return static_cast<int32_t>(randomState) * (1.0f / 2147483648.0f);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "CommonTypes.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Generates one channel of a test signal block by block. Tones are produced by rotating
+// a per-tone table of sines and cosines by the phase at the start of the block, so the
+// inner loops are plain multiply-adds the compiler vectorizes and the phase never drifts.
+class SignalGenerator
+{
+public:
+    SignalGenerator(const GeneratorSignal &signal, uint32_t samplingRate);
+    void generate(float *output, size_t numberOfSamples);
+
+private:
+    struct Tone
+    {
+        double phase;
+        double phaseIncrement;
+    };
+
+    void generateTones(float *output, size_t numberOfSamples);
+    void generateSweep(float *output, size_t numberOfSamples);
+    void generateWhiteNoise(float *output, size_t numberOfSamples);
+    void generatePinkNoise(float *output, size_t numberOfSamples);
+    void generateImpulses(float *output, size_t numberOfSamples);
+    void prepareRotationTables(size_t numberOfSamples);
+    float getNextRandomValue();
+
+    const GeneratorSignal signal;
+    const double samplingRate;
+    const float amplitude;
+
+    std::vector<Tone> tones;
+    float toneAmplitude{0};
+    std::vector<float> cosines;
+    std::vector<float> sines;
+
+    double sweepPhase{0};
+    double sweepPhaseIncrement{0};
+    double sweepRatio{1};
+    uint64_t sweepLength{0};
+    uint64_t sweepPosition{0};
+
+    uint32_t randomState;
+    float pinkState[3]{};
+
+    uint64_t impulsePeriod{0};
+    uint64_t samplesUntilImpulse{0};
+    bool impulsePending{true};
+};
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "StreamDataSource.hpp"
+#include "AudioFileParser.hpp"
+#include "SampleConverter.hpp"
+#include <algorithm>
+#include <iostream>
+
+using namespace std::chrono;
+
+StreamDataSource::StreamDataSource(const std::string &address, const PcmFormat &format):
+    address(address),
+    format(format)
+{
+}
+
+StreamDataSource::~StreamDataSource()
+{
+    stopReader();
+}
+
+bool StreamDataSource::initialize(uint32_t numberOfSamples, uint32_t samplingRate)
+{
+    stopReader();
+
+    dataLength = numberOfSamples;
+    frameSize = format.numberOfChannels * getBytesPerSample(format.sampleFormat);
+    block.resize(dataLength * frameSize);
+
+    // about a second of audio, so a writer sending in large chunks never overruns the ring
+    ringBuffer = std::make_unique<SpscRingBuffer<uint8_t>>(std::max<size_t>(samplingRate, 64 * dataLength) * frameSize);
+
+    streamReader = std::make_unique<StreamReader>(address);
+    errorOccured = !streamReader->open();
+
+    if(errorOccured)
+    {
+        return false;
+    }
+
+    std::cout<<"Reading PCM stream from "<<address<<": "<<format.numberOfChannels<<" channels, "<<getBytesPerSample(format.sampleFormat)<<" bytes per sample"<<std::endl;
+
+    lastReportTime = steady_clock::now();
+    readerShouldProceed = true;
+    readerThread = std::thread(&StreamDataSource::readStream, this);
+
+    return true;
+}
+
+bool StreamDataSource::checkIfErrorOccured()
+{
+    return errorOccured;
+}
+
+SampleFormat StreamDataSource::getSampleFormat() const
+{
+    return format.sampleFormat;
+}
+
+StereoData StreamDataSource::collectStereoDataFromHw()
+{
+    if(!waitForBlock())
+    {
+        ++numberOfUnderruns;
+        reportStatistics();
+        return {};
+    }
+
+    ringBuffer->read(block.data(), block.size());
+
+    StereoData stereoData;
+    stereoData.left.resize(dataLength);
+    stereoData.right.resize(dataLength);
+
+    extractStereo(block.data(), format.sampleFormat, format.numberOfChannels, stereoData.left.data(), stereoData.right.data(), dataLength);
+
+    reportStatistics();
+    return stereoData;
+}
+
+uint32_t StreamDataSource::getNumberOfUnderruns() const
+{
+    return numberOfUnderruns;
+}
+
+uint32_t StreamDataSource::getNumberOfOverruns() const
+{
+    return numberOfOverruns;
+}
+
+void StreamDataSource::readStream()
+{
+    std::vector<uint8_t> discarded(maxReadSize);
+    size_t numberOfBytesToDiscard{0};
+    size_t numberOfBytesWritten{0};
+
+    while(readerShouldProceed)
+    {
+        auto [region, freeSpace] = ringBuffer->getWriteRegion();
+        std::optional<size_t> numberOfBytes;
+
+        if((freeSpace == 0) || (numberOfBytesToDiscard > 0))
+        {
+            // the ring is full: drop the incoming data, but only whole frames so channels stay in place
+            const auto numberOfBytesToRead = (numberOfBytesToDiscard > 0) ? std::min(numberOfBytesToDiscard, discarded.size()) : discarded.size();
+            numberOfBytes = streamReader->read(discarded.data(), numberOfBytesToRead, readTimeout);
+
+            if(numberOfBytes && (*numberOfBytes > 0))
+            {
+                if(numberOfBytesToDiscard == 0)
+                {
+                    ++numberOfOverruns;
+                    numberOfBytesToDiscard = (frameSize - *numberOfBytes % frameSize) % frameSize;
+                }
+                else
+                {
+                    numberOfBytesToDiscard -= *numberOfBytes;
+                }
+            }
+        }
+        else
+        {
+            numberOfBytes = streamReader->read(region, std::min(freeSpace, maxReadSize), readTimeout);
+
+            if(numberOfBytes && (*numberOfBytes > 0))
+            {
+                ringBuffer->commitWrite(*numberOfBytes);
+                numberOfBytesWritten += *numberOfBytes;
+
+                std::lock_guard<std::mutex> lock(mutex);
+                dataArrived.notify_one();
+            }
+        }
+
+        if(!numberOfBytes)
+        {
+            // the writer has gone in the middle of a frame: complete it, the next writer starts a new one
+            const std::vector<uint8_t> padding((frameSize - numberOfBytesWritten % frameSize) % frameSize, 0);
+            numberOfBytesWritten += ringBuffer->write(padding.data(), padding.size());
+            numberOfBytesToDiscard = 0;
+        }
+    }
+}
+
+void StreamDataSource::stopReader()
+{
+    readerShouldProceed = false;
+
+    if(readerThread.joinable())
+    {
+        readerThread.join();
+    }
+}
+
+bool StreamDataSource::waitForBlock()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    return dataArrived.wait_for(lock, blockTimeout, [this]()
+    {
+        return ringBuffer->getSize() >= block.size();
+    });
+}
+
+void StreamDataSource::reportStatistics()
+{
+    const auto now = steady_clock::now();
+
+    if((now - lastReportTime) < seconds(1))
+    {
+        return;
+    }
+
+    lastReportTime = now;
+
+    const uint32_t underruns = numberOfUnderruns;
+    const uint32_t overruns = numberOfOverruns;
+
+    if((underruns != numberOfReportedUnderruns) || (overruns != numberOfReportedOverruns))
+    {
+        std::cout<<"PCM stream "<<address<<": "<<(underruns - numberOfReportedUnderruns)<<" underruns, "<<(overruns - numberOfReportedOverruns)<<" overruns"<<std::endl;
+
+        numberOfReportedUnderruns = underruns;
+        numberOfReportedOverruns = overruns;
+    }
+}
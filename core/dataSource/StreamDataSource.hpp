@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "DataSourceBase.hpp"
+#include "StreamReader.hpp"
+#include "CommonTypes.hpp"
+#include "SpscRingBuffer.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <chrono>
+
+// Interleaved PCM pushed by another process. A reader thread moves the stream in large
+// blocks straight into the ring storage. When the analyzer falls behind the newest data
+// is dropped in whole frames (overrun), when the writer is late a block is skipped (underrun).
+class StreamDataSource : public DataSourceBase
+{
+public:
+    StreamDataSource(const std::string &address, const PcmFormat &format);
+    ~StreamDataSource();
+    bool initialize(uint32_t numberOfSamples, uint32_t samplingRate) override;
+    bool checkIfErrorOccured() override;
+    StereoData collectStereoDataFromHw() override;
+    SampleFormat getSampleFormat() const override;
+
+    uint32_t getNumberOfUnderruns() const;
+    uint32_t getNumberOfOverruns() const;
+
+private:
+    void readStream();
+    void stopReader();
+    bool waitForBlock();
+    void reportStatistics();
+
+    static constexpr size_t maxReadSize{64 * 1024};
+    static constexpr std::chrono::milliseconds readTimeout{50};
+    static constexpr std::chrono::milliseconds blockTimeout{60};
+
+    const std::string address;
+    const PcmFormat format;
+    size_t frameSize{0};
+    bool errorOccured{false};
+    std::unique_ptr<StreamReader> streamReader;
+    std::unique_ptr<SpscRingBuffer<uint8_t>> ringBuffer;
+    std::vector<uint8_t> block;
+    std::thread readerThread;
+    std::atomic<bool> readerShouldProceed{false};
+    std::mutex mutex;
+    std::condition_variable dataArrived;
+    std::atomic<uint32_t> numberOfUnderruns{0};
+    std::atomic<uint32_t> numberOfOverruns{0};
+    uint32_t numberOfReportedUnderruns{0};
+    uint32_t numberOfReportedOverruns{0};
+    std::chrono::steady_clock::time_point lastReportTime;
+};
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+// Byte stream coming from the standard input ("-"), a Unix domain socket ("unix:<path>",
+// the analyzer listens and accepts one writer at a time) or a named pipe (any other path).
+class StreamReader
+{
+public:
+    StreamReader(const std::string &address);
+    StreamReader(const StreamReader &) = delete;
+    StreamReader& operator=(const StreamReader &) = delete;
+    ~StreamReader();
+
+    bool open();
+
+    // Waits at most timeout for data and reads up to size bytes. Returns 0 if nothing arrived
+    // in time and nothing when the writer has gone, the next call then waits for a new writer.
+    std::optional<size_t> read(uint8_t *data, size_t size, std::chrono::milliseconds timeout);
+
+private:
+    void closeConnection();
+
+    const std::string address;
+    intptr_t listeningHandle{-1};
+    intptr_t handle{-1};
+    bool endOfInput{false};
+};
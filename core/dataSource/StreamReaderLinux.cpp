@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "StreamReader.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <iostream>
+#include <thread>
+#include <cstring>
+#include <cerrno>
+
+namespace
+{
+
+const std::string standardInputAddress{"-"};
+const std::string unixSocketPrefix{"unix:"};
+
+bool checkIfUnixSocket(const std::string &address)
+{
+    return address.compare(0, unixSocketPrefix.size(), unixSocketPrefix) == 0;
+}
+
+std::string getSocketPath(const std::string &address)
+{
+    return address.substr(unixSocketPrefix.size());
+}
+
+bool waitForInput(int fileDescriptor, std::chrono::milliseconds timeout)
+{
+    pollfd pollDescriptor{fileDescriptor, POLLIN, 0};
+    return poll(&pollDescriptor, 1, timeout.count()) > 0;
+}
+
+}
+
+StreamReader::StreamReader(const std::string &address) : address(address)
+{
+}
+
+StreamReader::~StreamReader()
+{
+    closeConnection();
+
+    if(listeningHandle >= 0)
+    {
+        close(listeningHandle);
+        unlink(getSocketPath(address).c_str());
+    }
+}
+
+bool StreamReader::open()
+{
+    if(address == standardInputAddress)
+    {
+        handle = STDIN_FILENO;
+        return true;
+    }
+
+    if(checkIfUnixSocket(address))
+    {
+        const auto path = getSocketPath(address);
+
+        sockaddr_un socketAddress{};
+        socketAddress.sun_family = AF_UNIX;
+
+        if(path.empty() || (path.size() >= sizeof(socketAddress.sun_path)))
+        {
+            std::cout<<"ERROR: invalid socket path: "<<path<<std::endl;
+            return false;
+        }
+
+        std::strncpy(socketAddress.sun_path, path.c_str(), sizeof(socketAddress.sun_path) - 1);
+
+        const int socketDescriptor = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        unlink(path.c_str());
+
+        if((socketDescriptor < 0) || (bind(socketDescriptor, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress)) != 0) || (listen(socketDescriptor, 1) != 0))
+        {
+            std::cout<<"ERROR: cannot listen on "<<path<<": "<<std::strerror(errno)<<std::endl;
+
+            if(socketDescriptor >= 0)
+            {
+                close(socketDescriptor);
+            }
+            return false;
+        }
+
+        listeningHandle = socketDescriptor;
+        return true;
+    }
+
+    // non-blocking, so opening a pipe does not wait for its writer
+    handle = ::open(address.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+
+    if(handle < 0)
+    {
+        std::cout<<"ERROR: cannot open "<<address<<": "<<std::strerror(errno)<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<size_t> StreamReader::read(uint8_t *data, size_t size, std::chrono::milliseconds timeout)
+{
+    if(endOfInput)
+    {
+        std::this_thread::sleep_for(timeout);
+        return std::nullopt;
+    }
+
+    if(handle < 0)
+    {
+        if(listeningHandle >= 0)
+        {
+            if(waitForInput(listeningHandle, timeout))
+            {
+                handle = accept4(listeningHandle, nullptr, nullptr, SOCK_CLOEXEC);
+            }
+            return 0;
+        }
+
+        if(!open())
+        {
+            std::this_thread::sleep_for(timeout);
+        }
+        return 0;
+    }
+
+    if(!waitForInput(handle, timeout))
+    {
+        return 0;
+    }
+
+    const auto numberOfBytes = ::read(handle, data, size);
+
+    if(numberOfBytes > 0)
+    {
+        return numberOfBytes;
+    }
+
+    if((numberOfBytes < 0) && ((errno == EAGAIN) || (errno == EINTR)))
+    {
+        return 0;
+    }
+
+    // the writer has gone, the standard input cannot be reopened
+    endOfInput = (address == standardInputAddress);
+    closeConnection();
+
+    return std::nullopt;
+}
+
+void StreamReader::closeConnection()
+{
+    if((handle >= 0) && (handle != STDIN_FILENO))
+    {
+        close(handle);
+    }
+
+    handle = -1;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "StreamReader.hpp"
+#include <windows.h>
+#include <iostream>
+#include <thread>
+#include <algorithm>
+
+namespace
+{
+
+const std::string standardInputAddress{"-"};
+const std::string unixSocketPrefix{"unix:"};
+
+HANDLE toHandle(intptr_t handle)
+{
+    return reinterpret_cast<HANDLE>(handle);
+}
+
+intptr_t fromHandle(HANDLE handle)
+{
+    return (handle == INVALID_HANDLE_VALUE) ? -1 : reinterpret_cast<intptr_t>(handle);
+}
+
+}
+
+StreamReader::StreamReader(const std::string &address) : address(address)
+{
+}
+
+StreamReader::~StreamReader()
+{
+    closeConnection();
+}
+
+bool StreamReader::open()
+{
+    if(address == standardInputAddress)
+    {
+        handle = fromHandle(GetStdHandle(STD_INPUT_HANDLE));
+        return handle >= 0;
+    }
+
+    if(address.compare(0, unixSocketPrefix.size(), unixSocketPrefix) == 0)
+    {
+        std::cout<<"ERROR: Unix domain sockets are not supported on Windows, use a named pipe (\\\\.\\pipe\\<name>) instead"<<std::endl;
+        return false;
+    }
+
+    // the pipe server is the writer, the analyzer connects to it as a client
+    handle = fromHandle(CreateFileA(address.c_str(), GENERIC_READ, 0, nullptr, OPEN_EXISTING, 0, nullptr));
+
+    if(handle < 0)
+    {
+        std::cout<<"ERROR: cannot open "<<address<<" error code: "<<GetLastError()<<std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<size_t> StreamReader::read(uint8_t *data, size_t size, std::chrono::milliseconds timeout)
+{
+    if(endOfInput)
+    {
+        std::this_thread::sleep_for(timeout);
+        return std::nullopt;
+    }
+
+    if(handle < 0)
+    {
+        if(!open())
+        {
+            std::this_thread::sleep_for(timeout);
+        }
+        return 0;
+    }
+
+    DWORD numberOfAvailableBytes{0};
+
+    // PeekNamedPipe fails for redirected files, those are read directly
+    if(PeekNamedPipe(toHandle(handle), nullptr, 0, nullptr, &numberOfAvailableBytes, nullptr))
+    {
+        if(numberOfAvailableBytes == 0)
+        {
+            std::this_thread::sleep_for((std::min)(timeout, std::chrono::milliseconds(5)));
+            return 0;
+        }
+        size = (std::min<size_t>)(size, numberOfAvailableBytes);
+    }
+    else if(GetLastError() == ERROR_BROKEN_PIPE)
+    {
+        size = 0;
+    }
+
+    DWORD numberOfBytes{0};
+
+    if((size > 0) && ReadFile(toHandle(handle), data, static_cast<DWORD>(size), &numberOfBytes, nullptr) && (numberOfBytes > 0))
+    {
+        return numberOfBytes;
+    }
+
+    // the writer has gone, the standard input cannot be reopened
+    endOfInput = (address == standardInputAddress);
+    closeConnection();
+
+    return std::nullopt;
+}
+
+void StreamReader::closeConnection()
+{
+    if((handle >= 0) && (address != standardInputAddress))
+    {
+        CloseHandle(toHandle(handle));
+    }
+
+    handle = -1;
+}
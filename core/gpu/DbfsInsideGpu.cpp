@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "DbfsInsideGpu.hpp"
+#include "CommonData.hpp"
+#include <algorithm>
+
+GLuint DbfsInsideGpu::cs = 0;
+GLuint DbfsInsideGpu::pipeline = 0;
+GLint DbfsInsideGpu::firstValueLoc = 0;
+GLint DbfsInsideGpu::firstMaxHoldValueLoc = 0;
+GLint DbfsInsideGpu::numberOfValuesLoc = 0;
+GLint DbfsInsideGpu::timeLoc = 0;
+GLint DbfsInsideGpu::speedOfFallingLoc = 0;
+GLint DbfsInsideGpu::accelerationStateOfFallingLoc = 0;
+GLint DbfsInsideGpu::floorLoc = 0;
+
+
+DbfsInsideGpu::DbfsInsideGpu(const uint32_t numberOfValues, const float bottomOfScreenInDbfs, const std::map<MaxHolderType, MaxHoldSettings> &maxHolds):
+    numberOfValues(numberOfValues),
+    values(numberOfValues, sizeof(float), (maxHolds.size() + 1) * numberOfValues),
+    bottomOfScreenBaseInstance(values.getBaseInstanceOfFixedInstances() + maxHolds.size() * numberOfValues)
+{
+    const std::vector<GLuint> updateTimes(numberOfValues, 0);
+    auto *fixedValues = values.getFixedInstances<float>();
+
+    for(const auto &[type, settings] : maxHolds)
+    {
+        MaxHold maxHold{settings, values.getBaseInstanceOfFixedInstances() + static_cast<GLuint>(this->maxHolds.size()) * numberOfValues, 0};
+
+        std::fill_n(fixedValues + this->maxHolds.size() * numberOfValues, numberOfValues, floorDbFs);
+
+        glCreateBuffers(1, &maxHold.updateTimesBuffer);
+        glNamedBufferStorage(maxHold.updateTimesBuffer, updateTimes.size() * sizeof(GLuint), updateTimes.data(), 0);
+
+        this->maxHolds.emplace(type, maxHold);
+    }
+
+    std::fill_n(fixedValues + maxHolds.size() * numberOfValues, numberOfValues, bottomOfScreenInDbfs);
+
+    const std::vector<float> initialReadbackValues(numberOfReadbackSlots * std::max<size_t>(maxHolds.size() * numberOfValues, 1), floorDbFs);
+    const GLsizeiptr readbackSize = initialReadbackValues.size() * sizeof(float);
+    const GLbitfield readbackFlags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glCreateBuffers(1, &readbackBuffer);
+    glNamedBufferStorage(readbackBuffer, readbackSize, initialReadbackValues.data(), readbackFlags);
+    readbackValues = static_cast<const float*>(glMapNamedBufferRange(readbackBuffer, 0, readbackSize, readbackFlags));
+}
+
+void DbfsInsideGpu::initialize()
+{
+    prepareComputeShader(pipeline, cs, getComputeShader());
+    firstValueLoc = glGetUniformLocation(cs, "firstValue");
+    firstMaxHoldValueLoc = glGetUniformLocation(cs, "firstMaxHoldValue");
+    numberOfValuesLoc = glGetUniformLocation(cs, "numberOfValues");
+    timeLoc = glGetUniformLocation(cs, "timeInMilliSeconds");
+    speedOfFallingLoc = glGetUniformLocation(cs, "speedOfFalling");
+    accelerationStateOfFallingLoc = glGetUniformLocation(cs, "accelerationStateOfFalling");
+    floorLoc = glGetUniformLocation(cs, "floorDbfs");
+}
+
+void DbfsInsideGpu::finalize()
+{
+    ElementInsideGpu::removeComputeShader(pipeline, cs);
+}
+
+void DbfsInsideGpu::updateFloorDbFs(const float floorDbFs)
+{
+    this->floorDbFs = floorDbFs;
+}
+
+void DbfsInsideGpu::update(const std::vector<float> &dBFs, const uint32_t timeInMilliSeconds)
+{
+    // every command reading the previous spectrum has been issued by now
+    if(!firstUpdate)
+    {
+        values.finishDrawing();
+    }
+
+    firstUpdate = false;
+
+    auto *mappedSpectrum = values.startWriting<float>();
+    const auto numberOfCopiedValues = std::min<uint32_t>(numberOfValues, dBFs.size());
+
+    std::copy_n(dBFs.begin(), numberOfCopiedValues, mappedSpectrum);
+    std::fill(mappedSpectrum + numberOfCopiedValues, mappedSpectrum + numberOfValues, floorDbFs);
+
+    if(maxHolds.empty())
+    {
+        return;
+    }
+
+    glBindProgramPipeline(pipeline);
+    glProgramUniform1ui(cs, firstValueLoc, values.getBaseInstance());
+    glProgramUniform1ui(cs, numberOfValuesLoc, numberOfValues);
+    glProgramUniform1ui(cs, timeLoc, timeInMilliSeconds);
+    glProgramUniform1f(cs, floorLoc, floorDbFs);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BINDING_VALUES, values.getBuffer());
+
+    for(const auto &[type, maxHold] : maxHolds)
+    {
+        glProgramUniform1f(cs, speedOfFallingLoc, maxHold.settings.speedOfFalling);
+        glProgramUniform1ui(cs, accelerationStateOfFallingLoc, maxHold.settings.accelerationStateOfFalling);
+        glProgramUniform1ui(cs, firstMaxHoldValueLoc, maxHold.baseInstance);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BINDING_UPDATE_TIMES, maxHold.updateTimesBuffer);
+        glDispatchCompute((numberOfValues + workGroupSize - 1) / workGroupSize, 1, 1);
+    }
+
+    // max hold values are read by layers, by the copy for the CPU and by the compute pass of the next frame
+    glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+
+    findNewestFinishedReadback();
+    readBackMaxHolds();
+}
+
+DbfsInsideGpu::Source DbfsInsideGpu::getSpectrum() const
+{
+    return Source{values.getBuffer(), values.getBaseInstance()};
+}
+
+DbfsInsideGpu::Source DbfsInsideGpu::getMaxHold(const MaxHolderType type) const
+{
+    return Source{values.getBuffer(), maxHolds.at(type).baseInstance};
+}
+
+DbfsInsideGpu::Source DbfsInsideGpu::getBottomOfScreen() const
+{
+    return Source{values.getBuffer(), bottomOfScreenBaseInstance};
+}
+
+float DbfsInsideGpu::getMaxHoldValue(const MaxHolderType type, const uint32_t index) const
+{
+    const auto firstFixedValue = values.getBaseInstanceOfFixedInstances();
+    const auto *readableValues = readbackValues + readableReadbackSlot * maxHolds.size() * numberOfValues;
+    return readableValues[maxHolds.at(type).baseInstance - firstFixedValue + std::min(index, numberOfValues - 1)];
+}
+
+void DbfsInsideGpu::findNewestFinishedReadback()
+{
+    // slots are checked from the oldest copy, the GPU finishes them in order
+    for(uint32_t i=0; i<numberOfReadbackSlots; ++i)
+    {
+        const auto slot = (nextReadbackSlot + i) % numberOfReadbackSlots;
+        auto &fence = readbackFences.at(slot);
+
+        if(!fence)
+        {
+            continue;
+        }
+
+        if(glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+        {
+            return;
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
+        readableReadbackSlot = slot;
+    }
+}
+
+void DbfsInsideGpu::readBackMaxHolds()
+{
+    // the copy is skipped rather than waited for, when the GPU is too many frames behind
+    if(readbackFences.at(nextReadbackSlot) || (nextReadbackSlot == readableReadbackSlot))
+    {
+        return;
+    }
+
+    const GLsizeiptr size = maxHolds.size() * numberOfValues * sizeof(float);
+
+    glCopyNamedBufferSubData(values.getBuffer(), readbackBuffer, values.getBaseInstanceOfFixedInstances() * sizeof(float), nextReadbackSlot * size, size);
+    readbackFences.at(nextReadbackSlot) = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    nextReadbackSlot = (nextReadbackSlot + 1) % numberOfReadbackSlots;
+}
+
+const char* DbfsInsideGpu::getComputeShader()
+{
+    const char *computeShader = R"(
+#version 430 core
+
+layout(local_size_x = 64) in;
+
+layout(std430, binding = 0) buffer Values { float values[]; };
+layout(std430, binding = 1) buffer UpdateTimes { uint updateTimes[]; };
+
+uniform uint firstValue;
+uniform uint firstMaxHoldValue;
+uniform uint numberOfValues;
+uniform uint timeInMilliSeconds;
+uniform float speedOfFalling;
+uniform uint accelerationStateOfFalling;
+uniform float floorDbfs;
+
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+
+    if(i >= numberOfValues)
+    {
+        return;
+    }
+
+    uint maxHold = firstMaxHoldValue + i;
+    float fallenValue = max(values[maxHold] - float(timeInMilliSeconds - updateTimes[i]) / speedOfFalling, floorDbfs);
+    float dBFs = values[firstValue + i];
+
+    if(dBFs > fallenValue)
+    {
+        values[maxHold] = dBFs;
+        updateTimes[i] = timeInMilliSeconds;
+    }
+    else
+    {
+        values[maxHold] = fallenValue;
+
+        if(accelerationStateOfFalling == 0u)
+        {
+            updateTimes[i] = timeInMilliSeconds;
+        }
+    }
+}
+)";
+
+    return computeShader;
+}
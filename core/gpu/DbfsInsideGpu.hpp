@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "ElementInsideGpu.hpp"
+#include "InstanceRingBuffer.hpp"
+#include "CommonData.hpp"
+#include <glad/glad.h>
+#include <array>
+#include <map>
+#include <vector>
+
+enum class MaxHolderType
+{
+    Dynamic,
+    Transparent
+};
+
+struct MaxHoldSettings
+{
+    float speedOfFalling;
+    bool accelerationStateOfFalling;
+};
+
+// dBFS values of the bars shared by every layer drawn from them. The spectrum is written
+// once per frame into a persistently mapped ring and max hold values are calculated from
+// it by a compute pass, so the CPU work of a frame does not depend on the number of bars.
+// Layers read the values as instanced vertex attributes and map them to the screen with
+// the VerticalDbfsRange in their vertex shaders. The spectrum, the max hold values and the
+// bottom of the screen are kept in one buffer and a layer is selected by the base instance
+// of its draw command, so layers drawn from different values share a vertex array.
+// Max hold values are copied by the GPU into slots of a buffer mapped for reading and each
+// copy is fenced, so the CPU only reads slots which the GPU has finished writing.
+class DbfsInsideGpu : public ElementInsideGpu
+{
+public:
+    // values of the layer start at the base instance of the buffer and take sizeof(float) each
+    struct Source
+    {
+        GLuint buffer;
+        GLuint baseInstance;
+    };
+
+    DbfsInsideGpu(const uint32_t numberOfValues, const float bottomOfScreenInDbfs, const std::map<MaxHolderType, MaxHoldSettings> &maxHolds);
+    DbfsInsideGpu(const DbfsInsideGpu &) = delete;
+    DbfsInsideGpu& operator=(const DbfsInsideGpu &) = delete;
+
+    void update(const std::vector<float> &dBFs, const uint32_t timeInMilliSeconds);
+    // max hold values do not fall below it and missing values are filled with it
+    void updateFloorDbFs(const float floorDbFs);
+    Source getSpectrum() const;
+    Source getMaxHold(const MaxHolderType type) const;
+    // values at the bottom of the screen, for layers which are not moved
+    Source getBottomOfScreen() const;
+    // read from the newest finished copy, so it may be a few frames old
+    float getMaxHoldValue(const MaxHolderType type, const uint32_t index) const;
+
+    static void initialize();
+    static void finalize();
+
+private:
+    static const char* getComputeShader();
+    void findNewestFinishedReadback();
+    void readBackMaxHolds();
+
+    struct MaxHold
+    {
+        MaxHoldSettings settings;
+        GLuint baseInstance;
+        GLuint updateTimesBuffer;
+    };
+
+    const uint32_t numberOfValues;
+    InstanceRingBuffer values;
+    GLuint bottomOfScreenBaseInstance;
+    std::map<MaxHolderType, MaxHold> maxHolds;
+    bool firstUpdate{true};
+    float floorDbFs{getFloorDbFs16bit()};
+
+    static constexpr uint32_t numberOfReadbackSlots{3};
+    GLuint readbackBuffer{0};
+    const float *readbackValues{nullptr};
+    std::array<GLsync, numberOfReadbackSlots> readbackFences{};
+    // slot 0 is filled with the initial values, so there is always a slot to be read
+    uint32_t readableReadbackSlot{0};
+    uint32_t nextReadbackSlot{1};
+
+    static GLuint cs;
+    static GLuint pipeline;
+    static GLint firstValueLoc;
+    static GLint firstMaxHoldValueLoc;
+    static GLint numberOfValuesLoc;
+    static GLint timeLoc;
+    static GLint speedOfFallingLoc;
+    static GLint accelerationStateOfFallingLoc;
+    static GLint floorLoc;
+
+    static constexpr GLuint BINDING_VALUES = 0;
+    static constexpr GLuint BINDING_UPDATE_TIMES = 1;
+    static constexpr GLuint workGroupSize = 64;
+};
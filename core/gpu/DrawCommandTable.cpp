@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "DrawCommandTable.hpp"
+#include <algorithm>
+
+DrawCommandTable::DrawCommandTable(const uint32_t numberOfLayers) :
+    commands(numberOfLayers, DrawArraysIndirectCommand{0, 0, 0, 0}),
+    ring(numberOfLayers, sizeof(DrawArraysIndirectCommand))
+{
+}
+
+void DrawCommandTable::set(const uint32_t layer, const GLuint count, const GLuint instanceCount, const GLuint first, const GLuint baseInstance)
+{
+    commands.at(layer) = DrawArraysIndirectCommand{count, instanceCount, first, baseInstance};
+}
+
+void DrawCommandTable::hide(const uint32_t layer)
+{
+    commands.at(layer).instanceCount = 0;
+}
+
+void DrawCommandTable::draw(const GLenum mode)
+{
+    auto *mappedCommands = ring.startWriting<DrawArraysIndirectCommand>();
+    std::copy(commands.begin(), commands.end(), mappedCommands);
+
+    const auto offset = static_cast<uintptr_t>(ring.getBaseInstance()) * sizeof(DrawArraysIndirectCommand);
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, ring.getBuffer());
+    glMultiDrawArraysIndirect(mode, reinterpret_cast<const void*>(offset), commands.size(), 0);
+    ring.finishDrawing();
+}
+
+uint32_t DrawCommandTable::getNumberOfLayers() const
+{
+    return commands.size();
+}
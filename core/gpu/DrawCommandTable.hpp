@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "InstanceRingBuffer.hpp"
+#include <glad/glad.h>
+#include <vector>
+
+// layout required by glMultiDrawArraysIndirect
+struct DrawArraysIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+};
+
+// One command per layer of elements sharing a shader program and a vertex array. The whole
+// table is submitted with a single glMultiDrawArraysIndirect, which draws the layers in the
+// order of the table, so they are blended as if drawn one by one. A hidden layer keeps its
+// command with no instances. Commands are copied into the next region of a ring on every
+// draw, as base instances and numbers of instances change from frame to frame.
+class DrawCommandTable
+{
+public:
+    explicit DrawCommandTable(const uint32_t numberOfLayers);
+
+    void set(const uint32_t layer, const GLuint count, const GLuint instanceCount, const GLuint first, const GLuint baseInstance);
+    void hide(const uint32_t layer);
+    // the pipeline and the vertex array of the layers have to be bound
+    void draw(const GLenum mode);
+    uint32_t getNumberOfLayers() const;
+
+private:
+    std::vector<DrawArraysIndirectCommand> commands;
+    InstanceRingBuffer ring;
+};
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "DynamicLinesInsideGpu.hpp"
+#include "FigureGeometryCalculator.hpp"
+
+GLuint DynamicLinesInsideGpu::vs = 0;
+GLuint DynamicLinesInsideGpu::fs = 0;
+GLuint DynamicLinesInsideGpu::pipeline = 0;
+GLuint DynamicLinesInsideGpu::dbfsRangeLoc = 0;
+GLuint DynamicLinesInsideGpu::horizontalLayoutLoc = 0;
+
+
+DynamicLinesInsideGpu::DynamicLinesInsideGpu(const uint32_t numberOfLines, const std::vector<std::vector<float>> &colorsOfLayers) :
+    numberOfLines(numberOfLines),
+    xBeginOfLineZero(FigureGeometryCalculator::xDrawOffsetInPercents + FigureGeometryCalculator::xDrawSizeInPercents / (numberOfLines + 1) / 2),
+    xWidth(FigureGeometryCalculator::xDrawSizeInPercents / (numberOfLines + 1)),
+    commands(colorsOfLayers.size())
+{
+    std::vector<Vertex> colors;
+
+    for(const auto &color : colorsOfLayers)
+    {
+        colors.insert(colors.end(), verticesPerLine, Vertex{color.at(0),color.at(1),color.at(2),color.at(3)});
+    }
+
+    glCreateVertexArrays(1, &vao);
+
+    glCreateBuffers(1, &colorBuffer);
+    glNamedBufferStorage(colorBuffer,colors.size() * sizeof(Vertex),colors.data(),0);
+
+    glEnableVertexArrayAttrib(vao, ATTR_COLOR);
+    glVertexArrayAttribFormat(vao, ATTR_COLOR, 4, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayVertexBuffer(vao, BINDING_COLOR, colorBuffer, 0, sizeof(Vertex));
+    glVertexArrayAttribBinding(vao, ATTR_COLOR, BINDING_COLOR);
+
+    glEnableVertexArrayAttrib(vao, ATTR_DBFS0);
+    glVertexArrayAttribFormat(vao, ATTR_DBFS0, 1, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(vao, ATTR_DBFS0, BINDING_DBFS);
+
+    glEnableVertexArrayAttrib(vao, ATTR_DBFS1);
+    glVertexArrayAttribFormat(vao, ATTR_DBFS1, 1, GL_FLOAT, GL_FALSE, sizeof(float));
+    glVertexArrayAttribBinding(vao, ATTR_DBFS1, BINDING_DBFS);
+
+    glVertexArrayBindingDivisor(vao, BINDING_DBFS, 1);
+}
+
+void DynamicLinesInsideGpu::draw(const std::vector<std::optional<DbfsInsideGpu::Source>> &sources)
+{
+    for(uint32_t layer=0; layer<commands.getNumberOfLayers(); ++layer)
+    {
+        const auto &source = sources.at(layer);
+
+        if(!source)
+        {
+            commands.hide(layer);
+            continue;
+        }
+
+        // every source of a layer is kept in the same buffer
+        if(source->buffer != dbfsBuffer)
+        {
+            dbfsBuffer = source->buffer;
+            glVertexArrayVertexBuffer(vao, BINDING_DBFS, dbfsBuffer, 0, sizeof(float));
+        }
+
+        commands.set(layer, verticesPerLine, numberOfLines, layer * verticesPerLine, source->baseInstance);
+    }
+
+    glBindProgramPipeline(pipeline);
+    glProgramUniform2f(vs, horizontalLayoutLoc, xBeginOfLineZero, xWidth);
+    glBindVertexArray(vao);
+
+    commands.draw(GL_LINES);
+}
+
+void DynamicLinesInsideGpu::updateDbfsRange(const float bottomInDbfs, const float topInDbfs)
+{
+    glProgramUniform2f(vs, dbfsRangeLoc, bottomInDbfs, topInDbfs);
+}
+
+void DynamicLinesInsideGpu::initialize()
+{
+    prepareShaders(pipeline, vs, fs, getVertexShader(), getFragmentShader());
+    dbfsRangeLoc = glGetUniformLocation(vs, "dbfsRange");
+    horizontalLayoutLoc = glGetUniformLocation(vs, "horizontalLayout");
+}
+
+void DynamicLinesInsideGpu::finalize()
+{
+    ElementInsideGpu::removeShaders(pipeline, vs,fs);
+}
+
+const char* DynamicLinesInsideGpu::getVertexShader()
+{
+    const char* shaderUsedWithColorsProvidedByUser = R"(
+#version 330 core
+
+layout(location = 0) in vec4 color;   // VBO (binding 0)
+layout(location = 1) in float dBFs0;  // instance
+layout(location = 2) in float dBFs1;  // instance
+
+uniform vec2 dbfsRange;
+uniform vec2 horizontalLayout;        // x of the beginning of the first line and width of a line in percents
+
+out vec4 vColor;
+
+float percentToPosition(float percent)
+{
+    return min(percent, 100.0) / 50.0 - 1.0;
+}
+
+void main()
+{
+    // vertices of all layers are kept in one buffer, so a layer starts at its own vertex
+    int end = gl_VertexID % 2;
+    float dBFs = (end == 0) ? dBFs0 : dBFs1;
+    float x = horizontalLayout.x + float(gl_InstanceID + end) * horizontalLayout.y;
+    float y = (dBFs - dbfsRange.x) * 100.0 / (dbfsRange.y - dbfsRange.x);
+
+    gl_Position = vec4(percentToPosition(x), percentToPosition(y), 0.0, 1.0);
+    vColor = color;
+}
+
+)";
+    return shaderUsedWithColorsProvidedByUser;
+}
+
+const char* DynamicLinesInsideGpu::getFragmentShader()
+{
+    const char* fragmentShaderSrc = R"(
+#version 330 core
+
+in vec4 vColor;
+out vec4 FragColor;
+
+void main()
+{
+    FragColor = vColor;
+}
+)";
+    return fragmentShaderSrc;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "ElementInsideGpu.hpp"
+#include "DbfsInsideGpu.hpp"
+#include "DrawCommandTable.hpp"
+#include <glad/glad.h>
+#include <optional>
+#include <vector>
+
+// Lines joining the tops of neighbouring bars. Line i goes from the value i to the value
+// i+1 of the source, both ends are calculated by the vertex shader. Every layer has its own
+// color and source and the layers are drawn by a single multi-draw, see DrawCommandTable.
+class DynamicLinesInsideGpu : public ElementInsideGpu
+{
+public:
+    DynamicLinesInsideGpu(const uint32_t numberOfLines, const std::vector<std::vector<float>> &colorsOfLayers);
+    // layers without a source are not drawn
+    void draw(const std::vector<std::optional<DbfsInsideGpu::Source>> &sources);
+    static void updateDbfsRange(const float bottomInDbfs, const float topInDbfs);
+    static void initialize();
+    static void finalize();
+private:
+    static const char* getVertexShader();
+    static const char* getFragmentShader();
+
+    struct Vertex
+    {
+        float r, g, b,t;
+    };
+
+    GLuint vao;
+    GLuint colorBuffer;
+    GLuint dbfsBuffer{0};
+
+    const uint32_t numberOfLines;
+    const float xBeginOfLineZero;
+    const float xWidth;
+    DrawCommandTable commands;
+
+    const GLuint ATTR_COLOR = 0u;
+    const GLuint ATTR_DBFS0 = 1u;
+    const GLuint ATTR_DBFS1 = 2u;
+
+    static GLuint vs;
+    static GLuint fs;
+    static GLuint pipeline;
+    static GLuint dbfsRangeLoc;
+    static GLuint horizontalLayoutLoc;
+
+    static constexpr GLuint BINDING_COLOR = 0;
+    static constexpr GLuint BINDING_DBFS = 1;
+    static constexpr GLuint verticesPerLine = 2;
+};
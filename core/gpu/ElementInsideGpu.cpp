@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -18,6 +18,14 @@ void ElementInsideGpu::prepareShaders(GLuint &pipeline, GLuint &vs, GLuint &fs,
     glUseProgramStages(pipeline, GL_FRAGMENT_SHADER_BIT, fs);
 }
 
+void ElementInsideGpu::prepareComputeShader(GLuint &pipeline, GLuint &cs, const char *csConfig)
+{
+    cs = compileShader(csConfig, GL_COMPUTE_SHADER, "CS log");
+
+    glCreateProgramPipelines(1, &pipeline);
+    glUseProgramStages(pipeline, GL_COMPUTE_SHADER_BIT, cs);
+}
+
 void ElementInsideGpu::removeShaders(GLuint &pipeline, GLuint &vs, GLuint &fs)
 {
     glDeleteProgramPipelines(1, &pipeline);
@@ -25,6 +33,12 @@ void ElementInsideGpu::removeShaders(GLuint &pipeline, GLuint &vs, GLuint &fs)
     glDeleteProgram(fs);
 }
 
+void ElementInsideGpu::removeComputeShader(GLuint &pipeline, GLuint &cs)
+{
+    glDeleteProgramPipelines(1, &pipeline);
+    glDeleteProgram(cs);
+}
+
 GLuint ElementInsideGpu::compileShader(const GLchar* source, GLenum stage, const std::string& msg)
 {
     GLuint shdr = glCreateShaderProgramv(stage, 1, &source);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -26,7 +26,9 @@ class ElementInsideGpu
 public:
     static void prepareShaders(GLuint &pipeline, GLuint &vs, GLuint &fs, const char * vsConfig, const char *fsConfig);
 protected:
+    static void prepareComputeShader(GLuint &pipeline, GLuint &cs, const char *csConfig);
     static void removeShaders(GLuint &pipeline, GLuint &vs, GLuint &fs);
+    static void removeComputeShader(GLuint &pipeline, GLuint &cs);
     static const char* getDefaultFragmentShader();
 
     const uint32_t indexOfRed = 0;
@@ -177,32 +177,6 @@ FigureGeometryCalculator::VerticalLineTextPositions FigureGeometryCalculator::ge
     return VerticalLineTextPositions{std::move(positions)};
 }
 
-Lines FigureGeometryCalculator::getDynamicLines(const std::vector<float> &dataToBePrinted)
-{
-    const uint16_t numberOfLines(dataToBePrinted.size()-1);
-    const double fullScreenSize = xDrawSizeInPercents;
-    const double xWidth =  (fullScreenSize/(numberOfLines+1));
-
-    const double xBeginOfLineZero = xDrawOffsetInPercents+xWidth/2;
-
-    std::vector<Line> lines{};
-
-    lines.reserve(numberOfLines);
-
-    for(uint i=0;i<numberOfLines;++i)
-    {
-        double xBegin =  xBeginOfLineZero + i*xWidth;
-        double xEnd = xBegin + xWidth;
-
-        Line line;
-        line.push_back(Point{static_cast<float>(xBegin), static_cast<float>(dataToBePrinted.at(i))});
-        line.push_back(Point{static_cast<float>(xEnd),static_cast<float>(dataToBePrinted.at(i+1))});
-        lines.emplace_back(std::move(line));
-    }
-
-    return lines;
-}
-
 void FigureGeometryCalculator::setHorizontalDrawingArea(const float xDrawOffsetInPercents, const float xDrawSizeInPercents)
 {
     FigureGeometryCalculator::xDrawOffsetInPercents = xDrawOffsetInPercents;
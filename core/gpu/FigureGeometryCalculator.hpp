@@ -32,7 +32,6 @@ struct FigureGeometryCalculator
     static HorizontalLines getHorizontalLines(const Positions &positions);
     static VerticalLines getVerticalLines(const uint16_t numberOfRectangles, const float gap, const std::vector<uint32_t> &indexes);
     static VerticalLineTextPositions getVerticalLineTextPositions(const uint16_t numberOfRectangles, const float gap, const std::vector<uint32_t> &indexes);
-    static Lines getDynamicLines(const std::vector<float> &dataToBePrinted);
     static float getWidthFromWidthInPercents(const float widthInPercents);
     static float getOffsetFromOffsetInPercents(const float offsetInPercents);
     static Line getHighlightedLine(const uint16_t numberOfRectangles, const float gap, const uint16_t rectangleNumber);
@@ -21,6 +21,7 @@ void Gpu::enableTransparency()
 void Gpu::initLines()
 {
     LinesInsideGpu::initialize();
+    DynamicLinesInsideGpu::initialize();
 }
 
 void Gpu::initText()
@@ -35,49 +36,51 @@ void Gpu::initRectangles(const std::string &backgroundConfig, const std::string
     RectanglesInsideGpu<RectangleType::SECONDARY_BAR>::initialize();
 }
 
-void Gpu::prepareBackground(const Rectangles &rectangles)
+void Gpu::initDbfs()
 {
-    background = std::make_unique<RectanglesInsideGpu<RectangleType::BACKGROUND>>(rectangles);
+    DbfsInsideGpu::initialize();
 }
 
-void Gpu::prepareRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle)
+void Gpu::initStaticLayerCache()
 {
-    this->rectangles = std::make_unique<RectanglesInsideGpu<RectangleType::BAR>>(rectangles,  colorsOfRectangle);
+    StaticLayerCache::initialize();
 }
 
-void Gpu::prepareDynamicMaxHoldRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle)
+void Gpu::prepareDbfs(const uint16_t numberOfValues, const std::pair<float, float> &verticalDbfsRange, const std::map<MaxHolderType, MaxHoldSettings> &maxHolds)
 {
-    dynamicMaxHoldRectangles = std::make_unique<RectanglesInsideGpu<RectangleType::BAR>>(rectangles,  colorsOfRectangle);
-}
+    dbfs = std::make_unique<DbfsInsideGpu>(numberOfValues, verticalDbfsRange.first, maxHolds);
 
-void Gpu::prepareDynamicMaxHoldSecondaryRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle)
-{
-    dynamicMaxHoldSecondaryRectangles = std::make_unique<RectanglesInsideGpu<RectangleType::SECONDARY_BAR>>(rectangles,  colorsOfRectangle);
+    RectanglesInsideGpu<RectangleType::BACKGROUND>::updateDbfsRange(verticalDbfsRange.first, verticalDbfsRange.second);
+    RectanglesInsideGpu<RectangleType::BAR>::updateDbfsRange(verticalDbfsRange.first, verticalDbfsRange.second);
+    RectanglesInsideGpu<RectangleType::SECONDARY_BAR>::updateDbfsRange(verticalDbfsRange.first, verticalDbfsRange.second);
+    DynamicLinesInsideGpu::updateDbfsRange(verticalDbfsRange.first, verticalDbfsRange.second);
 }
 
-void Gpu::prepareHorizontalLines(const uint16_t size, const Color &colorOfStaticLines)
+void Gpu::prepareBackground(const Rectangles &rectangles)
 {
-    horizontalLines = std::make_unique<LinesInsideGpu>(size, colorOfStaticLines);
+    background = std::make_unique<RectanglesInsideGpu<RectangleType::BACKGROUND>>(rectangles);
 }
 
-void Gpu::prepareVerticalLines(const uint16_t size, const Color &colorOfStaticLines)
+void Gpu::prepareRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle, const Rectangles &dynamicMaxHoldRectangles, const ColorsOfRectanglePerVertices &colorsOfDynamicMaxHoldRectangle)
 {
-    verticalLines = std::make_unique<LinesInsideGpu>(size, colorOfStaticLines);
+    using Layer = RectanglesInsideGpu<RectangleType::BAR>::Layer;
+
+    this->rectangles = std::make_unique<RectanglesInsideGpu<RectangleType::BAR>>(std::vector<Layer>{Layer{rectangles, colorsOfRectangle}, Layer{dynamicMaxHoldRectangles, colorsOfDynamicMaxHoldRectangle}});
 }
 
-void Gpu::prepareDynamicLines(const uint16_t size, const Color &colorOfDynamicLines)
+void Gpu::prepareDynamicMaxHoldSecondaryRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle)
 {
-    dynamicLines = std::make_unique<LinesInsideGpu>(size, colorOfDynamicLines);
+    dynamicMaxHoldSecondaryRectangles = std::make_unique<RectanglesInsideGpu<RectangleType::SECONDARY_BAR>>(rectangles,  colorsOfRectangle);
 }
 
-void Gpu::prepareDynamicMaxHoldLines(const uint16_t size, const Color &colorOfDynamicLines)
+void Gpu::prepareStaticLines(const uint16_t numberOfHorizontalLines, const uint16_t numberOfVerticalLines, const Color &colorOfStaticLines)
 {
-    dynamicMaxHoldLines = std::make_unique<LinesInsideGpu>(size, colorOfDynamicLines);
+    staticLines = std::make_unique<LinesInsideGpu>(std::vector<LinesInsideGpu::Layer>{{numberOfHorizontalLines, colorOfStaticLines}, {numberOfVerticalLines, colorOfStaticLines}});
 }
 
-void Gpu::prepareDynamicMaxHoldSecondaryLines(const uint16_t size, const Color &colorOfDynamicLines)
+void Gpu::prepareDynamicLines(const uint16_t size, const Color &colorOfDynamicLines, const Color &colorOfDynamicMaxHoldLines, const Color &colorOfDynamicMaxHoldSecondaryLines)
 {
-    dynamicMaxHoldSecondaryLines = std::make_unique<LinesInsideGpu>(size, colorOfDynamicLines);
+    dynamicLines = std::make_unique<DynamicLinesInsideGpu>(size, std::vector<Color>{colorOfDynamicLines, colorOfDynamicMaxHoldLines, colorOfDynamicMaxHoldSecondaryLines});
 }
 
 void Gpu::prepareHorizontalLineStaticTexts(const std::vector<float> &dbfsValues, const Color &colorOfStaticLines)
@@ -113,49 +116,41 @@ void Gpu::updateTime(const float timeInMilliSeconds)
     RectanglesInsideGpu<RectangleType::BACKGROUND>::updateTime(timeInMilliSeconds);
 }
 
-void Gpu::drawBackground()
+void Gpu::updateDbfs(const std::vector<float> &dBFs, const uint32_t timeInMilliSeconds)
 {
-    background->draw();
+    dbfs->update(dBFs, timeInMilliSeconds);
 }
 
-void Gpu::drawHorizontalLines(const Lines &horizontalLinePositions)
+void Gpu::updateFloorDbFs(const float floorDbFs)
 {
-    if(!horizontalLinePositions.empty())
-    {
-        horizontalLines->draw(horizontalLinePositions);
-    }
+    dbfs->updateFloorDbFs(floorDbFs);
 }
 
-void Gpu::drawVerticalLines(const Lines &verticalLinePositions)
+float Gpu::getDynamicMaxHoldValue(const MaxHolderType type, const uint16_t index)
 {
-    if(!verticalLinePositions.empty())
-    {
-        verticalLines->draw(verticalLinePositions);
-    }
+    return dbfs->getMaxHoldValue(type, index);
 }
 
-void Gpu::drawDynamicLines(const Lines &dynamicLinePositions)
+void Gpu::drawBackground()
 {
-    if(!dynamicLinePositions.empty())
-    {
-        dynamicLines->draw(dynamicLinePositions);
-    }
+    background->draw({dbfs->getBottomOfScreen()});
 }
 
-void Gpu::drawDynamicMaxHoldLines(const Lines &dynamicLinePositions)
+void Gpu::drawStaticLines(const Lines &horizontalLinePositions, const Lines &verticalLinePositions)
 {
-    if(!dynamicLinePositions.empty())
+    if(!horizontalLinePositions.empty() || !verticalLinePositions.empty())
     {
-        dynamicMaxHoldLines->draw(dynamicLinePositions);
+        staticLines->draw({horizontalLinePositions, verticalLinePositions});
     }
 }
 
-void Gpu::drawDynamicMaxHoldSecondaryLines(const Lines &dynamicLinePositions)
+void Gpu::drawDynamicLines(const bool dynamicMaxHoldIncluded, const bool dynamicMaxHoldSecondaryIncluded)
 {
-    if(!dynamicLinePositions.empty())
-    {
-        dynamicMaxHoldSecondaryLines->draw(dynamicLinePositions);
-    }
+    using Source = std::optional<DbfsInsideGpu::Source>;
+
+    dynamicLines->draw({dbfs->getSpectrum(),
+                        dynamicMaxHoldIncluded ? Source(dbfs->getMaxHold(MaxHolderType::Dynamic)) : std::nullopt,
+                        dynamicMaxHoldSecondaryIncluded ? Source(dbfs->getMaxHold(MaxHolderType::Transparent)) : std::nullopt});
 }
 
 void Gpu::drawHorizontalLineStaticTexts(const Lines &horizontalLinePositions, const WindowSize &windowSize, const float xDrawOffsetInPercents, const float xDrawSizeInPercents)
@@ -205,28 +200,16 @@ void Gpu::drawVerticalLineStaticTexts(const Positions &verticalLineTextPositions
     }
 }
 
-void Gpu::drawDynamicMaxHoldRectangles(const std::vector<float> &dynamicMaxHoldElementsPosition)
+void Gpu::drawDynamicMaxHoldSecondaryRectangles()
 {
-    if(!dynamicMaxHoldElementsPosition.empty())
-    {
-        dynamicMaxHoldRectangles->move(dynamicMaxHoldElementsPosition);
-    }
+    dynamicMaxHoldSecondaryRectangles->draw({dbfs->getMaxHold(MaxHolderType::Transparent)});
 }
 
-void Gpu::drawDynamicMaxHoldSecondaryRectangles(const std::vector<float> &dynamicMaxHoldElementsPosition)
+void Gpu::drawRectangles(const bool dynamicMaxHoldIncluded)
 {
-    if(!dynamicMaxHoldElementsPosition.empty())
-    {
-        dynamicMaxHoldSecondaryRectangles->move(dynamicMaxHoldElementsPosition);
-    }
-}
+    using Source = std::optional<DbfsInsideGpu::Source>;
 
-void Gpu::drawRectangles(const std::vector<float> &rectaglesPositions)
-{
-    if(!rectaglesPositions.empty())
-    {
-        rectangles->move(rectaglesPositions);
-    }
+    rectangles->draw({dbfs->getSpectrum(), dynamicMaxHoldIncluded ? Source(dbfs->getMaxHold(MaxHolderType::Dynamic)) : std::nullopt});
 }
 
 void Gpu::updateHorizontalRectangleBoundaries(const uint16_t indexOfRectangle, const float start, const float stop)
@@ -236,7 +219,7 @@ void Gpu::updateHorizontalRectangleBoundaries(const uint16_t indexOfRectangle, c
 
 void Gpu::drawHighlightedVerticalLine(const Line &line)
 {
-    highlightedVerticalLine->draw({line});
+    highlightedVerticalLine->draw({{line}});
 }
 
 void Gpu::drawText(const std::string &str, const HorizontalAligment aligment, const float x, const float y)
@@ -244,6 +227,36 @@ void Gpu::drawText(const std::string &str, const HorizontalAligment aligment, co
     dynamicText->draw(str, aligment, VerticalAligment::BOTTOM, x, y);
 }
 
+void Gpu::drawTexts()
+{
+    TextInsideGpu::drawQueued();
+}
+
+bool Gpu::isBackgroundTimeDependent()
+{
+    return RectanglesInsideGpu<RectangleType::BACKGROUND>::isTimeDependent();
+}
+
+bool Gpu::isStaticLayerCacheValid(const WindowSize &windowSize)
+{
+    return staticLayerCache.isValid(windowSize);
+}
+
+void Gpu::startRenderingStaticLayers(const WindowSize &windowSize)
+{
+    staticLayerCache.startRendering(windowSize);
+}
+
+void Gpu::finishRenderingStaticLayers()
+{
+    staticLayerCache.finishRendering();
+}
+
+void Gpu::drawStaticLayers()
+{
+    staticLayerCache.draw();
+}
+
 void Gpu::clear()
 {
     glClear(GL_COLOR_BUFFER_BIT);
@@ -255,6 +268,9 @@ Gpu::~Gpu()
     RectanglesInsideGpu<RectangleType::SECONDARY_BAR>::finalize();
     RectanglesInsideGpu<RectangleType::BAR>::finalize();
     LinesInsideGpu::finalize();
+    DynamicLinesInsideGpu::finalize();
+    DbfsInsideGpu::finalize();
+    StaticLayerCache::finalize();
     TextInsideGpu::finalize();
 }
 
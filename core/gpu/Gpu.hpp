@@ -7,9 +7,13 @@
 #pragma once
 #include "RectanglesInsideGpu.hpp"
 #include "LinesInsideGpu.hpp"
+#include "DynamicLinesInsideGpu.hpp"
+#include "DbfsInsideGpu.hpp"
 #include "TextInsideGpu.hpp"
+#include "StaticLayerCache.hpp"
 #include "CommonTypes.hpp"
 #include <vector>
+#include <map>
 #include <memory>
 
 struct Gpu
@@ -18,36 +22,43 @@ struct Gpu
     void initLines();
     void initText();
     void initRectangles(const std::string &backgroundConfig, const std::string &rectanglesConfig);
+    void initDbfs();
+    void initStaticLayerCache();
     void enableTransparency();
+    void prepareDbfs(const uint16_t numberOfValues, const std::pair<float, float> &verticalDbfsRange, const std::map<MaxHolderType, MaxHoldSettings> &maxHolds);
     void prepareBackground(const Rectangles &rectangles);
-    void prepareRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle);
-    void prepareDynamicMaxHoldRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle);
+    // bars and dynamic max hold rectangles are drawn together, as they share the shader program
+    void prepareRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle, const Rectangles &dynamicMaxHoldRectangles, const ColorsOfRectanglePerVertices &colorsOfDynamicMaxHoldRectangle);
     void prepareDynamicMaxHoldSecondaryRectangles(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle);
-    void prepareHorizontalLines(const uint16_t size, const Color &colorOfStaticLines);
-    void prepareVerticalLines(const uint16_t size, const Color &colorOfStaticLines);
-    void prepareDynamicLines(const uint16_t size, const Color &colorOfDynamicLines);
-    void prepareDynamicMaxHoldLines(const uint16_t size, const Color &colorOfDynamicLines);
-    void prepareDynamicMaxHoldSecondaryLines(const uint16_t size, const Color &colorOfDynamicLines);
+    void prepareStaticLines(const uint16_t numberOfHorizontalLines, const uint16_t numberOfVerticalLines, const Color &colorOfStaticLines);
+    void prepareDynamicLines(const uint16_t size, const Color &colorOfDynamicLines, const Color &colorOfDynamicMaxHoldLines, const Color &colorOfDynamicMaxHoldSecondaryLines);
     void prepareHorizontalLineStaticTexts(const std::vector<float> &dbfsValues, const Color &colorOfStaticLines);
     void prepareVerticalLineStaticTexts(const Frequencies &frequencies, const Color &colorOfStaticLines);
     void prepareHighlightedVerticalLine(const Color &color);
     void prepareDynamicText();
     void updateTime(const float timeInMilliSeconds);
+    void updateDbfs(const std::vector<float> &dBFs, const uint32_t timeInMilliSeconds);
+    void updateFloorDbFs(const float floorDbFs);
+    float getDynamicMaxHoldValue(const MaxHolderType type, const uint16_t index);
     void drawBackground();
-    void drawHorizontalLines(const Lines &horizontalLinePositions);
-    void drawVerticalLines(const Lines &verticalLinePositions);
-    void drawDynamicLines(const Lines &dynamicLinePositions);
-    void drawDynamicMaxHoldLines(const Lines &dynamicLinePositions);
+    void drawStaticLines(const Lines &horizontalLinePositions, const Lines &verticalLinePositions);
+    void drawDynamicLines(const bool dynamicMaxHoldIncluded, const bool dynamicMaxHoldSecondaryIncluded);
     void drawHorizontalLineStaticTexts(const Lines &horizontalLinePositions, const WindowSize &windowSize, const float xDrawOffsetInPercents, const float xDrawSizeInPercents);
     void drawHorizontalLineStaticTexts(const Lines &horizontalLinePositions, const WindowSize &windowSize);
     void drawVerticalLineStaticTexts(const Positions &verticalLineTextPositions, const WindowSize &windowSize);
-    void drawDynamicMaxHoldRectangles(const std::vector<float> &dynamicMaxHoldElementsPosition);
-    void drawDynamicMaxHoldSecondaryRectangles(const std::vector<float> &dynamicMaxHoldElementsPosition);
-    void drawDynamicMaxHoldSecondaryLines(const Lines &dynamicLinePositions);
-    void drawRectangles(const std::vector<float> &rectaglesPositions);
+    void drawDynamicMaxHoldSecondaryRectangles();
+    void drawRectangles(const bool dynamicMaxHoldIncluded);
     void updateHorizontalRectangleBoundaries(const uint16_t indexOfRectangle, const float start, const float stop);
     void drawHighlightedVerticalLine(const Line &line);
     void drawText(const std::string &str, const HorizontalAligment aligment, const float x, const float y);
+    // texts are drawn together with one draw call once all of them are queued
+    void drawTexts();
+    bool isBackgroundTimeDependent();
+    bool isStaticLayerCacheValid(const WindowSize &windowSize);
+    // layers drawn until finishRenderingStaticLayers are cached and shown by drawStaticLayers
+    void startRenderingStaticLayers(const WindowSize &windowSize);
+    void finishRenderingStaticLayers();
+    void drawStaticLayers();
 
     void clear();
     ~Gpu();
@@ -56,18 +67,16 @@ private:
     float convertXPositionInPercentToPixels(const float positionInPercents, const float xScreenSize);
     float convertYPositionInPercentToPixels(const float positionInPercents, const float yScreenSize);
 
+    std::unique_ptr<DbfsInsideGpu> dbfs;
     std::unique_ptr<RectanglesInsideGpu<RectangleType::BACKGROUND>> background;
     std::unique_ptr<RectanglesInsideGpu<RectangleType::BAR>> rectangles;
-    std::unique_ptr<RectanglesInsideGpu<RectangleType::BAR>> dynamicMaxHoldRectangles;
     std::unique_ptr<RectanglesInsideGpu<RectangleType::SECONDARY_BAR>> dynamicMaxHoldSecondaryRectangles;
-    std::unique_ptr<LinesInsideGpu> horizontalLines;
-    std::unique_ptr<LinesInsideGpu> verticalLines;
-    std::unique_ptr<LinesInsideGpu> dynamicLines;
-    std::unique_ptr<LinesInsideGpu> dynamicMaxHoldLines;
-    std::unique_ptr<LinesInsideGpu> dynamicMaxHoldSecondaryLines;
+    std::unique_ptr<LinesInsideGpu> staticLines;
+    std::unique_ptr<DynamicLinesInsideGpu> dynamicLines;
     std::vector<TextInsideGpu> horizontalLineStaticTexts;
     std::vector<TextInsideGpu> verticalLineStaticTexts;
     std::unique_ptr<TextInsideGpu> dynamicText;
     std::unique_ptr<LinesInsideGpu> highlightedVerticalLine;
+    StaticLayerCache staticLayerCache;
 };
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "GpuTimer.hpp"
+
+bool GpuTimer::isSupported()
+{
+    return GLAD_GL_VERSION_3_3;
+}
+
+GpuTimer::GpuTimer(const std::vector<StageMetricsHandle> &metricsOfSections):
+    metricsOfSections(metricsOfSections),
+    queries(numberOfFramesInFlight * metricsOfSections.size(), 0),
+    pendingQueries(queries.size(), false)
+{
+    if(!queries.empty())
+    {
+        glGenQueries(queries.size(), queries.data());
+    }
+}
+
+void GpuTimer::startFrame()
+{
+    currentFrame = (currentFrame + 1) % numberOfFramesInFlight;
+    collectResults(currentFrame);
+}
+
+void GpuTimer::begin(uint32_t section)
+{
+    const auto index = currentFrame * metricsOfSections.size() + section;
+
+    glBeginQuery(GL_TIME_ELAPSED, queries.at(index));
+    pendingQueries.at(index) = true;
+}
+
+void GpuTimer::end()
+{
+    glEndQuery(GL_TIME_ELAPSED);
+}
+
+void GpuTimer::collectResults(uint32_t frame)
+{
+    for(uint32_t section=0; section<metricsOfSections.size(); ++section)
+    {
+        const auto index = frame * metricsOfSections.size() + section;
+
+        if(!pendingQueries.at(index))
+        {
+            continue;
+        }
+
+        GLint isAvailable{GL_FALSE};
+        glGetQueryObjectiv(queries.at(index), GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+
+        if(isAvailable)
+        {
+            GLuint64 elapsedTimeInNanoseconds{0};
+            glGetQueryObjectui64v(queries.at(index), GL_QUERY_RESULT, &elapsedTimeInNanoseconds);
+            metricsOfSections.at(section)->recordProcessingTime(duration_cast<microseconds>(nanoseconds(elapsedTimeInNanoseconds)));
+        }
+
+        pendingQueries.at(index) = false;
+    }
+}
+
+GpuTimer::~GpuTimer()
+{
+    if(!queries.empty())
+    {
+        glDeleteQueries(queries.size(), queries.data());
+    }
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "Stats.hpp"
+#include <glad/glad.h>
+#include <vector>
+
+// GPU time of consecutive sections of a frame measured with GL_TIME_ELAPSED queries.
+// Every frame uses its own set of queries and results are collected when the same set
+// is used again a few frames later, so the CPU never waits for the GPU. A result which
+// is still not available by then is dropped.
+class GpuTimer
+{
+public:
+    static bool isSupported();
+
+    GpuTimer(const std::vector<StageMetricsHandle> &metricsOfSections);
+    GpuTimer(const GpuTimer &) = delete;
+    GpuTimer& operator=(const GpuTimer &) = delete;
+    void startFrame();
+    void begin(uint32_t section);
+    void end();
+    ~GpuTimer();
+
+private:
+    static constexpr uint32_t numberOfFramesInFlight{4};
+
+    void collectResults(uint32_t frame);
+
+    const std::vector<StageMetricsHandle> metricsOfSections;
+    std::vector<GLuint> queries;
+    std::vector<bool> pendingQueries;
+    uint32_t currentFrame{0};
+};
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "InstanceRingBuffer.hpp"
+#include <algorithm>
+
+InstanceRingBuffer::InstanceRingBuffer(const uint32_t numberOfInstances, const uint32_t instanceSize, const uint32_t numberOfFixedInstances):
+    numberOfInstances(numberOfInstances),
+    instancesPerRegion(std::max<uint32_t>(numberOfInstances, 1)),
+    regionSize(instancesPerRegion * instanceSize)
+{
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr size = static_cast<GLsizeiptr>(numberOfRegions) * regionSize + static_cast<GLsizeiptr>(numberOfFixedInstances) * instanceSize;
+
+    glCreateBuffers(1, &buffer);
+    glNamedBufferStorage(buffer, size, nullptr, flags);
+    mappedMemory = static_cast<uint8_t*>(glMapNamedBufferRange(buffer, 0, size, flags));
+}
+
+void InstanceRingBuffer::finishDrawing()
+{
+    fences.at(currentRegion) = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+GLuint InstanceRingBuffer::getBuffer() const
+{
+    return buffer;
+}
+
+GLuint InstanceRingBuffer::getBaseInstance() const
+{
+    return currentRegion * instancesPerRegion;
+}
+
+GLuint InstanceRingBuffer::getBaseInstanceOfFixedInstances() const
+{
+    return numberOfRegions * instancesPerRegion;
+}
+
+uint32_t InstanceRingBuffer::getNumberOfInstances() const
+{
+    return numberOfInstances;
+}
+
+void* InstanceRingBuffer::startWritingNextRegion()
+{
+    currentRegion = (currentRegion + 1) % numberOfRegions;
+    waitForRegion(currentRegion);
+
+    return mappedMemory + currentRegion * regionSize;
+}
+
+void InstanceRingBuffer::waitForRegion(const uint32_t region)
+{
+    auto &fence = fences.at(region);
+
+    if(!fence)
+    {
+        return;
+    }
+
+    while(glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, fenceTimeoutInNanoseconds) == GL_TIMEOUT_EXPIRED);
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+#include <array>
+#include <cstdint>
+
+// Instances rewritten by the CPU every frame. The storage is mapped once with
+// GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT and split into numberOfRegions regions
+// used in turn, so instances are written straight into memory read by the GPU without
+// glNamedBufferSubData copies. The draw of a region is fenced and the fence is waited
+// for before the region is written again, which blocks only when the GPU is
+// numberOfRegions frames behind. Regions are selected with the base instance of the draw,
+// so the vertex array keeps the buffer bound at offset 0.
+// Fixed instances are kept after the regions and are not rewritten every frame, so layers
+// reading them are drawn from the same buffer. The mapping is write only, values written
+// by the GPU have to be copied elsewhere and fenced before the CPU reads them.
+class InstanceRingBuffer
+{
+public:
+    static constexpr uint32_t numberOfRegions{3};
+
+    InstanceRingBuffer(const uint32_t numberOfInstances, const uint32_t instanceSize, const uint32_t numberOfFixedInstances = 0);
+    InstanceRingBuffer(const InstanceRingBuffer &) = delete;
+    InstanceRingBuffer& operator=(const InstanceRingBuffer &) = delete;
+
+    template<typename Instance>
+    Instance* startWriting()
+    {
+        return static_cast<Instance*>(startWritingNextRegion());
+    }
+
+    template<typename Instance>
+    Instance* getFixedInstances()
+    {
+        return reinterpret_cast<Instance*>(mappedMemory + numberOfRegions * regionSize);
+    }
+
+    // to be called right after the draw of the region returned by startWriting
+    void finishDrawing();
+    GLuint getBuffer() const;
+    GLuint getBaseInstance() const;
+    GLuint getBaseInstanceOfFixedInstances() const;
+    uint32_t getNumberOfInstances() const;
+
+private:
+    static constexpr GLuint64 fenceTimeoutInNanoseconds{1000000000};
+
+    void* startWritingNextRegion();
+    void waitForRegion(const uint32_t region);
+
+    const uint32_t numberOfInstances;
+    // an empty buffer still gets one instance per region, as storage of size 0 is not allowed
+    const uint32_t instancesPerRegion;
+    const uint32_t regionSize;
+    GLuint buffer{0};
+    uint8_t *mappedMemory{nullptr};
+    uint32_t currentRegion{numberOfRegions - 1};
+    std::array<GLsync, numberOfRegions> fences{};
+};
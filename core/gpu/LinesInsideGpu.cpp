@@ -11,13 +11,36 @@ GLuint LinesInsideGpu::fs = 0;
 GLuint LinesInsideGpu::pipeline = 0;
 
 
-LinesInsideGpu::LinesInsideGpu(const uint32_t numberOfLines, const std::vector<float> &color) : instances(numberOfLines)
+namespace
 {
-    const std::vector<Vertex> colors =
+
+uint32_t getNumberOfLines(const std::vector<LinesInsideGpu::Layer> &layers)
+{
+    uint32_t numberOfLines{0};
+
+    for(const auto &layer : layers)
     {
-        {color.at(0),color.at(1),color.at(2),color.at(3)},
-        {color.at(0),color.at(1),color.at(2),color.at(3)}
-    };
+        numberOfLines += layer.numberOfLines;
+    }
+
+    return numberOfLines;
+}
+
+}
+
+LinesInsideGpu::LinesInsideGpu(const std::vector<Layer> &layers) :
+    instances(getNumberOfLines(layers), sizeof(Instance)),
+    commands(layers.size())
+{
+    std::vector<Vertex> colors;
+
+    for(const auto &[numberOfLines, color] : layers)
+    {
+        colors.insert(colors.end(), verticesPerLine, Vertex{color.at(0),color.at(1),color.at(2),color.at(3)});
+
+        firstInstancesOfLayers.push_back(firstInstancesOfLayers.empty() ? 0 : firstInstancesOfLayers.back() + numbersOfLinesOfLayers.back());
+        numbersOfLinesOfLayers.push_back(numberOfLines);
+    }
 
     glCreateVertexArrays(1, &vao);
 
@@ -29,9 +52,6 @@ LinesInsideGpu::LinesInsideGpu(const uint32_t numberOfLines, const std::vector<f
     glVertexArrayVertexBuffer(vao, BINDING_COLOR, colorBuffer, 0, sizeof(Vertex));
     glVertexArrayAttribBinding(vao, ATTR_COLOR, BINDING_COLOR);
 
-    glCreateBuffers(1, &instanceBuffer);
-    glNamedBufferStorage(instanceBuffer,instances.size() * sizeof(Instance),nullptr,GL_DYNAMIC_STORAGE_BIT);
-
     glEnableVertexArrayAttrib(vao, ATTR_P0);
     glVertexArrayAttribFormat(vao, ATTR_P0, 2, GL_FLOAT, GL_FALSE, offsetof(Instance, x0));
     glVertexArrayAttribBinding(vao, ATTR_P0, BINDING_INSTANCE);
@@ -40,31 +60,42 @@ LinesInsideGpu::LinesInsideGpu(const uint32_t numberOfLines, const std::vector<f
     glVertexArrayAttribFormat(vao, ATTR_P1, 2, GL_FLOAT, GL_FALSE, offsetof(Instance, x1));
     glVertexArrayAttribBinding(vao, ATTR_P1, BINDING_INSTANCE);
 
-    glVertexArrayVertexBuffer(vao, BINDING_INSTANCE, instanceBuffer, 0, sizeof(Instance));
+    glVertexArrayVertexBuffer(vao, BINDING_INSTANCE, instances.getBuffer(), 0, sizeof(Instance));
     glVertexArrayBindingDivisor(vao, BINDING_INSTANCE, 1);
 }
 
-void LinesInsideGpu::draw(const Lines &lines)
+LinesInsideGpu::LinesInsideGpu(const uint32_t numberOfLines, const std::vector<float> &color) :
+    LinesInsideGpu(std::vector<Layer>{Layer{numberOfLines, color}})
+{
+}
+
+void LinesInsideGpu::draw(const std::vector<Lines> &linesOfLayers)
 {
-    for (int i = 0; i < std::min(instances.size(), lines.size()); i++)
+    auto *mappedInstances = instances.startWriting<Instance>();
+
+    for(uint32_t layer=0; layer<commands.getNumberOfLayers(); ++layer)
     {
-        instances[i].x0 = percentToPositon(lines[i][0].x);
-        instances[i].y0 = percentToPositon(lines[i][0].y);
+        const auto &lines = linesOfLayers.at(layer);
+        const uint32_t numberOfLines = std::min<uint32_t>(numbersOfLinesOfLayers.at(layer), lines.size());
+        auto *mappedInstancesOfLayer = mappedInstances + firstInstancesOfLayers.at(layer);
 
-        instances[i].x1 = percentToPositon(lines[i][1].x);
-        instances[i].y1 = percentToPositon(lines[i][1].y);
-    }
+        for (uint32_t i = 0; i < numberOfLines; i++)
+        {
+            mappedInstancesOfLayer[i].x0 = percentToPositon(lines[i][0].x);
+            mappedInstancesOfLayer[i].y0 = percentToPositon(lines[i][0].y);
 
-    glNamedBufferSubData(instanceBuffer,
-                         0,
-                         instances.size() * sizeof(Instance),
-                         instances.data());
+            mappedInstancesOfLayer[i].x1 = percentToPositon(lines[i][1].x);
+            mappedInstancesOfLayer[i].y1 = percentToPositon(lines[i][1].y);
+        }
 
+        commands.set(layer, verticesPerLine, numberOfLines, layer * verticesPerLine, instances.getBaseInstance() + firstInstancesOfLayers.at(layer));
+    }
 
     glBindProgramPipeline(pipeline);
     glBindVertexArray(vao);
 
-    glDrawArraysInstanced(GL_LINES, 0, 2, instances.size());
+    commands.draw(GL_LINES);
+    instances.finishDrawing();
 }
 
 float LinesInsideGpu::percentToPositon(float percent)
@@ -95,7 +126,9 @@ out vec4 vColor;
 
 void main()
 {
-    vec2 pos = (gl_VertexID == 0) ? p0 : p1;
+    // vertices of all layers are kept in one buffer, so a layer starts at its own vertex
+    int end = gl_VertexID % 2;
+    vec2 pos = (end == 0) ? p0 : p1;
 
     gl_Position = vec4(pos, 0.0, 1.0);
     vColor = color;
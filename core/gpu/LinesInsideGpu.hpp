@@ -7,14 +7,26 @@
 #pragma once
 
 #include "ElementInsideGpu.hpp"
+#include "InstanceRingBuffer.hpp"
+#include "DrawCommandTable.hpp"
 #include <glad/glad.h>
 #include <vector>
 
+// Layers of lines with positions given by the CPU every frame. Instances of all layers
+// share one ring and the layers are drawn by a single multi-draw, see DrawCommandTable.
 class LinesInsideGpu : public ElementInsideGpu
 {
 public:
+    struct Layer
+    {
+        uint32_t numberOfLines;
+        std::vector<float> color;
+    };
+
+    LinesInsideGpu(const std::vector<Layer> &layers);
     LinesInsideGpu(const uint32_t numberOfLines, const std::vector<float> &color={1.0, 1.0,1.0,1.0});
-    void draw(const Lines &lines);
+    // lines of each layer, lines above the number of lines of the layer are not drawn
+    void draw(const std::vector<Lines> &linesOfLayers);
     static void initialize();
     static void finalize();
 private:
@@ -35,9 +47,11 @@ private:
 
     GLuint vao;
     GLuint colorBuffer;
-    GLuint instanceBuffer;
 
-    std::vector<Instance> instances;
+    std::vector<uint32_t> firstInstancesOfLayers;
+    std::vector<uint32_t> numbersOfLinesOfLayers;
+    InstanceRingBuffer instances;
+    DrawCommandTable commands;
 
     const GLuint ATTR_COLOR = 0u;
     const GLuint ATTR_P0    = 1u;
@@ -49,5 +63,6 @@ private:
 
     static constexpr GLuint BINDING_COLOR    = 0;
     static constexpr GLuint BINDING_INSTANCE = 1;
+    static constexpr GLuint verticesPerLine = 2;
 };
 
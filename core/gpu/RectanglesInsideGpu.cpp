@@ -16,38 +16,40 @@ template<RectangleType rectangleType>
 GLuint RectanglesInsideGpu<rectangleType>::pipeline = 0;
 
 template<RectangleType rectangleType>
-GLuint RectanglesInsideGpu<rectangleType>::timeLoc = 0;
+GLint RectanglesInsideGpu<rectangleType>::timeLoc = 0;
 
 template<RectangleType rectangleType>
 GLuint RectanglesInsideGpu<rectangleType>::boundaryLoc = 0;
 
+template<RectangleType rectangleType>
+GLuint RectanglesInsideGpu<rectangleType>::dbfsRangeLoc = 0;
+
 
 template<RectangleType rectangleType>
-RectanglesInsideGpu<rectangleType>::RectanglesInsideGpu(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle):
-    instances(std::vector<Instance>(rectangles.size()))
+RectanglesInsideGpu<rectangleType>::RectanglesInsideGpu(const std::vector<Layer> &layers):
+    commands(layers.size())
 {
+    std::vector<Vertex> vertices;
+    vertices.reserve(layers.size() * verticesPerRectangle);
 
-    const auto &rectangle = rectangles.at(0);
-
-    for (uint32_t i = 0; i < instances.size(); i++)
+    for(const auto &[rectangles, colorsOfRectangle] : layers)
     {
-        instances[i].x = rectangles.at(i).at(0).x - rectangle.at(0).x;
-        instances[i].y = 0.0f;
-    }
+        const auto &rectangle = rectangles.at(0);
+        const float xStep = (rectangles.size() > 1) ? (rectangles.back().at(0).x - rectangle.at(0).x) / (rectangles.size() - 1) : 0;
 
-    const std::vector<Vertex> rect =
+        for(uint32_t i=0; i<verticesPerRectangle; ++i)
         {
-            {rectangle.at(0).x, rectangle.at(0).y, colorsOfRectangle.at(0).at(indexOfRed), colorsOfRectangle.at(0).at(indexOfGreen),colorsOfRectangle.at(0).at(indexOfBlue), colorsOfRectangle.at(0).at(indexOfTransparency)},  //0
-            {rectangle.at(1).x, rectangle.at(1).y, colorsOfRectangle.at(1).at(indexOfRed), colorsOfRectangle.at(1).at(indexOfGreen),colorsOfRectangle.at(1).at(indexOfBlue), colorsOfRectangle.at(1).at(indexOfTransparency)},  //1
-            {rectangle.at(2).x, rectangle.at(2).y, colorsOfRectangle.at(2).at(indexOfRed), colorsOfRectangle.at(2).at(indexOfGreen),colorsOfRectangle.at(2).at(indexOfBlue), colorsOfRectangle.at(2).at(indexOfTransparency)},  //2
-            {rectangle.at(3).x, rectangle.at(3).y, colorsOfRectangle.at(3).at(indexOfRed), colorsOfRectangle.at(3).at(indexOfGreen),colorsOfRectangle.at(3).at(indexOfBlue), colorsOfRectangle.at(3).at(indexOfTransparency)}   //3
-        };
+            const auto &color = colorsOfRectangle.at(i);
+            vertices.push_back(Vertex{rectangle.at(i).x, rectangle.at(i).y, color.at(indexOfRed), color.at(indexOfGreen), color.at(indexOfBlue), color.at(indexOfTransparency), xStep});
+        }
 
+        numbersOfInstances.push_back(rectangles.size());
+    }
 
     glCreateVertexArrays(1, &vao);
     glCreateBuffers(1, &vertexBuffer);
 
-    glNamedBufferStorage(vertexBuffer,rect.size() * sizeof(Vertex),rect.data(),0);
+    glNamedBufferStorage(vertexBuffer,vertices.size() * sizeof(Vertex),vertices.data(),0);
 
     glVertexArrayVertexBuffer(vao, BINDING_VERTEX, vertexBuffer, 0, sizeof(Vertex));
 
@@ -59,18 +61,21 @@ RectanglesInsideGpu<rectangleType>::RectanglesInsideGpu(const Rectangles &rectan
     glVertexArrayAttribFormat(vao, ATTR_COLOR, 4, GL_FLOAT, GL_FALSE, offsetof(Vertex, r));
     glVertexArrayAttribBinding(vao, ATTR_COLOR, BINDING_VERTEX);
 
-    glCreateBuffers(1, &instancesBuffer);
-
-    glNamedBufferStorage(instancesBuffer,instances.size() * sizeof(Instance),nullptr,GL_DYNAMIC_STORAGE_BIT);
-    glNamedBufferSubData(instancesBuffer,0,instances.size() * sizeof(Instance),instances.data());
+    glEnableVertexArrayAttrib(vao, ATTR_STEP);
+    glVertexArrayAttribFormat(vao, ATTR_STEP, 1, GL_FLOAT, GL_FALSE, offsetof(Vertex, xStep));
+    glVertexArrayAttribBinding(vao, ATTR_STEP, BINDING_VERTEX);
 
-    glVertexArrayVertexBuffer(vao, BINDING_INSTANCE, instancesBuffer, 0, sizeof(Instance));
+    glEnableVertexArrayAttrib(vao, ATTR_DBFS);
+    glVertexArrayAttribFormat(vao, ATTR_DBFS, 1, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(vao, ATTR_DBFS, BINDING_DBFS);
 
-    glEnableVertexArrayAttrib(vao, ATTR_OFFSET);
-    glVertexArrayAttribFormat(vao, ATTR_OFFSET, 2, GL_FLOAT, GL_FALSE, offsetof(Instance, x));
-    glVertexArrayAttribBinding(vao, ATTR_OFFSET, BINDING_INSTANCE);
+    glVertexArrayBindingDivisor(vao, BINDING_DBFS, 1);
+}
 
-    glVertexArrayBindingDivisor(vao, BINDING_INSTANCE, 1);
+template<RectangleType rectangleType>
+RectanglesInsideGpu<rectangleType>::RectanglesInsideGpu(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle):
+    RectanglesInsideGpu(std::vector<Layer>{Layer{rectangles, colorsOfRectangle}})
+{
 }
 
 template<RectangleType rectangleType>
@@ -79,6 +84,7 @@ void RectanglesInsideGpu<rectangleType>::initialize(const char *fsConfig)
     prepareShaders(pipeline, vs, fs, getVertexShader(),fsConfig);
     timeLoc = glGetUniformLocation(fs, "timeInMilliSeconds");
     boundaryLoc = glGetUniformLocation(fs, "boundary");
+    dbfsRangeLoc = glGetUniformLocation(vs, "dbfsRange");
 }
 
 template<RectangleType rectangleType>
@@ -87,12 +93,6 @@ void RectanglesInsideGpu<rectangleType>::finalize()
     ElementInsideGpu::removeShaders(pipeline, vs,fs);
 }
 
-template<RectangleType rectangleType>
-float RectanglesInsideGpu<rectangleType>::percentToPositon(float percent)
-{
-    return (std::min<float>(percent, 100)/50) -2;
-}
-
 template<RectangleType rectangleType>
 const char* RectanglesInsideGpu<rectangleType>::getVertexShader()
 {
@@ -101,14 +101,20 @@ const char* RectanglesInsideGpu<rectangleType>::getVertexShader()
 
 layout(location = 0) in vec2 pos;
 layout(location = 1) in vec4 vertexColor;
-layout(location = 2) in vec2 offset;
+layout(location = 2) in float xStep;
+layout(location = 3) in float dBFs;
+
+uniform vec2 dbfsRange;
 
 out vec4 vColor;
 out vec4 calculatedPosition;
 
 void main()
 {
-    gl_Position = vec4(pos + offset, 0.0, 1.0);
+    float percent = (dBFs - dbfsRange.x) * 100.0 / (dbfsRange.y - dbfsRange.x);
+    float yOffset = min(percent, 100.0) / 50.0 - 2.0;
+
+    gl_Position = vec4(pos + vec2(gl_InstanceID * xStep, yOffset), 0.0, 1.0);
     calculatedPosition = gl_Position;
     vColor = vertexColor;
 }
@@ -120,37 +126,55 @@ void main()
 template<RectangleType rectangleType>
 void RectanglesInsideGpu<rectangleType>::updateTime(const float timeInMilliSeconds)
 {
-    glBindProgramPipeline(pipeline);
     glProgramUniform1f(fs, timeLoc, timeInMilliSeconds);
 }
 
 template<RectangleType rectangleType>
 void RectanglesInsideGpu<rectangleType>::updateBoundary(const float xBegin, const float xEnd)
 {
-    glBindProgramPipeline(pipeline);
     glProgramUniform2f(fs, boundaryLoc, xBegin, xEnd);
 }
 
 template<RectangleType rectangleType>
-void RectanglesInsideGpu<rectangleType>::move(const std::vector<float> &positionsInPercents)
+void RectanglesInsideGpu<rectangleType>::updateDbfsRange(const float bottomInDbfs, const float topInDbfs)
 {
-    for(uint32_t i=0;i<std::min(instances.size(), positionsInPercents.size());++i)
+    glProgramUniform2f(vs, dbfsRangeLoc, bottomInDbfs, topInDbfs);
+}
+
+template<RectangleType rectangleType>
+bool RectanglesInsideGpu<rectangleType>::isTimeDependent()
+{
+    // uniforms not used by the shader are removed by the compiler and have no location
+    return timeLoc != -1;
+}
+
+template<RectangleType rectangleType>
+void RectanglesInsideGpu<rectangleType>::draw(const std::vector<std::optional<DbfsInsideGpu::Source>> &sources)
+{
+    for(uint32_t layer=0; layer<commands.getNumberOfLayers(); ++layer)
     {
-        instances[i].y = percentToPositon(positionsInPercents.at(i));
-    }
+        const auto &source = sources.at(layer);
 
-    glNamedBufferSubData(instancesBuffer,0,instances.size() * sizeof(Instance), instances.data());
+        if(!source)
+        {
+            commands.hide(layer);
+            continue;
+        }
+
+        // every source of a layer is kept in the same buffer
+        if(source->buffer != dbfsBuffer)
+        {
+            dbfsBuffer = source->buffer;
+            glVertexArrayVertexBuffer(vao, BINDING_DBFS, dbfsBuffer, 0, sizeof(float));
+        }
+
+        commands.set(layer, verticesPerRectangle, numbersOfInstances.at(layer), layer * verticesPerRectangle, source->baseInstance);
+    }
 
     glBindProgramPipeline(pipeline);
     glBindVertexArray(vao);
 
-    glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, 4, instances.size());
-}
-
-template<RectangleType rectangleType>
-void RectanglesInsideGpu<rectangleType>::draw()
-{
-    move(std::vector<float>(instances.size(),0));
+    commands.draw(GL_TRIANGLE_FAN);
 }
 
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -8,7 +8,10 @@
 
 #include "ConfigReader.hpp"
 #include "ElementInsideGpu.hpp"
+#include "DbfsInsideGpu.hpp"
+#include "DrawCommandTable.hpp"
 #include <glad/glad.h>
+#include <optional>
 
 enum class RectangleType
 {
@@ -17,51 +20,64 @@ enum class RectangleType
     BACKGROUND
 };
 
+// Layers of evenly spaced rectangles drawn with one shader program. Vertices of all layers
+// share one buffer and the layers are drawn by a single multi-draw, see DrawCommandTable.
 template<RectangleType rectangleType>
 class RectanglesInsideGpu : public ElementInsideGpu
 {
 public:
+    struct Layer
+    {
+        Rectangles rectangles;
+        ColorsOfRectanglePerVertices colorsOfRectangle;
+    };
 
+    RectanglesInsideGpu(const std::vector<Layer> &layers);
     RectanglesInsideGpu(const Rectangles &rectangles, const ColorsOfRectanglePerVertices &colorsOfRectangle={{0,{1,1,1,1}}, {1,{1,1,1,1}},{2,{1,1,1,1}},{3,{1,1,1,1}}});
 
-    void move(const std::vector<float> &positionsInPercents);
-    void draw();
+    // heights of the instances of a layer are read from the dBFS values of its source,
+    // layers without a source are not drawn
+    void draw(const std::vector<std::optional<DbfsInsideGpu::Source>> &sources);
     static void updateTime(const float timeInMilliSeconds);
     static void updateBoundary(const float xBegin, const float xEnd);
+    static void updateDbfsRange(const float bottomInDbfs, const float topInDbfs);
+    // whether the fragment shader uses timeInMilliSeconds, so the layer changes every frame
+    static bool isTimeDependent();
     static void initialize(const char *fsConfig = getDefaultFragmentShader());
     static void finalize();
 private:
-    float percentToPositon(float percent);
     static const char* getVertexShader();
 
-    struct Instance
-    {
-        float x, y;
-    };
-
+    // x offset of an instance is its gl_InstanceID multiplied by xStep, so the instanced
+    // attributes are only the dBFS values selected by the base instance of the layer
     struct Vertex
     {
         float x, y;
         float r, g, b, t;
+        float xStep;
     };
 
     GLuint vao;
     GLuint vertexBuffer;
-    GLuint instancesBuffer;
+    GLuint dbfsBuffer{0};
 
     const GLuint ATTR_POS = 0u;
     const GLuint ATTR_COLOR = 1u;
-    const GLuint ATTR_OFFSET = 2u;
+    const GLuint ATTR_STEP = 2u;
+    const GLuint ATTR_DBFS = 3u;
 
-    std::vector<Instance> instances;
+    std::vector<uint32_t> numbersOfInstances;
+    DrawCommandTable commands;
 
     static GLuint vs;
     static GLuint fs;
 
     static GLuint pipeline;
-    static GLuint timeLoc;
+    static GLint timeLoc;
     static GLuint boundaryLoc;
+    static GLuint dbfsRangeLoc;
 
     static constexpr GLuint BINDING_VERTEX = 0;
-    static constexpr GLuint BINDING_INSTANCE = 1;
+    static constexpr GLuint BINDING_DBFS = 2;
+    static constexpr GLuint verticesPerRectangle = 4;
 };
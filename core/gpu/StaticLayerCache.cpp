@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "StaticLayerCache.hpp"
+
+GLuint StaticLayerCache::vs = 0;
+GLuint StaticLayerCache::fs = 0;
+GLuint StaticLayerCache::pipeline = 0;
+GLuint StaticLayerCache::vao = 0;
+
+
+StaticLayerCache::~StaticLayerCache()
+{
+    removeTexture();
+}
+
+bool StaticLayerCache::isValid(const WindowSize &windowSize) const
+{
+    return valid && (sizeOfTexture.x == windowSize.x) && (sizeOfTexture.y == windowSize.y);
+}
+
+void StaticLayerCache::startRendering(const WindowSize &windowSize)
+{
+    if((sizeOfTexture.x != windowSize.x) || (sizeOfTexture.y != windowSize.y))
+    {
+        removeTexture();
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureStorage2D(texture, 1, GL_RGBA8, windowSize.x, windowSize.y);
+
+        glCreateFramebuffers(1, &framebuffer);
+        glNamedFramebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0, texture, 0);
+
+        sizeOfTexture = windowSize;
+    }
+
+    const GLfloat transparent[] = {0, 0, 0, 0};
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, sizeOfTexture.x, sizeOfTexture.y);
+    glClearNamedFramebufferfv(framebuffer, GL_COLOR, 0, transparent);
+
+    // colors are premultiplied by alpha and alpha is accumulated as it is on the screen
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void StaticLayerCache::finishRendering()
+{
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, sizeOfTexture.x, sizeOfTexture.y);
+
+    valid = true;
+}
+
+void StaticLayerCache::draw()
+{
+    glBindProgramPipeline(pipeline);
+    glBindVertexArray(vao);
+    glBindTextureUnit(0, texture);
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void StaticLayerCache::removeTexture()
+{
+    if(texture)
+    {
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteTextures(1, &texture);
+    }
+
+    framebuffer = 0;
+    texture = 0;
+    sizeOfTexture = WindowSize{0, 0};
+}
+
+void StaticLayerCache::initialize()
+{
+    prepareShaders(pipeline, vs, fs, getVertexShader(), getFragmentShader());
+    glCreateVertexArrays(1, &vao);
+}
+
+void StaticLayerCache::finalize()
+{
+    glDeleteVertexArrays(1, &vao);
+    ElementInsideGpu::removeShaders(pipeline, vs, fs);
+}
+
+const char* StaticLayerCache::getVertexShader()
+{
+    const char *vertexShaderSrc = R"(
+#version 330 core
+
+void main()
+{
+    vec2 pos = vec2((gl_VertexID == 1) ? 3.0 : -1.0, (gl_VertexID == 2) ? 3.0 : -1.0);
+
+    gl_Position = vec4(pos, 0.0, 1.0);
+}
+)";
+
+    return vertexShaderSrc;
+}
+
+// the blending of the screen multiplies colors by alpha again, so they are divided by it here
+const char* StaticLayerCache::getFragmentShader()
+{
+    const char *fragmentShaderSrc = R"(
+#version 330 core
+
+uniform sampler2D staticLayers;
+out vec4 FragColor;
+
+void main()
+{
+    vec4 premultipliedColor = texelFetch(staticLayers, ivec2(gl_FragCoord.xy), 0);
+
+    if(premultipliedColor.a == 0.0)
+    {
+        discard;
+    }
+
+    FragColor = vec4(premultipliedColor.rgb / premultipliedColor.a, premultipliedColor.a);
+}
+)";
+
+    return fragmentShaderSrc;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "ElementInsideGpu.hpp"
+#include "CommonTypes.hpp"
+#include <glad/glad.h>
+
+// Layers which do not change from frame to frame (grid lines, their labels and a background
+// which does not depend on time) rendered once into a texture of the size of the window and
+// composited with a single triangle covering the screen every frame. They are rendered
+// again only when the size of the window changes. The texture keeps colors premultiplied
+// by alpha, so the composited layers are blended exactly as if drawn one by one.
+class StaticLayerCache : public ElementInsideGpu
+{
+public:
+    StaticLayerCache() = default;
+    StaticLayerCache(const StaticLayerCache &) = delete;
+    StaticLayerCache& operator=(const StaticLayerCache &) = delete;
+    ~StaticLayerCache();
+
+    bool isValid(const WindowSize &windowSize) const;
+    // layers drawn between these two calls go into the texture instead of the screen
+    void startRendering(const WindowSize &windowSize);
+    void finishRendering();
+    void draw();
+
+    static void initialize();
+    static void finalize();
+
+private:
+    static const char* getVertexShader();
+    static const char* getFragmentShader();
+
+    void removeTexture();
+
+    GLuint framebuffer{0};
+    GLuint texture{0};
+    WindowSize sizeOfTexture{0, 0};
+    bool valid{false};
+
+    static GLuint vs;
+    static GLuint fs;
+    static GLuint pipeline;
+    static GLuint vao;
+};
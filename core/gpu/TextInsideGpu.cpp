@@ -5,73 +5,248 @@
  */
 
 #include "TextInsideGpu.hpp"
+#include "ElementInsideGpu.hpp"
+#include "InstanceRingBuffer.hpp"
+#include "TextLayout.hpp"
 #include <glad/glad.h>
 #define GLT_IMPLEMENTATION
+// only a part of glText is used, so its other static functions are never called
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
 #include "../glText/gltext.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 #include <cstdio>
 #include <cmath>
 
-class TextInsideGpu::TextInsideGpuImpl
+// glText is used only for its glyph atlas. Glyphs of all texts drawn between two calls of
+// drawQueued are queued as instances of one quad and drawn with a single instanced draw,
+// and the layout of a text is calculated again only when its string changes, see TextLayout.
+class TextInsideGpu::TextInsideGpuImpl : public ElementInsideGpu
 {
 public:
     TextInsideGpuImpl(const std::string &str, const std::vector<float> &color);
-    void draw(const uint16_t horizontalAligment, const uint16_t verticalAligment, const float x, const float y);
-    void draw(const std::string &str, const uint16_t horizontalAligment, const uint16_t verticalAligment, const float x, const float y);
+    void draw(const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y);
+    void draw(const std::string &str, const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y);
+    static void drawQueued();
     static void initialize();
     static void finalize();
     ~TextInsideGpuImpl() = default;
 private:
+    // in pixels from the top left corner of the window, as in glText
+    struct Glyph
+    {
+        float x, y;
+        float width, height;
+        float u1, v1;
+        float u2, v2;
+        float r, g, b, a;
+    };
+
+    static FontMetrics getFontMetrics();
+    static const char* getVertexShader();
+    static const char* getFragmentShader();
+
     const std::vector<float> color;
-    std::unique_ptr<GLTtext, void(*)(GLTtext*)> textPtr;
+    std::string str;
+    TextLayout layout;
+    bool layoutValid{false};
+
+    static FontMetrics font;
+    static std::vector<Glyph> queuedGlyphs;
+    static std::unique_ptr<InstanceRingBuffer> glyphs;
+    static GLuint vs;
+    static GLuint fs;
+    static GLuint pipeline;
+    static GLuint vao;
+    static GLint windowSizeLoc;
+
+    static constexpr GLuint ATTR_RECT = 0;
+    static constexpr GLuint ATTR_UV = 1;
+    static constexpr GLuint ATTR_COLOR = 2;
+    static constexpr GLuint BINDING_GLYPHS = 0;
+    static constexpr uint32_t maxNumberOfGlyphsPerDraw{4096};
 };
 
+FontMetrics TextInsideGpu::TextInsideGpuImpl::font;
+std::vector<TextInsideGpu::TextInsideGpuImpl::Glyph> TextInsideGpu::TextInsideGpuImpl::queuedGlyphs;
+std::unique_ptr<InstanceRingBuffer> TextInsideGpu::TextInsideGpuImpl::glyphs;
+GLuint TextInsideGpu::TextInsideGpuImpl::vs = 0;
+GLuint TextInsideGpu::TextInsideGpuImpl::fs = 0;
+GLuint TextInsideGpu::TextInsideGpuImpl::pipeline = 0;
+GLuint TextInsideGpu::TextInsideGpuImpl::vao = 0;
+GLint TextInsideGpu::TextInsideGpuImpl::windowSizeLoc = 0;
+
 
 void TextInsideGpu::TextInsideGpuImpl::initialize()
 {
     gltInit();
+    font = getFontMetrics();
+
+    prepareShaders(pipeline, vs, fs, getVertexShader(), getFragmentShader());
+    windowSizeLoc = glGetUniformLocation(vs, "windowSize");
+
+    glyphs = std::make_unique<InstanceRingBuffer>(maxNumberOfGlyphsPerDraw, sizeof(Glyph));
+
+    glCreateVertexArrays(1, &vao);
+
+    glEnableVertexArrayAttrib(vao, ATTR_RECT);
+    glVertexArrayAttribFormat(vao, ATTR_RECT, 4, GL_FLOAT, GL_FALSE, offsetof(Glyph, x));
+    glVertexArrayAttribBinding(vao, ATTR_RECT, BINDING_GLYPHS);
+
+    glEnableVertexArrayAttrib(vao, ATTR_UV);
+    glVertexArrayAttribFormat(vao, ATTR_UV, 4, GL_FLOAT, GL_FALSE, offsetof(Glyph, u1));
+    glVertexArrayAttribBinding(vao, ATTR_UV, BINDING_GLYPHS);
+
+    glEnableVertexArrayAttrib(vao, ATTR_COLOR);
+    glVertexArrayAttribFormat(vao, ATTR_COLOR, 4, GL_FLOAT, GL_FALSE, offsetof(Glyph, r));
+    glVertexArrayAttribBinding(vao, ATTR_COLOR, BINDING_GLYPHS);
+
+    glVertexArrayVertexBuffer(vao, BINDING_GLYPHS, glyphs->getBuffer(), 0, sizeof(Glyph));
+    glVertexArrayBindingDivisor(vao, BINDING_GLYPHS, 1);
 }
 
-TextInsideGpu::TextInsideGpuImpl::TextInsideGpuImpl(const std::string &str, const std::vector<float> &color) :textPtr(gltCreateText(), gltDeleteText), color(color)
+TextInsideGpu::TextInsideGpuImpl::TextInsideGpuImpl(const std::string &str, const std::vector<float> &color) : color(color), str(str)
 {
-    gltSetText(textPtr.get(), str.c_str());
 }
 
-void TextInsideGpu::TextInsideGpuImpl::draw(const uint16_t horizontalAligment, const uint16_t verticalAligment, const float x, const float y)
+void TextInsideGpu::TextInsideGpuImpl::draw(const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y)
 {
-    gltBeginDraw();
-    gltColor(color.at(0), color.at(1), color.at(2), color.at(3));
+    if(!layoutValid)
+    {
+        layout = layOutText(str, font);
+        layoutValid = true;
+    }
+
+    const auto [xOffset, yOffset] = getAlignmentOffset(layout, horizontalAligment, verticalAligment);
+
+    for(const auto &glyph : layout.glyphs)
+    {
+        queuedGlyphs.push_back(Glyph{x + xOffset + glyph.x, y + yOffset + glyph.y, glyph.width, glyph.height,
+                                     glyph.u1, glyph.v1, glyph.u2, glyph.v2,
+                                     color.at(0), color.at(1), color.at(2), color.at(3)});
+    }
+}
+
+void TextInsideGpu::TextInsideGpuImpl::draw(const std::string &str, const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y)
+{
+    if(str != this->str)
+    {
+        this->str = str;
+        layoutValid = false;
+    }
+
+    draw(horizontalAligment, verticalAligment, x, y);
+}
+
+void TextInsideGpu::TextInsideGpuImpl::drawQueued()
+{
+    if(queuedGlyphs.empty())
+    {
+        return;
+    }
+
+    // texts are placed in pixels of the current viewport, as by glText
+    GLint viewport[4]{};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glProgramUniform2f(vs, windowSizeLoc, viewport[2], viewport[3]);
+
+    glBindProgramPipeline(pipeline);
+    glBindVertexArray(vao);
+    glBindTextureUnit(0, _gltText2DFontTexture);
+
+    for(uint32_t firstGlyph=0; firstGlyph<queuedGlyphs.size(); firstGlyph+=maxNumberOfGlyphsPerDraw)
+    {
+        const auto numberOfGlyphs = std::min<uint32_t>(maxNumberOfGlyphsPerDraw, queuedGlyphs.size() - firstGlyph);
+
+        std::copy_n(queuedGlyphs.begin() + firstGlyph, numberOfGlyphs, glyphs->startWriting<Glyph>());
+        glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4, numberOfGlyphs, glyphs->getBaseInstance());
+        glyphs->finishDrawing();
+    }
 
-    gltDrawText2DAligned(textPtr.get(),
-                         (GLfloat)x,
-                         (GLfloat)y,
-                         1.0f,
-                         horizontalAligment, verticalAligment);
-    gltEndDraw();
-    glUseProgram(0);
+    queuedGlyphs.clear();
 }
 
-void TextInsideGpu::TextInsideGpuImpl::draw(const std::string &str, const uint16_t horizontalAligment, const uint16_t verticalAligment, const float x, const float y)
+// glyphs are placed by glText when the atlas is created by gltInit
+FontMetrics TextInsideGpu::TextInsideGpuImpl::getFontMetrics()
 {
-    gltSetText(textPtr.get(), str.c_str());
-    gltBeginDraw();
-    gltColor(color.at(0), color.at(1), color.at(2), color.at(3));
+    FontMetrics fontMetrics{_gltFontGlyphMinChar, static_cast<float>(_gltFontGlyphHeight), {}};
 
-    gltDrawText2DAligned(textPtr.get(),
-                         (GLfloat)x,
-                         (GLfloat)y,
-                         1.0f,
-                         horizontalAligment, verticalAligment);
+    for(char c = _gltFontGlyphMinChar; c <= _gltFontGlyphMaxChar; ++c)
+    {
+        const auto &glyph = _gltFontGlyphs2[c - _gltFontGlyphMinChar];
+        fontMetrics.glyphs.push_back(FontMetrics::Glyph{gltIsCharacterSupported(c) == GL_TRUE, glyph.drawable == GL_TRUE, static_cast<float>(glyph.w),
+                                                        glyph.u1, glyph.v1, glyph.u2, glyph.v2});
+    }
 
-    gltEndDraw();
-    glUseProgram(0);
+    return fontMetrics;
 }
 
 void TextInsideGpu::TextInsideGpuImpl::finalize()
 {
+    glDeleteVertexArrays(1, &vao);
+    glyphs.reset();
+    queuedGlyphs.clear();
+    removeShaders(pipeline, vs, fs);
+
     gltTerminate();
 }
 
+const char* TextInsideGpu::TextInsideGpuImpl::getVertexShader()
+{
+    const char *vertexShaderSrc = R"(
+#version 330 core
+
+layout(location = 0) in vec4 rect;
+layout(location = 1) in vec4 uv;
+layout(location = 2) in vec4 color;
+
+uniform vec2 windowSize;
+
+out vec2 fTexCoord;
+out vec4 fColor;
+
+void main()
+{
+    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+    vec2 pos = rect.xy + corner * rect.zw;
+
+    fTexCoord = mix(uv.xy, uv.zw, corner);
+    fColor = color;
+
+    gl_Position = vec4(2.0 * pos.x / windowSize.x - 1.0, 1.0 - 2.0 * pos.y / windowSize.y, 0.0, 1.0);
+}
+)";
+
+    return vertexShaderSrc;
+}
+
+const char* TextInsideGpu::TextInsideGpuImpl::getFragmentShader()
+{
+    const char *fragmentShaderSrc = R"(
+#version 330 core
+
+uniform sampler2D atlas;
+
+in vec2 fTexCoord;
+in vec4 fColor;
+out vec4 FragColor;
+
+void main()
+{
+    FragColor = texture(atlas, fTexCoord) * fColor;
+}
+)";
+
+    return fragmentShaderSrc;
+}
+
 TextInsideGpu::TextInsideGpu() : textInsideGpuImpl(std::make_unique<TextInsideGpuImpl>(std::string(""), std::vector<float>{1.0, 1.0,1.0,1.0}))
 {
 }
@@ -91,17 +266,22 @@ void TextInsideGpu::initialize()
 
 void TextInsideGpu::draw(const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment)
 {
-    textInsideGpuImpl->draw((uint16_t)horizontalAligment, (uint16_t)verticalAligment, x, y);
+    textInsideGpuImpl->draw(horizontalAligment, verticalAligment, x, y);
 }
 
 void TextInsideGpu::draw(const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y)
 {
-    textInsideGpuImpl->draw((uint16_t)horizontalAligment, (uint16_t)verticalAligment, x, y);
+    textInsideGpuImpl->draw(horizontalAligment, verticalAligment, x, y);
 }
 
 void TextInsideGpu::draw(const std::string &str, const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y)
 {
-    textInsideGpuImpl->draw(str,(uint16_t)horizontalAligment, (uint16_t)verticalAligment, x, y);
+    textInsideGpuImpl->draw(str, horizontalAligment, verticalAligment, x, y);
+}
+
+void TextInsideGpu::drawQueued()
+{
+    TextInsideGpuImpl::drawQueued();
 }
 
 void TextInsideGpu::finalize()
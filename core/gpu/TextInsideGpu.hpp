@@ -35,10 +35,13 @@ public:
     TextInsideGpu();
     ~TextInsideGpu();
 
+    // texts are queued and drawn together by drawQueued
     void draw(const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment);
     void draw(const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y);
     void draw(const std::string &str, const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment, const float x, const float y);
 
+    // draws glyphs of all texts queued since the previous call with one instanced draw
+    static void drawQueued();
     static void initialize();
     static void finalize();
 
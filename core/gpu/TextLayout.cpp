@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "TextLayout.hpp"
+#include <algorithm>
+
+TextLayout layOutText(const std::string &str, const FontMetrics &font)
+{
+    TextLayout layout;
+    float glyphX = 0;
+    float glyphY = 0;
+
+    layout.height = font.glyphHeight;
+
+    for(const auto c : str)
+    {
+        if(c == '\n')
+        {
+            glyphX = 0;
+            glyphY += font.glyphHeight;
+            layout.height += font.glyphHeight;
+            continue;
+        }
+        else if(c == '\r')
+        {
+            glyphX = 0;
+            continue;
+        }
+
+        const int index = c - font.firstCharacter;
+
+        if((index < 0) || (index >= static_cast<int>(font.glyphs.size())) || !font.glyphs.at(index).supported)
+        {
+            continue;
+        }
+
+        const auto &glyph = font.glyphs.at(index);
+
+        if(glyph.drawable)
+        {
+            layout.glyphs.push_back(TextLayout::Glyph{glyphX, glyphY, glyph.width, font.glyphHeight, glyph.u1, glyph.v1, glyph.u2, glyph.v2});
+        }
+
+        glyphX += glyph.width;
+        layout.width = std::max(layout.width, glyphX);
+    }
+
+    return layout;
+}
+
+std::pair<float, float> getAlignmentOffset(const TextLayout &layout, const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment)
+{
+    const float xOffset = (horizontalAligment == HorizontalAligment::CENTER) ? layout.width * 0.5f : (horizontalAligment == HorizontalAligment::RIGHT) ? layout.width : 0.0f;
+    const float yOffset = (verticalAligment == VerticalAligment::CENTER) ? layout.height * 0.5f : (verticalAligment == VerticalAligment::BOTTOM) ? layout.height : 0.0f;
+
+    return {-xOffset, -yOffset};
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#pragma once
+
+#include "TextInsideGpu.hpp"
+#include <string>
+#include <vector>
+#include <utility>
+
+// Metrics of the glyphs of a font, given for the characters from firstCharacter on.
+struct FontMetrics
+{
+    struct Glyph
+    {
+        bool supported;
+        bool drawable;
+        float width;
+        float u1, v1;
+        float u2, v2;
+    };
+
+    char firstCharacter;
+    float glyphHeight;
+    std::vector<Glyph> glyphs;
+};
+
+// Glyphs of a text in pixels from its top left corner, placed the same way as by glText.
+// Characters which are not supported are skipped and the ones which are not drawable,
+// e.g. spaces, only move the next glyph.
+struct TextLayout
+{
+    struct Glyph
+    {
+        float x, y;
+        float width, height;
+        float u1, v1;
+        float u2, v2;
+    };
+
+    std::vector<Glyph> glyphs;
+    float width{};
+    float height{};
+};
+
+TextLayout layOutText(const std::string &str, const FontMetrics &font);
+// offset of the top left corner of the text from the point it is drawn at, as in gltDrawText2DAligned
+std::pair<float, float> getAlignmentOffset(const TextLayout &layout, const HorizontalAligment horizontalAligment, const VerticalAligment verticalAligment);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/dataSource/ChildProcess.hpp"
+#include "core/dataSource/PythonDataSource.hpp"
+#include "core/dataSource/SharedMemory.hpp"
+#include "core/dataSource/SharedSamplesRing.hpp"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <chrono>
+
+// Started by the analyzer when PythonProcessIsolationEnabled is set. Runs the Python data
+// source and passes its blocks through the shared ring created by the analyzer. Exits when
+// the analyzer asks for it or is gone.
+int main(int argc, char *argv[])
+{
+    using namespace std::chrono;
+
+    if(argc != 4)
+    {
+        std::cout<<"Usage: spectrum-analyzer-python-worker <shared memory name> <module name> <parent process id>"<<std::endl;
+        return 1;
+    }
+
+    SharedMemory sharedMemory(argv[1]);
+    SharedSamplesRing ring(sharedMemory.getData(), sharedMemory.getSize());
+
+    if(!ring.isValid())
+    {
+        std::cout<<"ERROR: shared ring is not valid: "<<argv[1]<<std::endl;
+        return 1;
+    }
+
+    auto &header = ring.getHeader();
+    const uint64_t parentProcessId = std::stoull(argv[3]);
+    std::unique_ptr<PythonDataSource> pythonDataSource;
+
+    try
+    {
+        pythonDataSource = std::make_unique<PythonDataSource>(argv[2]);
+    }
+    catch(const std::exception &exception)
+    {
+        std::cout<<"ERROR: "<<exception.what()<<std::endl;
+    }
+
+    if(!pythonDataSource || !pythonDataSource->initialize(header.blockLength, header.samplingRate))
+    {
+        header.workerState.store(static_cast<uint32_t>(WorkerState::Failed));
+        return 1;
+    }
+
+    header.workerState.store(static_cast<uint32_t>(WorkerState::Running));
+
+    auto lastParentCheckTime = steady_clock::now();
+
+    while(!header.stopRequested.load())
+    {
+        header.heartbeat.fetch_add(1, std::memory_order_relaxed);
+
+        if(steady_clock::now() - lastParentCheckTime > milliseconds(100))
+        {
+            if(!ChildProcess::checkIfParentIsAlive(parentProcessId))
+            {
+                break;
+            }
+
+            lastParentCheckTime = steady_clock::now();
+        }
+
+        // the analyzer paces the script by consuming blocks
+        if(ring.getNumberOfFreeFrames() < header.blockLength)
+        {
+            std::this_thread::sleep_for(milliseconds(1));
+            continue;
+        }
+
+        const auto data = pythonDataSource->collectStereoDataFromHw();
+
+        if(pythonDataSource->checkIfErrorOccured())
+        {
+            header.workerState.store(static_cast<uint32_t>(WorkerState::Failed));
+            return 1;
+        }
+
+        const auto numberOfFrames = std::min(data.left.size(), data.right.size());
+
+        if(numberOfFrames == 0)
+        {
+            std::this_thread::sleep_for(milliseconds(1));
+            continue;
+        }
+
+        ring.write(data.left.data(), data.right.data(), numberOfFrames);
+    }
+
+    return 0;
+}
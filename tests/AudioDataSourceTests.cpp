@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/dataSource/AudioDataSource.hpp"
+#include "helpers/PortAudioMock.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace ::testing;
+
+
+class AudioDataSourceTests : public ::testing::Test
+{
+public:
+
+    AudioDataSourceTests()
+    {
+        deviceInfo.name = "testDevice";
+        deviceInfo.defaultLowInputLatency = 0.01;
+        deviceInfo.defaultSampleRate = samplingRate;
+        deviceInfo.maxInputChannels = 2;
+    }
+
+    void expectInitialization(bool callbackCaptureEnabled, PaSampleFormat supportedFormat = paInt16)
+    {
+        const Matcher<PaStreamCallback*> expectedCallback = callbackCaptureEnabled ? Matcher<PaStreamCallback*>(NotNull()) : Matcher<PaStreamCallback*>(IsNull());
+
+        EXPECT_CALL(portAudioMock, Pa_Initialize()).WillOnce(Return(paNoError));
+        EXPECT_CALL(portAudioMock, Pa_GetDefaultInputDevice()).WillOnce(Return(device));
+        EXPECT_CALL(portAudioMock, Pa_GetDeviceInfo(device)).WillRepeatedly(Return(&deviceInfo));
+        EXPECT_CALL(portAudioMock, Pa_IsFormatSupported(_, nullptr, samplingRate)).WillRepeatedly(Invoke([supportedFormat](const PaStreamParameters *inputParameters, const PaStreamParameters *, double){
+            return (inputParameters->sampleFormat == supportedFormat) ? paNoError : paSampleFormatNotSupported;
+        }));
+        EXPECT_CALL(portAudioMock, Pa_OpenStream(_, Field(&PaStreamParameters::sampleFormat, supportedFormat), nullptr, samplingRate, numberOfSamples, paClipOff, expectedCallback, _))
+            .WillOnce(DoAll(SetArgPointee<0>(stream), SaveArg<6>(&callback), SaveArg<7>(&userData), Return(paNoError)));
+        EXPECT_CALL(portAudioMock, Pa_StartStream(stream)).WillOnce(Return(paNoError));
+    }
+
+    void expectDestruction()
+    {
+        EXPECT_CALL(portAudioMock, Pa_StopStream(stream)).WillOnce(Return(paNoError));
+        EXPECT_CALL(portAudioMock, Pa_CloseStream(stream)).WillOnce(Return(paNoError));
+        EXPECT_CALL(portAudioMock, Pa_Terminate()).WillOnce(Return(paNoError));
+    }
+
+    std::vector<int16_t> getInterleavedSamples(int16_t offset)
+    {
+        std::vector<int16_t> samples(numberOfSamples * 2);
+
+        for(uint32_t i=0; i<numberOfSamples; ++i)
+        {
+            samples[2*i] = offset + i;
+            samples[2*i + 1] = -offset - i;
+        }
+        return samples;
+    }
+
+    void checkChannels(const StereoData &data, int16_t offset)
+    {
+        ASSERT_EQ(data.left.size(), numberOfSamples);
+        ASSERT_EQ(data.right.size(), numberOfSamples);
+
+        for(uint32_t i=0; i<numberOfSamples; ++i)
+        {
+            EXPECT_EQ(data.left[i], offset + i);
+            EXPECT_EQ(data.right[i], -offset - static_cast<int32_t>(i));
+        }
+    }
+
+    NiceMock<PortAudioMock> portAudioMock;
+    PaDeviceInfo deviceInfo{};
+    PaStream *stream = reinterpret_cast<PaStream*>(0x1234);
+    PaStreamCallback *callback{};
+    void *userData{};
+
+    static constexpr PaDeviceIndex device{3};
+    static constexpr uint32_t numberOfSamples{128};
+    static constexpr uint32_t samplingRate{48000};
+};
+
+TEST_F(AudioDataSourceTests, blockingCapture)
+{
+    const auto samples = getInterleavedSamples(100);
+
+    expectInitialization(false);
+    EXPECT_CALL(portAudioMock, Pa_GetStreamReadAvailable(stream)).WillOnce(Return(numberOfSamples));
+    EXPECT_CALL(portAudioMock, Pa_ReadStream(stream, _, numberOfSamples)).WillOnce(Invoke([&](PaStream*, void *buffer, unsigned long){
+        std::copy(samples.begin(), samples.end(), static_cast<int16_t*>(buffer));
+        return paInputOverflowed;
+    }));
+    expectDestruction();
+
+    AudioDataSource audioDataSource(false, false);
+    ASSERT_TRUE(audioDataSource.initialize(numberOfSamples, samplingRate));
+
+    checkChannels(audioDataSource.collectStereoDataFromHw(), 100);
+    EXPECT_EQ(audioDataSource.getNumberOfOverflows(), 1);
+}
+
+TEST_F(AudioDataSourceTests, callbackCapture)
+{
+    const auto firstBlock = getInterleavedSamples(100);
+    const auto secondBlock = getInterleavedSamples(1000);
+
+    expectInitialization(true);
+    EXPECT_CALL(portAudioMock, Pa_GetStreamReadAvailable(_)).Times(0);
+    EXPECT_CALL(portAudioMock, Pa_ReadStream(_, _, _)).Times(0);
+    expectDestruction();
+
+    AudioDataSource audioDataSource(false, true);
+    ASSERT_TRUE(audioDataSource.initialize(numberOfSamples, samplingRate));
+    ASSERT_NE(callback, nullptr);
+
+    PaStreamCallbackTimeInfo timeInfo{};
+    timeInfo.inputBufferAdcTime = 12.5;
+
+    EXPECT_EQ(callback(firstBlock.data(), nullptr, numberOfSamples, &timeInfo, 0, userData), paContinue);
+    checkChannels(audioDataSource.collectStereoDataFromHw(), 100);
+    EXPECT_DOUBLE_EQ(audioDataSource.getInputBufferAdcTime(), 12.5);
+
+    std::thread producer([&](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        timeInfo.inputBufferAdcTime = 13.5;
+        callback(secondBlock.data(), nullptr, numberOfSamples, &timeInfo, paInputOverflow, userData);
+    });
+
+    checkChannels(audioDataSource.collectStereoDataFromHw(), 1000);
+    producer.join();
+
+    EXPECT_DOUBLE_EQ(audioDataSource.getInputBufferAdcTime(), 13.5);
+    EXPECT_EQ(audioDataSource.getNumberOfOverflows(), 1);
+}
+
+TEST_F(AudioDataSourceTests, callbackCaptureTimeIsTranslatedToSteadyClock)
+{
+    const auto firstBlock = getInterleavedSamples(100);
+    const auto secondBlock = getInterleavedSamples(1000);
+    const PaTime blockDuration = static_cast<PaTime>(numberOfSamples) / samplingRate;
+
+    expectInitialization(true);
+    expectDestruction();
+
+    AudioDataSource audioDataSource(false, true);
+    ASSERT_TRUE(audioDataSource.initialize(numberOfSamples, samplingRate));
+
+    // the newest sample reached the ADC 100 ms before the callback
+    PaStreamCallbackTimeInfo timeInfo{};
+    timeInfo.inputBufferAdcTime = 10;
+    timeInfo.currentTime = timeInfo.inputBufferAdcTime + blockDuration + 0.1;
+
+    const auto timeOfCallbacks = std::chrono::steady_clock::now();
+    callback(firstBlock.data(), nullptr, numberOfSamples, &timeInfo, 0, userData);
+    timeInfo.inputBufferAdcTime += blockDuration;
+    timeInfo.currentTime += blockDuration;
+    callback(secondBlock.data(), nullptr, numberOfSamples, &timeInfo, 0, userData);
+
+    const auto firstData = audioDataSource.collectStereoDataFromHw();
+    const auto secondData = audioDataSource.collectStereoDataFromHw();
+
+    checkChannels(firstData, 100);
+    checkChannels(secondData, 1000);
+    // the first block waited in the ring while the second one was captured
+    EXPECT_NEAR(std::chrono::duration<double>(timeOfCallbacks - firstData.captureTime).count(), 0.1 + blockDuration, 0.01);
+    EXPECT_NEAR(std::chrono::duration<double>(timeOfCallbacks - secondData.captureTime).count(), 0.1, 0.01);
+}
+
+TEST_F(AudioDataSourceTests, callbackCaptureWithoutData)
+{
+    expectInitialization(true);
+    expectDestruction();
+
+    AudioDataSource audioDataSource(false, true);
+    ASSERT_TRUE(audioDataSource.initialize(numberOfSamples, samplingRate));
+
+    const auto data = audioDataSource.collectStereoDataFromHw();
+
+    EXPECT_TRUE(data.left.empty());
+    EXPECT_TRUE(data.right.empty());
+}
+
+TEST_F(AudioDataSourceTests, float32IsPreferredAndScaledToFullScale)
+{
+    std::vector<float> block(numberOfSamples * 2);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        block[2*i] = 1.0f;
+        block[2*i + 1] = -0.5f;
+    }
+
+    expectInitialization(true, paFloat32);
+    expectDestruction();
+
+    AudioDataSource audioDataSource(false, true);
+    ASSERT_TRUE(audioDataSource.initialize(numberOfSamples, samplingRate));
+
+    callback(block.data(), nullptr, numberOfSamples, nullptr, 0, userData);
+
+    const auto data = audioDataSource.collectStereoDataFromHw();
+
+    ASSERT_EQ(data.left.size(), numberOfSamples);
+    ASSERT_EQ(data.right.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_FLOAT_EQ(data.left[i], 32767.0f);
+        EXPECT_FLOAT_EQ(data.right[i], -16383.5f);
+    }
+}
+
+TEST_F(AudioDataSourceTests, int24PackedSamples)
+{
+    const int32_t leftSample = 0x400000;
+    const int32_t rightSample = -0x200000;
+
+    std::vector<uint8_t> block;
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        for(const auto sample : {leftSample, rightSample})
+        {
+            block.push_back(sample & 0xff);
+            block.push_back((sample >> 8) & 0xff);
+            block.push_back((sample >> 16) & 0xff);
+        }
+    }
+
+    expectInitialization(false, paInt24);
+    EXPECT_CALL(portAudioMock, Pa_GetStreamReadAvailable(stream)).WillOnce(Return(numberOfSamples));
+    EXPECT_CALL(portAudioMock, Pa_ReadStream(stream, _, numberOfSamples)).WillOnce(Invoke([&](PaStream*, void *buffer, unsigned long){
+        std::copy(block.begin(), block.end(), static_cast<uint8_t*>(buffer));
+        return paNoError;
+    }));
+    expectDestruction();
+
+    AudioDataSource audioDataSource(false, false);
+    ASSERT_TRUE(audioDataSource.initialize(numberOfSamples, samplingRate));
+
+    const auto data = audioDataSource.collectStereoDataFromHw();
+
+    ASSERT_EQ(data.left.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_NEAR(data.left[i], 32767.0f / 2, 1e-2);
+        EXPECT_NEAR(data.right[i], -32767.0f / 4, 1e-2);
+    }
+}
@@ -11,6 +11,7 @@
 #include "helpers/WindowTestsBase.hpp"
 #include "helpers/ValuesChecker.hpp"
 #include <memory>
+#include <cmath>
 #include <gtest/gtest.h>
 
 
@@ -27,7 +28,7 @@ public:
 
         void init() override
         {
-            StatsManager::clear();
+            Metrics::clear();
             threads.push_back(std::thread(&ModifiedAudioSpectrumAnalyzer::samplesUpdater,this));
             threads.push_back(std::thread(&AudioSpectrumAnalyzer::fftCalculator,this));
             threads.push_back(std::thread(&AudioSpectrumAnalyzer::processing,this));
@@ -37,11 +38,11 @@ public:
 
         void samplesUpdater() override
         {
-            StatsManager statsManager("samplesUpdater");
+            const auto stageMetrics = Metrics::registerStage("samplesUpdater");
 
             for(auto signalNo=0; signalNo < numberOfSignalsToBeTransferred; ++signalNo)
             {
-                statsManager.update();
+                stageMetrics->update();
                 const auto leftData = generateSignal(config.data.get<NumberOfSamples>().value,config.data.get<SamplingRate>().value,1000, dbFsToAmplitude(-signalNo));
                 const auto rightData = generateSignal(config.data.get<NumberOfSamples>().value,config.data.get<SamplingRate>().value,2000, dbFsToAmplitude(-signalNo));
                 dataExchanger.push_back(std::make_unique<std::any>(StereoData{std::move(leftData), std::move(rightData)}));
@@ -57,24 +58,31 @@ public:
 
         void drafter() override
         {
-            StatsManager statsManager("drafter");
-
-            auto dbFs=0;
+            const auto stageMetrics = Metrics::registerStage("drafter");
 
             while(shouldProceed)
             {
-                const auto &data = processedDataExchanger.get();
+                const auto timestampedData = processedDataMailbox.getNewValue();
 
-                if(data == nullptr)
+                if(timestampedData == nullptr)
                 {
+                    processedDataMailbox.waitForNewValue(100ms);
                     continue;
                 }
 
-                statsManager.update();
+                stageMetrics->update();
+
+                // spectra which were overwritten before being drawn are skipped, the n-th one was made from signal n-1
+                const auto sequenceNumber = processedDataMailbox.getSequenceNumberOfLastValue();
+                valueChecker(timestampedData->value, prepareExpectedFreqDomainSignal(-static_cast<float>(sequenceNumber - 1)));
 
-                valueChecker(std::any_cast<Data>(*data), prepareExpectedFreqDomainSignal(dbFs--));
+                if(sequenceNumber == numberOfSignalsToBeTransferred)
+                {
+                    shouldProceed.store(false);
+                }
             }
-            EXPECT_EQ(dbFs, -numberOfSignalsToBeTransferred);
+
+            EXPECT_EQ(processedDataMailbox.getSequenceNumberOfLastValue(), numberOfSignalsToBeTransferred);
         }
 
         void flowController() override
@@ -82,12 +90,6 @@ public:
             while(shouldProceed)
             {
                std::this_thread::sleep_for(100ms);
-
-               if(StatsManager::getStatsFor("drafter").getNumberOfCallsInLast(3000ms) < numberOfSignalsToBeTransferred)
-               {
-                  continue;
-               }
-               shouldProceed.store(false);
             }
         }
     };
@@ -111,6 +113,12 @@ public:
         config.data.add(ScalingFactor{1});
         config.data.add(OffsetFactor{0});
         config.data.add(Freqs(getDemandedFrequencies(sampleRate, numberOfSamples, 0, numberOfSamples/2)));
+        config.data.add(ThreadSchedulingSettings{ThreadSettingsPerStage{}});
+        config.data.add(TraceOutputPath{""});
+        config.data.add(FrameTimingSettings{FrameTiming{0, false}});
+        config.data.add(FlowControllerSettings{FlowControl{4, 20, 10, 0.002, 1}});
+        config.data.add(SpectrumInterpolationEnabled{false});
+        config.data.add(QualityGovernorSettings{QualityControl{false, 85, 40, 4, 5}});
         return config;
     }
 
@@ -136,7 +144,11 @@ private:
 
         for(const auto &position: expectedFftValuesPositions)
         {
-            std::copy(fftValuesWithFullScale.begin(), fftValuesWithFullScale.end(), fftSignal.begin() + position);
+            // mirrored bins lie above the last displayed frequency
+            if(position + fftValuesWithFullScale.size() <= fftSignal.size())
+            {
+                std::copy(fftValuesWithFullScale.begin(), fftValuesWithFullScale.end(), fftSignal.begin() + position);
+            }
         }
 
         return fftSignal;
@@ -164,12 +176,11 @@ public:
 
         ModifiedAudioSpectrumAnalyzer(const Configuration &configuration): AudioSpectrumAnalyzer(configuration)
         {
-            audioConfigFile="testAudioConfig";
         }
 
         void init() override
         {
-            StatsManager::clear();
+            Metrics::clear();
             threads.push_back(std::thread(&AudioSpectrumAnalyzer::samplesUpdater,this));
             threads.push_back(std::thread(&AudioSpectrumAnalyzer::fftCalculator,this));
             threads.push_back(std::thread(&AudioSpectrumAnalyzer::processing,this));
@@ -179,11 +190,13 @@ public:
 
         void flowController() override
         {
+            const auto drafterMetrics = Metrics::registerStage("drafter");
+
             while(shouldProceed)
             {
                std::this_thread::sleep_for(50ms);
 
-               if(StatsManager::getStatsFor("drafter").getNumberOfCallsInLast(3000ms) < numberOfSignalsToBeTransferred)
+               if(drafterMetrics->getNumberOfCalls() < numberOfSignalsToBeTransferred)
                {
                   continue;
                }
@@ -205,7 +218,7 @@ public:
         config.data.add(VerticalLinePositions{Frequencies{}});
         config.data.add(FrequencyTextPositions{Frequencies{}});
         config.data.add(NumberOfRectangles{(uint16_t)frequencies.size()});
-        config.data.add(PythonDataSourceEnabled{true});
+        config.data.add(PythonDataSourceEnabled{false});
         config.data.add(NumberOfSamples{numberOfSamples});
         config.data.add(SamplingRate{8000});
         config.data.add(DesiredFrameRate{1});
@@ -240,9 +253,28 @@ public:
         config.data.add(LinesVisibilityState{false});
         config.data.add(DynamicMaxHoldSecondaryVisibilityState{true});
         config.data.add(LoopbackEnabled{false});
+        config.data.add(CallbackCaptureEnabled{false});
         config.data.add(HorizontalDrawingArea{{5,90}});
         config.data.add(VerticalDbfsRange{{-96.32, 0}});
         config.data.add(SingleScaleMode{false});
+        config.data.add(ThreadSchedulingSettings{ThreadSettingsPerStage{}});
+        config.data.add(MemoryLockingEnabled{false});
+        config.data.add(NumberOfSamplesCollectedFromHw{128});
+        config.data.add(FileDataSourcePath{""});
+        config.data.add(FilePlaybackSettings{FilePlayback{true, true, SampleFormat::Int16, 2}});
+        config.data.add(StreamDataSourceAddress{""});
+        config.data.add(StreamDataSourceFormat{PcmFormat{SampleFormat::Int16, 2}});
+        config.data.add(SignalGeneratorLeftChannel{GeneratorSignal{SignalType::Sine, 0, 1000, 0, 0, 1}});
+        config.data.add(SignalGeneratorRightChannel{GeneratorSignal{SignalType::Sine, 20 * std::log10(16384.0f / 32767), 1000, 0, 0, 2}});
+        config.data.add(FrameLogRecordPath{""});
+        config.data.add(FrameLogReplayPath{""});
+        config.data.add(FrameLogSettings{FrameLog{FrameLogEncoding::Lossless, true}});
+        config.data.add(PythonProcessIsolationEnabled{false});
+        config.data.add(TraceOutputPath{""});
+        config.data.add(FrameTimingSettings{FrameTiming{0, false}});
+        config.data.add(FlowControllerSettings{FlowControl{4, 20, 10, 0.002, 1}});
+        config.data.add(SpectrumInterpolationEnabled{false});
+        config.data.add(QualityGovernorSettings{QualityControl{false, 85, 40, 4, 5}});
 
         return config;
     }
@@ -251,7 +283,7 @@ public:
     {
         expectCreateWindow();
         expectInitializeGPU(config.get<NumberOfRectangles>(), true);
-        expectDraw({-0.632012, -0.301901,  -0.208429,-0.301901, -0.632012}, true);
+        expectDraw({-30.438, -14.54, -10.038, -14.54, -30.438}, true);
         expectCheckIfWindowShouldBeClosed();
         expectCheckIfWindowShouldRecreated();
         expectCheckIfThemeShouldBeChanged();
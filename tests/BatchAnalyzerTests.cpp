@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/BatchAnalyzer.hpp"
+#include "core/Helpers.hpp"
+#include "helpers/TestHelpers.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <cmath>
+
+class BatchAnalyzerTests : public ::testing::Test
+{
+public:
+
+    BatchAnalyzerTests()
+    {
+        writeWaveFile();
+    }
+
+    ~BatchAnalyzerTests()
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove_all(outputDirectory);
+    }
+
+    Configuration getConfig()
+    {
+        Configuration config{};
+
+        config.data.add(Freqs{Frequencies{500, 1000, 2000}});
+        config.data.add(NumberOfSamples{numberOfSamples});
+        config.data.add(SamplingRate{samplingRate});
+        config.data.add(DesiredFrameRate{100});
+        config.data.add(NumberOfSignalsForAveraging{4});
+        config.data.add(NumberOfSignalsForMaxHold{3});
+        config.data.add(AlphaFactor{0.3});
+        config.data.add(SignalWindow{getSignalWindow(numberOfSamples)});
+        config.data.add(ScalingFactor{1});
+        config.data.add(OffsetFactor{0});
+        config.data.add(FilePlaybackSettings{FilePlayback{false, false, SampleFormat::Int16, 2}});
+
+        return config;
+    }
+
+    void writeWaveFile()
+    {
+        const uint32_t dataSize = numberOfFrames * 2 * sizeof(int16_t);
+        const uint32_t riffSize = 36 + dataSize;
+        const uint32_t formatSize{16};
+        const uint16_t formatTagAndChannels[] = {1, 2};
+        const uint32_t samplingRateAndByteRate[] = {samplingRate, samplingRate * 4};
+        const uint16_t blockAlignAndBitsPerSample[] = {4, 16};
+
+        std::ofstream file(path, std::ios::binary);
+        file.write("RIFF", 4);
+        file.write(reinterpret_cast<const char*>(&riffSize), 4);
+        file.write("WAVEfmt ", 8);
+        file.write(reinterpret_cast<const char*>(&formatSize), 4);
+        file.write(reinterpret_cast<const char*>(formatTagAndChannels), sizeof(formatTagAndChannels));
+        file.write(reinterpret_cast<const char*>(samplingRateAndByteRate), sizeof(samplingRateAndByteRate));
+        file.write(reinterpret_cast<const char*>(blockAlignAndBitsPerSample), sizeof(blockAlignAndBitsPerSample));
+        file.write("data", 4);
+        file.write(reinterpret_cast<const char*>(&dataSize), 4);
+
+        // the level changes over time, so every chunk boundary sees a different history
+        for(uint32_t i=0; i<numberOfFrames; ++i)
+        {
+            const float amplitude = 16000 * (0.5 + 0.5 * std::sin(2 * M_PI * i / (samplingRate * 0.37)));
+            const int16_t sample = amplitude * std::sin(2 * M_PI * 1000 * i / samplingRate);
+            file.write(reinterpret_cast<const char*>(&sample), sizeof(sample));
+            file.write(reinterpret_cast<const char*>(&sample), sizeof(sample));
+        }
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "batchAnalyzerTest.wav").string();
+    const std::string outputDirectory = (std::filesystem::temp_directory_path() / "batchAnalyzerTestOutput").string();
+    const uint32_t samplingRate{8000};
+    const uint32_t numberOfSamples{256};
+    const uint32_t numberOfFrames{samplingRate * 4};
+};
+
+TEST_F(BatchAnalyzerTests, chunkedParallelAnalysisMatchesSinglePass)
+{
+    const auto config = getConfig();
+
+    BatchAnalyzer singlePassAnalyzer(config, 1, 1000000);
+    BatchAnalyzer chunkedAnalyzer(config, 4, 50);
+
+    const auto expected = singlePassAnalyzer.analyze(path);
+    const auto result = chunkedAnalyzer.analyze(path);
+
+    const uint32_t hopSize = calculateHopSize(numberOfSamples, calculateOverlapping(samplingRate, numberOfSamples, 100));
+    const uint32_t numberOfWelchFrames = (numberOfFrames - numberOfSamples) / hopSize + 1;
+    const uint32_t numberOfWarmUpFrames = (3 - 1) + (4 - 1);
+
+    ASSERT_EQ(expected.size(), numberOfWelchFrames - numberOfWarmUpFrames);
+    ASSERT_EQ(result.size(), expected.size());
+
+    for(size_t i=0; i<result.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(result[i].time, expected[i].time);
+        ASSERT_EQ(result[i].bars.size(), expected[i].bars.size());
+
+        for(size_t bar=0; bar<result[i].bars.size(); ++bar)
+        {
+            EXPECT_NEAR(result[i].bars[bar], expected[i].bars[bar], 0.01);
+        }
+    }
+
+    EXPECT_DOUBLE_EQ(expected.front().time, static_cast<double>(numberOfWarmUpFrames) * hopSize / samplingRate);
+    EXPECT_GT(expected.front().bars.at(1), expected.front().bars.at(0));
+    EXPECT_GT(expected.front().bars.at(1), expected.front().bars.at(2));
+}
+
+TEST_F(BatchAnalyzerTests, outputFilesAreWrittenForEachInput)
+{
+    BatchAnalyzer batchAnalyzer(getConfig(), 2);
+
+    EXPECT_TRUE(batchAnalyzer.run({path}, outputDirectory, BatchOutputFormat::Csv));
+    EXPECT_TRUE(batchAnalyzer.run({path}, outputDirectory, BatchOutputFormat::Binary));
+    EXPECT_FALSE(batchAnalyzer.run({path + ".missing"}, outputDirectory, BatchOutputFormat::Csv));
+
+    const auto numberOfSpectra = batchAnalyzer.analyze(path).size();
+    const auto outputPath = std::filesystem::path(outputDirectory) / "batchAnalyzerTest";
+
+    std::ifstream csvFile(outputPath.string() + ".csv");
+    std::string line;
+    std::getline(csvFile, line);
+    EXPECT_EQ(line, "time,500,1000,2000");
+
+    size_t numberOfLines{0};
+    while(std::getline(csvFile, line))
+    {
+        ++numberOfLines;
+    }
+    EXPECT_EQ(numberOfLines, numberOfSpectra);
+
+    const size_t headerSize = 4 + 2 * sizeof(uint32_t) + 3 * sizeof(float);
+    const size_t spectrumSize = sizeof(double) + 3 * sizeof(float);
+    EXPECT_EQ(std::filesystem::file_size(outputPath.string() + ".spab"), headerSize + numberOfSpectra * spectrumSize);
+}
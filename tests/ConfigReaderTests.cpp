@@ -36,6 +36,14 @@ public:
         {3,{0.2, 0.2, 0.2,0.25}}
     };
 
+    const ThreadSettingsPerStage threadSchedulingSettings{
+        {0,{1, 70}},
+        {1,{1, 60}},
+        {2,{0, 0}},
+        {3,{0, 0}},
+        {4,{0, 0}}
+    };
+
     void checkDefaultConfig(const Configuration &config)
     {
         EXPECT_EQ(config.get<PythonDataSourceEnabled>(), false);
@@ -45,6 +53,7 @@ public:
         EXPECT_EQ(config.get<NormalWindowSize>().first, 1280);
         EXPECT_EQ(config.get<NormalWindowSize>().second, 512);
         EXPECT_EQ(config.get<NumberOfSamples>(), 8192);
+        EXPECT_EQ(config.get<NumberOfSamplesCollectedFromHw>(), 0);
         EXPECT_EQ(config.get<SamplingRate>(), 48000);
         EXPECT_EQ(config.get<DesiredFrameRate>(), 55);
         EXPECT_EQ(config.get<GapWidthInRelationToRectangleWidth>(), 0);
@@ -82,6 +91,39 @@ public:
         EXPECT_NEAR(config.get<VerticalDbfsRange>().first,-96.32, precision);
         EXPECT_NEAR(config.get<VerticalDbfsRange>().second, 0, precision);
         EXPECT_EQ(config.get<SingleScaleMode>(),  false);
+        positionValuesChecker(threadSchedulingSettings, config.get<ThreadSchedulingSettings>());
+        EXPECT_EQ(config.get<MemoryLockingEnabled>(),  false);
+        EXPECT_EQ(config.get<CallbackCaptureEnabled>(),  true);
+        EXPECT_EQ(config.get<FileDataSourcePath>(), "");
+        EXPECT_TRUE(config.get<FilePlaybackSettings>().realtimePacing);
+        EXPECT_TRUE(config.get<FilePlaybackSettings>().looping);
+        EXPECT_EQ(config.get<FilePlaybackSettings>().rawSampleFormat, SampleFormat::Int16);
+        EXPECT_EQ(config.get<FilePlaybackSettings>().rawNumberOfChannels, 2);
+        EXPECT_EQ(config.get<StreamDataSourceAddress>(), "");
+        EXPECT_EQ(config.get<StreamDataSourceFormat>().sampleFormat, SampleFormat::Int16);
+        EXPECT_EQ(config.get<StreamDataSourceFormat>().numberOfChannels, 2);
+        EXPECT_EQ(config.get<SignalGeneratorLeftChannel>().type, SignalType::Off);
+        EXPECT_EQ(config.get<SignalGeneratorRightChannel>().type, SignalType::Off);
+        EXPECT_EQ(config.get<SignalGeneratorRightChannel>().seed, 2);
+        EXPECT_EQ(config.get<FrameLogRecordPath>(), "");
+        EXPECT_EQ(config.get<FrameLogReplayPath>(), "");
+        EXPECT_EQ(config.get<FrameLogSettings>().encoding, FrameLogEncoding::Lossless);
+        EXPECT_TRUE(config.get<FrameLogSettings>().originalTiming);
+        EXPECT_FALSE(config.get<PythonProcessIsolationEnabled>());
+        EXPECT_EQ(config.get<TraceOutputPath>(), "");
+        EXPECT_EQ(config.get<FrameTimingSettings>().budgetInMilliseconds, 0);
+        EXPECT_FALSE(config.get<FrameTimingSettings>().gpuTimerQueriesEnabled);
+        EXPECT_EQ(config.get<FlowControllerSettings>().proportionalGain, 4);
+        EXPECT_EQ(config.get<FlowControllerSettings>().integralGain, 20);
+        EXPECT_EQ(config.get<FlowControllerSettings>().integralLimit, 10);
+        EXPECT_FLOAT_EQ(config.get<FlowControllerSettings>().hysteresis, 0.002);
+        EXPECT_EQ(config.get<FlowControllerSettings>().targetQueueDepth, 1);
+        EXPECT_FALSE(config.get<SpectrumInterpolationEnabled>());
+        EXPECT_TRUE(config.get<QualityGovernorSettings>().enabled);
+        EXPECT_EQ(config.get<QualityGovernorSettings>().cpuBudgetInPercents, 85);
+        EXPECT_EQ(config.get<QualityGovernorSettings>().restoreThresholdInPercents, 40);
+        EXPECT_EQ(config.get<QualityGovernorSettings>().maxQueueDepth, 4);
+        EXPECT_EQ(config.get<QualityGovernorSettings>().restoreDelayInSeconds, 5);
     }
 };
 
@@ -109,6 +151,7 @@ TEST_F(ConfigReaderTests, configReaderTest)
     MaximizedWindowSize maximizedWindowSize{{123,456}};
     NormalWindowSize normalWindowSize{{456,123}};
     NumberOfSamples numberOfSamples{3};
+    NumberOfSamplesCollectedFromHw numberOfSamplesCollectedFromHw{512};
     SamplingRate samplingRate{16000};
     DesiredFrameRate desiredFrameRate{120};
     GapWidthInRelationToRectangleWidth gapWidthInRelationToRectangleWidth{0};
@@ -138,6 +181,22 @@ TEST_F(ConfigReaderTests, configReaderTest)
     FrequencyTextPositions frequencyTextPositions{{5005, 4004,3003,2002,1001}};
     WindowTitle windowTitle("some new string");
     LoopbackEnabled loopbackEnabled(false);
+    MemoryLockingEnabled memoryLockingEnabled(true);
+    CallbackCaptureEnabled callbackCaptureEnabled(false);
+    FileDataSourcePath fileDataSourcePath("recordings/field.wav");
+    FilePlaybackSettings filePlaybackSettings{FilePlayback{false, false, SampleFormat::Float32, 6}};
+    StreamDataSourceAddress streamDataSourceAddress("unix:/tmp/spectrum.sock");
+    StreamDataSourceFormat streamDataSourceFormat{PcmFormat{SampleFormat::Int24, 1}};
+    SignalGeneratorLeftChannel signalGeneratorLeftChannel{GeneratorSignal{SignalType::Sweep, -12, 20, 20000, 5, 7}};
+    FrameLogRecordPath frameLogRecordPath("logs/session.safl");
+    FrameLogSettings frameLogSettings{FrameLog{FrameLogEncoding::Int16, false}};
+    PythonProcessIsolationEnabled pythonProcessIsolationEnabled{true};
+    TraceOutputPath traceOutputPath("traces/pipeline.json");
+    FrameTimingSettings frameTimingSettings{FrameTiming{12.5, true}};
+    FlowControllerSettings flowControllerSettings{FlowControl{2, 30, 20, 0.01, 2}};
+    SpectrumInterpolationEnabled spectrumInterpolationEnabled{true};
+    QualityGovernorSettings qualityGovernorSettings{QualityControl{false, 70, 30, 8, 2.5}};
+    ThreadSchedulingSettings threadSchedulingSettings{{{{0},{2,10,0,1}},{{1},{1,20,2}}}};
 
     configFileReader.writeBoolToFile("PythonDataSourceEnabled", comment, pythonDataSourceEnabled.value);
     configFileReader.writeBoolToFile("DefaultFullscreenState", comment, defaultFullscreenState.value);
@@ -147,12 +206,16 @@ TEST_F(ConfigReaderTests, configReaderTest)
     configFileReader.writeBoolToFile("RectanglesVisibilityState", comment, rectanglesVisibilityState.value);
     configFileReader.writeBoolToFile("LoopbackEnabled", comment, loopbackEnabled.value);
     configFileReader.writeBoolToFile("SingleScaleMode", comment, singleScaleMode.value);
+    configFileReader.writeBoolToFile("MemoryLockingEnabled", comment, memoryLockingEnabled.value);
+    configFileReader.writeBoolToFile("CallbackCaptureEnabled", comment, callbackCaptureEnabled.value);
     configFileReader.writeStringToFile("AdvancedColorSettings", comment, advancedColorSettings.value);
     configFileReader.writeStringToFile("BackgroundColorSettings", comment, backgroundColorSettings.value);
     configFileReader.writeStringToFile("WindowTitle", comment, windowTitle.value);
+    configFileReader.writeStringToFile("FileDataSourcePath", comment, fileDataSourcePath.value);
     configFileReader.writeVectorToCsv("MaximizedWindowSize", comment, std::vector<float>{(float)maximizedWindowSize.value.first, (float)maximizedWindowSize.value.second});
     configFileReader.writeVectorToCsv("NormalWindowSize", comment, std::vector<float>{(float)normalWindowSize.value.first, (float)normalWindowSize.value.second});
     configFileReader.writeVectorToCsv("NumberOfSamples", comment, {(float)numberOfSamples.value});
+    configFileReader.writeVectorToCsv("NumberOfSamplesCollectedFromHw", comment, {(float)numberOfSamplesCollectedFromHw.value});
     configFileReader.writeVectorToCsv("SamplingRate", comment, {(float)samplingRate.value});
     configFileReader.writeVectorToCsv("DesiredFrameRate", comment, {(float)desiredFrameRate.value});
     configFileReader.writeVectorToCsv("GapWidthInRelationToRectangleWidth", comment, {gapWidthInRelationToRectangleWidth.value});
@@ -175,9 +238,22 @@ TEST_F(ConfigReaderTests, configReaderTest)
     configFileReader.writeVectorToCsv("HorizontalDrawingArea", comment, {horizontalDrawingArea.value.first, horizontalDrawingArea.value.second});
     configFileReader.writeVectorToCsv("VerticalLinePositions", comment, verticalLinePositions.value);
     configFileReader.writeVectorToCsv("FrequencyTextPositions", comment, frequencyTextPositions.value);
+    configFileReader.writeVectorToCsv("FilePlaybackSettings", comment, {0, 0, 3, 6});
+    configFileReader.writeStringToFile("StreamDataSourceAddress", comment, streamDataSourceAddress.value);
+    configFileReader.writeVectorToCsv("StreamDataSourceFormat", comment, {1, 1});
+    configFileReader.writeVectorToCsv("SignalGeneratorLeftChannel", comment, {3, -12, 20, 20000, 5, 7});
+    configFileReader.writeStringToFile("FrameLogRecordPath", comment, frameLogRecordPath.value);
+    configFileReader.writeVectorToCsv("FrameLogSettings", comment, {1, 0});
+    configFileReader.writeBoolToFile("PythonProcessIsolationEnabled", comment, pythonProcessIsolationEnabled.value);
+    configFileReader.writeStringToFile("TraceOutputPath", comment, traceOutputPath.value);
+    configFileReader.writeVectorToCsv("FrameTimingSettings", comment, {12.5, 1});
+    configFileReader.writeVectorToCsv("FlowControllerSettings", comment, {2, 30, 20, 0.01, 2});
+    configFileReader.writeBoolToFile("SpectrumInterpolationEnabled", comment, spectrumInterpolationEnabled.value);
+    configFileReader.writeVectorToCsv("QualityGovernorSettings", comment, {0, 70, 30, 8, 2.5});
     configFileReader.writeMapToCsv("ColorsOfRectangle", comment, colorsOfRectangle.value);
     configFileReader.writeMapToCsv("ColorsOfDynamicMaxHoldRectangle", comment, colorsOfDynamicMaxHoldRectangle.value);
     configFileReader.writeMapToCsv("ColorsOfDynamicMaxHoldSecondaryRectangle", comment, colorsOfDynamicMaxHoldSecondaryRectangle.value);
+    configFileReader.writeMapToCsv("ThreadSchedulingSettings", comment, threadSchedulingSettings.value);
 
     ConfigReader configReader(theme, mode, "modifiedConfigTest");
     const auto &config = configReader.getConfig();
@@ -190,6 +266,40 @@ TEST_F(ConfigReaderTests, configReaderTest)
     EXPECT_EQ(config.get<RectanglesVisibilityState>(), rectanglesVisibilityState.value);
     EXPECT_EQ(config.get<LoopbackEnabled>(), loopbackEnabled.value);
     EXPECT_EQ(config.get<SingleScaleMode>(), singleScaleMode.value);
+    EXPECT_EQ(config.get<MemoryLockingEnabled>(), memoryLockingEnabled.value);
+    EXPECT_EQ(config.get<CallbackCaptureEnabled>(), callbackCaptureEnabled.value);
+    EXPECT_EQ(config.get<FileDataSourcePath>(), fileDataSourcePath.value);
+    EXPECT_EQ(config.get<FilePlaybackSettings>().realtimePacing, filePlaybackSettings.value.realtimePacing);
+    EXPECT_EQ(config.get<FilePlaybackSettings>().looping, filePlaybackSettings.value.looping);
+    EXPECT_EQ(config.get<FilePlaybackSettings>().rawSampleFormat, filePlaybackSettings.value.rawSampleFormat);
+    EXPECT_EQ(config.get<FilePlaybackSettings>().rawNumberOfChannels, filePlaybackSettings.value.rawNumberOfChannels);
+    EXPECT_EQ(config.get<StreamDataSourceAddress>(), streamDataSourceAddress.value);
+    EXPECT_EQ(config.get<StreamDataSourceFormat>().sampleFormat, streamDataSourceFormat.value.sampleFormat);
+    EXPECT_EQ(config.get<StreamDataSourceFormat>().numberOfChannels, streamDataSourceFormat.value.numberOfChannels);
+    EXPECT_EQ(config.get<SignalGeneratorLeftChannel>().type, signalGeneratorLeftChannel.value.type);
+    EXPECT_EQ(config.get<SignalGeneratorLeftChannel>().amplitudeDbfs, signalGeneratorLeftChannel.value.amplitudeDbfs);
+    EXPECT_EQ(config.get<SignalGeneratorLeftChannel>().frequency, signalGeneratorLeftChannel.value.frequency);
+    EXPECT_EQ(config.get<SignalGeneratorLeftChannel>().secondFrequency, signalGeneratorLeftChannel.value.secondFrequency);
+    EXPECT_EQ(config.get<SignalGeneratorLeftChannel>().period, signalGeneratorLeftChannel.value.period);
+    EXPECT_EQ(config.get<SignalGeneratorLeftChannel>().seed, signalGeneratorLeftChannel.value.seed);
+    EXPECT_EQ(config.get<FrameLogRecordPath>(), frameLogRecordPath.value);
+    EXPECT_EQ(config.get<FrameLogSettings>().encoding, frameLogSettings.value.encoding);
+    EXPECT_EQ(config.get<FrameLogSettings>().originalTiming, frameLogSettings.value.originalTiming);
+    EXPECT_EQ(config.get<PythonProcessIsolationEnabled>(), pythonProcessIsolationEnabled.value);
+    EXPECT_EQ(config.get<TraceOutputPath>(), traceOutputPath.value);
+    EXPECT_EQ(config.get<FrameTimingSettings>().budgetInMilliseconds, frameTimingSettings.value.budgetInMilliseconds);
+    EXPECT_EQ(config.get<FrameTimingSettings>().gpuTimerQueriesEnabled, frameTimingSettings.value.gpuTimerQueriesEnabled);
+    EXPECT_EQ(config.get<FlowControllerSettings>().proportionalGain, flowControllerSettings.value.proportionalGain);
+    EXPECT_EQ(config.get<FlowControllerSettings>().integralGain, flowControllerSettings.value.integralGain);
+    EXPECT_EQ(config.get<FlowControllerSettings>().integralLimit, flowControllerSettings.value.integralLimit);
+    EXPECT_FLOAT_EQ(config.get<FlowControllerSettings>().hysteresis, flowControllerSettings.value.hysteresis);
+    EXPECT_EQ(config.get<FlowControllerSettings>().targetQueueDepth, flowControllerSettings.value.targetQueueDepth);
+    EXPECT_EQ(config.get<SpectrumInterpolationEnabled>(), spectrumInterpolationEnabled.value);
+    EXPECT_EQ(config.get<QualityGovernorSettings>().enabled, qualityGovernorSettings.value.enabled);
+    EXPECT_EQ(config.get<QualityGovernorSettings>().cpuBudgetInPercents, qualityGovernorSettings.value.cpuBudgetInPercents);
+    EXPECT_EQ(config.get<QualityGovernorSettings>().restoreThresholdInPercents, qualityGovernorSettings.value.restoreThresholdInPercents);
+    EXPECT_EQ(config.get<QualityGovernorSettings>().maxQueueDepth, qualityGovernorSettings.value.maxQueueDepth);
+    EXPECT_EQ(config.get<QualityGovernorSettings>().restoreDelayInSeconds, qualityGovernorSettings.value.restoreDelayInSeconds);
     EXPECT_EQ(config.get<AdvancedColorSettings>(), advancedColorSettings.value);
     EXPECT_EQ(config.get<BackgroundColorSettings>(), backgroundColorSettings.value);
     EXPECT_EQ(config.get<WindowTitle>(), windowTitle.value);
@@ -198,6 +308,7 @@ TEST_F(ConfigReaderTests, configReaderTest)
     EXPECT_EQ(config.get<NormalWindowSize>().first, normalWindowSize.value.first);
     EXPECT_EQ(config.get<NormalWindowSize>().second, normalWindowSize.value.second);
     EXPECT_EQ(config.get<NumberOfSamples>(), numberOfSamples.value);
+    EXPECT_EQ(config.get<NumberOfSamplesCollectedFromHw>(), numberOfSamplesCollectedFromHw.value);
     EXPECT_EQ(config.get<SamplingRate>(), samplingRate.value);
     EXPECT_EQ(config.get<DesiredFrameRate>(), desiredFrameRate.value);
     EXPECT_EQ(config.get<GapWidthInRelationToRectangleWidth>(), gapWidthInRelationToRectangleWidth.value);
@@ -224,4 +335,5 @@ TEST_F(ConfigReaderTests, configReaderTest)
     positionValuesChecker(config.get<ColorsOfRectangle>(), colorsOfRectangle.value);
     positionValuesChecker(config.get<ColorsOfDynamicMaxHoldRectangle>(), colorsOfDynamicMaxHoldRectangle.value);
     positionValuesChecker(config.get<ColorsOfDynamicMaxHoldSecondaryRectangle>(), colorsOfDynamicMaxHoldSecondaryRectangle.value);
+    positionValuesChecker(config.get<ThreadSchedulingSettings>(), threadSchedulingSettings.value);
 }
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/DataExchanger.hpp"
+#include <gtest/gtest.h>
+
+
+TEST(DataExchangerTests, droppedValuesAreCounted)
+{
+    DataExchanger<int> dataExchanger(2);
+
+    for(int i=1; i<=7; ++i)
+    {
+        dataExchanger.push_back(std::move(i));
+    }
+
+    // the queue is emptied each time it overflows, after the third and the sixth value
+    EXPECT_EQ(6, dataExchanger.getNumberOfDroppedValues());
+    EXPECT_EQ(1, dataExchanger.getSize());
+    EXPECT_EQ(7, dataExchanger.get());
+    EXPECT_EQ(std::nullopt, dataExchanger.getWithoutBlocking());
+}
+
+TEST(DataExchangerTests, waitingForValueEndsAfterTimeout)
+{
+    DataExchanger<int> dataExchanger(2);
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(std::nullopt, dataExchanger.getWithTimeout(std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - startTime, std::chrono::milliseconds(20));
+
+    dataExchanger.push_back(3);
+
+    EXPECT_EQ(3, dataExchanger.getWithTimeout(std::chrono::milliseconds(20)));
+}
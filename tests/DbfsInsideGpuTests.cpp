@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/gpu/DbfsInsideGpu.hpp"
+#include "core/CommonData.hpp"
+#include "helpers/OpenGlMock.hpp"
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+
+class DbfsInsideGpuTests : public ::testing::Test
+{
+public:
+    NiceMock<OpenGlMock> openGL;
+    const uint32_t numberOfValues{100};
+    const std::map<MaxHolderType, MaxHoldSettings> maxHolds{{MaxHolderType::Dynamic, MaxHoldSettings{900, true}},
+                                                            {MaxHolderType::Transparent, MaxHoldSettings{1000, false}}};
+
+    const float* getValues(const DbfsInsideGpu::Source &source)
+    {
+        return reinterpret_cast<const float*>(openGL.getBufferStorage(source.buffer).data()) + source.baseInstance;
+    }
+};
+
+TEST_F(DbfsInsideGpuTests, valuesOfAllLayersAreKeptInOneBuffer)
+{
+    DbfsInsideGpu dbfs(numberOfValues, -60, maxHolds);
+
+    const auto spectrum = dbfs.getSpectrum();
+    const auto dynamicMaxHold = dbfs.getMaxHold(MaxHolderType::Dynamic);
+    const auto transparentMaxHold = dbfs.getMaxHold(MaxHolderType::Transparent);
+    const auto bottomOfScreen = dbfs.getBottomOfScreen();
+
+    EXPECT_EQ(spectrum.buffer, dynamicMaxHold.buffer);
+    EXPECT_EQ(spectrum.buffer, transparentMaxHold.buffer);
+    EXPECT_EQ(spectrum.buffer, bottomOfScreen.buffer);
+
+    EXPECT_EQ(InstanceRingBuffer::numberOfRegions * numberOfValues, dynamicMaxHold.baseInstance);
+    EXPECT_EQ(dynamicMaxHold.baseInstance + numberOfValues, transparentMaxHold.baseInstance);
+    EXPECT_EQ(transparentMaxHold.baseInstance + numberOfValues, bottomOfScreen.baseInstance);
+
+    EXPECT_EQ(getFloorDbFs16bit(), getValues(transparentMaxHold)[numberOfValues - 1]);
+    EXPECT_EQ(-60, getValues(bottomOfScreen)[0]);
+}
+
+TEST_F(DbfsInsideGpuTests, spectrumIsUploadedOncePerFrameIntoNextRegion)
+{
+    DbfsInsideGpu dbfs(numberOfValues, -60, maxHolds);
+
+    // the second update fences the first region, each update fences its copy of max hold values
+    EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times(0);
+    EXPECT_CALL(openGL, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)).Times(1 + 2);
+
+    dbfs.update(std::vector<float>(numberOfValues, -10), 20);
+    const auto firstSpectrum = dbfs.getSpectrum();
+
+    dbfs.update(std::vector<float>(numberOfValues / 2, -20), 40);
+    const auto secondSpectrum = dbfs.getSpectrum();
+
+    EXPECT_EQ(firstSpectrum.buffer, secondSpectrum.buffer);
+    EXPECT_EQ(numberOfValues, secondSpectrum.baseInstance - firstSpectrum.baseInstance);
+
+    EXPECT_EQ(-10, getValues(firstSpectrum)[numberOfValues - 1]);
+    EXPECT_EQ(-20, getValues(secondSpectrum)[0]);
+    EXPECT_EQ(getFloorDbFs16bit(), getValues(secondSpectrum)[numberOfValues - 1]);
+    EXPECT_EQ(-60, getValues(dbfs.getBottomOfScreen())[numberOfValues - 1]);
+}
+
+TEST_F(DbfsInsideGpuTests, maxHoldValuesAreCalculatedByComputePass)
+{
+    DbfsInsideGpu dbfs(numberOfValues, -60, maxHolds);
+
+    const uint32_t numberOfWorkGroups{2};
+    const GLbitfield barriers = GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT;
+
+    EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(AnyNumber());
+    EXPECT_CALL(openGL, glProgramUniform1ui(_,_,_)).Times(AnyNumber());
+    EXPECT_CALL(openGL, glBindBufferBase(_,_,_)).Times(AnyNumber());
+    EXPECT_CALL(openGL, glProgramUniform1f(_, _, 900)).Times(1);
+    EXPECT_CALL(openGL, glProgramUniform1f(_, _, 1000)).Times(1);
+    EXPECT_CALL(openGL, glProgramUniform1ui(_, _, dbfs.getMaxHold(MaxHolderType::Dynamic).baseInstance)).Times(1);
+    EXPECT_CALL(openGL, glProgramUniform1ui(_, _, dbfs.getMaxHold(MaxHolderType::Transparent).baseInstance)).Times(1);
+    EXPECT_CALL(openGL, glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, dbfs.getSpectrum().buffer)).Times(1);
+    EXPECT_CALL(openGL, glDispatchCompute(numberOfWorkGroups, 1, 1)).Times(maxHolds.size());
+    EXPECT_CALL(openGL, glMemoryBarrier(barriers)).Times(1);
+
+    dbfs.update(std::vector<float>(numberOfValues, -10), 20);
+
+    EXPECT_EQ(getFloorDbFs16bit(), dbfs.getMaxHoldValue(MaxHolderType::Dynamic, 0));
+    EXPECT_EQ(getFloorDbFs16bit(), dbfs.getMaxHoldValue(MaxHolderType::Transparent, numberOfValues));
+}
+
+TEST_F(DbfsInsideGpuTests, floorOfTheSourceIsUsedForMissingValuesAndMaxHolds)
+{
+    DbfsInsideGpu dbfs(numberOfValues, -60, maxHolds);
+    const float floorDbFs = getFloorDbFs(SampleFormat::Float32);
+
+    EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(AnyNumber());
+    EXPECT_CALL(openGL, glProgramUniform1f(_, _, floorDbFs)).Times(1);
+
+    dbfs.updateFloorDbFs(floorDbFs);
+    dbfs.update(std::vector<float>(numberOfValues / 2, -20), 20);
+
+    EXPECT_EQ(-20, getValues(dbfs.getSpectrum())[0]);
+    EXPECT_EQ(floorDbFs, getValues(dbfs.getSpectrum())[numberOfValues - 1]);
+}
+
+TEST_F(DbfsInsideGpuTests, maxHoldValuesAreReadOnlyFromFinishedCopies)
+{
+    DbfsInsideGpu dbfs(numberOfValues, -60, maxHolds);
+
+    const auto dynamicMaxHold = dbfs.getMaxHold(MaxHolderType::Dynamic);
+    const GLsizeiptr sizeOfMaxHolds = maxHolds.size() * numberOfValues * sizeof(float);
+
+    // stands in for the compute pass, which is not run by the mock
+    const_cast<float*>(getValues(dynamicMaxHold))[5] = -30;
+
+    EXPECT_CALL(openGL, glClientWaitSync(_, GL_SYNC_FLUSH_COMMANDS_BIT, _)).Times(AnyNumber());
+    EXPECT_CALL(openGL, glClientWaitSync(_, 0, 0))
+        .WillOnce(Return(GL_TIMEOUT_EXPIRED))
+        .WillOnce(Return(GL_TIMEOUT_EXPIRED))
+        .WillRepeatedly(Return(GL_ALREADY_SIGNALED));
+    EXPECT_CALL(openGL, glCopyNamedBufferSubData(dynamicMaxHold.buffer, _, dynamicMaxHold.baseInstance * sizeof(float), _, sizeOfMaxHolds)).Times(3);
+
+    dbfs.update(std::vector<float>(numberOfValues, -10), 20);
+    EXPECT_EQ(getFloorDbFs16bit(), dbfs.getMaxHoldValue(MaxHolderType::Dynamic, 5));
+
+    dbfs.update(std::vector<float>(numberOfValues, -10), 40);
+    EXPECT_EQ(getFloorDbFs16bit(), dbfs.getMaxHoldValue(MaxHolderType::Dynamic, 5));
+
+    // the only finished copy would be overwritten, so this copy is skipped
+    dbfs.update(std::vector<float>(numberOfValues, -10), 60);
+    EXPECT_EQ(getFloorDbFs16bit(), dbfs.getMaxHoldValue(MaxHolderType::Dynamic, 5));
+
+    dbfs.update(std::vector<float>(numberOfValues, -10), 80);
+    EXPECT_EQ(-30, dbfs.getMaxHoldValue(MaxHolderType::Dynamic, 5));
+    EXPECT_EQ(getFloorDbFs16bit(), dbfs.getMaxHoldValue(MaxHolderType::Transparent, 5));
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/gpu/DrawCommandTable.hpp"
+#include "helpers/OpenGlMock.hpp"
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::InSequence;
+
+
+class DrawCommandTableTests : public ::testing::Test
+{
+public:
+    NiceMock<OpenGlMock> openGL;
+    const uint32_t numberOfLayers{3};
+
+    const DrawArraysIndirectCommand* getCommands(const void *indirect)
+    {
+        return static_cast<const DrawArraysIndirectCommand*>(openGL.getCommandsOfBoundIndirectBuffer(indirect));
+    }
+};
+
+TEST_F(DrawCommandTableTests, layersAreDrawnInOrderBySingleMultiDraw)
+{
+    DrawCommandTable commands(numberOfLayers);
+
+    commands.set(0, 4, 100, 0, 0);
+    commands.set(1, 4, 100, 4, 300);
+    commands.set(2, 4, 100, 8, 400);
+    commands.hide(1);
+
+    {
+        InSequence s;
+
+        EXPECT_CALL(openGL, glBindBuffer(GL_DRAW_INDIRECT_BUFFER, _)).Times(1);
+        EXPECT_CALL(openGL, glMultiDrawArraysIndirect(GL_TRIANGLE_FAN, _, numberOfLayers, 0)).WillOnce([this](GLenum, const void *indirect, GLsizei, GLsizei)
+        {
+            const auto *drawnCommands = getCommands(indirect);
+
+            EXPECT_EQ(100, drawnCommands[0].instanceCount);
+            EXPECT_EQ(0, drawnCommands[1].instanceCount);
+            EXPECT_EQ(4, drawnCommands[1].first);
+            EXPECT_EQ(8, drawnCommands[2].first);
+            EXPECT_EQ(400, drawnCommands[2].baseInstance);
+        });
+        EXPECT_CALL(openGL, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)).Times(1);
+    }
+
+    commands.draw(GL_TRIANGLE_FAN);
+}
+
+TEST_F(DrawCommandTableTests, commandsOfNextFrameDoNotOverwriteCommandsReadByGpu)
+{
+    DrawCommandTable commands(numberOfLayers);
+    std::vector<const void*> offsets;
+
+    EXPECT_CALL(openGL, glMultiDrawArraysIndirect(_,_,_,_)).WillRepeatedly([&offsets](GLenum, const void *indirect, GLsizei, GLsizei)
+    {
+        offsets.push_back(indirect);
+    });
+
+    for(GLuint frame=0; frame<2; ++frame)
+    {
+        commands.set(0, 2, 10, 0, frame * 10);
+        commands.draw(GL_LINES);
+    }
+
+    ASSERT_EQ(2, offsets.size());
+    EXPECT_EQ(numberOfLayers * sizeof(DrawArraysIndirectCommand), reinterpret_cast<uintptr_t>(offsets[1]) - reinterpret_cast<uintptr_t>(offsets[0]));
+    EXPECT_EQ(0, getCommands(offsets[0])[0].baseInstance);
+    EXPECT_EQ(10, getCommands(offsets[1])[0].baseInstance);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/gpu/DynamicLinesInsideGpu.hpp"
+#include "helpers/OpenGlMock.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+
+class DynamicLinesInsideGpuTests : public ::testing::Test
+{
+public:
+    NiceMock<OpenGlMock> openGL;
+    const std::vector<std::vector<float>> colors{{1, 0, 0, 1}, {0, 1, 0, 1}, {0, 0, 1, 1}};
+    const uint32_t numberOfLines{10};
+    const uint32_t verticesPerLine{2};
+
+    std::string getVertexShader()
+    {
+        std::string vertexShader;
+
+        EXPECT_CALL(openGL, glCreateShaderProgramv(GL_FRAGMENT_SHADER, 1, _)).Times(1);
+        EXPECT_CALL(openGL, glCreateShaderProgramv(GL_VERTEX_SHADER, 1, _)).WillOnce([&vertexShader](GLenum, GLsizei, const GLchar *const* strings)
+        {
+            vertexShader = strings[0];
+            return 1;
+        });
+
+        DynamicLinesInsideGpu::initialize();
+        return vertexShader;
+    }
+};
+
+TEST_F(DynamicLinesInsideGpuTests, everyLayerStartsAtVertexTakenByShaderForBeginningOfLine)
+{
+    DynamicLinesInsideGpu lines(numberOfLines, colors);
+
+    // the shader takes the value and the x of the end of a line from the vertex within the line
+    const auto vertexShader = getVertexShader();
+    EXPECT_NE(std::string::npos, vertexShader.find("int end = gl_VertexID % 2;"));
+    EXPECT_NE(std::string::npos, vertexShader.find("float(gl_InstanceID + end)"));
+
+    EXPECT_CALL(openGL, glMultiDrawArraysIndirect(GL_LINES, _, colors.size(), 0)).WillOnce([this](GLenum, const void *indirect, GLsizei, GLsizei)
+    {
+        const auto *commands = static_cast<const DrawArraysIndirectCommand*>(openGL.getCommandsOfBoundIndirectBuffer(indirect));
+
+        for(uint32_t layer=0; layer<colors.size(); ++layer)
+        {
+            EXPECT_EQ(verticesPerLine, commands[layer].count);
+            EXPECT_EQ(numberOfLines, commands[layer].instanceCount);
+            EXPECT_EQ(0, commands[layer].first % verticesPerLine);
+
+            // vertices are read with the same indexes as instances, colors are bound at binding 0
+            const auto *color = static_cast<const float*>(openGL.getInstancesOfBoundVertexArray(0, commands[layer].first));
+            EXPECT_EQ(colors.at(layer), std::vector<float>(color, color + 4));
+        }
+    });
+
+    const DbfsInsideGpu::Source source{1, 0};
+    lines.draw({source, source, source});
+}
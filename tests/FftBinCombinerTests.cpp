@@ -7,6 +7,7 @@
 #include "helpers/ValuesChecker.hpp"
 #include "helpers/TestHelpers.hpp"
 #include "core/FftBinCombiner.hpp"
+#include "core/CommonData.hpp"
 #include <gtest/gtest.h>
 #include <cmath>
 
@@ -45,7 +46,7 @@ TEST_P(FftBinCombinerTests, test)
 {
     auto params = GetParam();
 
-    FftBinCombiner fftBinCombiner(1,0, params.frequencyIndexes);
+    FftBinCombiner fftBinCombiner(1,0, getFloorDbFs16bit(), params.frequencyIndexes);
     std::vector<std::complex<float>> data = createFakeFft(params.fftSize, params.binsWithMagnitudes);
     valueChecker(params.expectedDbfsValues, fftBinCombiner.combineMagnitudes(data));
 }
@@ -75,7 +76,7 @@ TEST_P(FftBinCombinerTests2, test)
 {
     auto params = GetParam();
 
-    FftBinCombiner fftBinCombiner(1,0, params.frequencyIndexes);
+    FftBinCombiner fftBinCombiner(1,0, getFloorDbFs16bit(), params.frequencyIndexes);
     std::vector<std::complex<float>> data = createFakeFft(params.fftSize, params.binsWithMagnitudes);
     EXPECT_NEAR(params.expectedDbfsValue ,fftBinCombiner.combineRmsValues(data),marginOfError);
 }
@@ -89,3 +90,21 @@ INSTANTIATE_TEST_SUITE_P(
         FftBinCombinerRmsParams{4096,{{99,32767}, {100,32767},{101,32767}},1.76091, FrequencyIndexesPerRectangle{{{0, {99,100,101}}}}}
         )
     );
+
+TEST(FftBinCombinerFloorTests, quietBinsAreClampedAtTheFloorOfTheSampleFormat)
+{
+    const FrequencyIndexesPerRectangle frequencyIndexes{{{0},{0}},{{1},{1}},{{2},{}}};
+    const std::vector<std::complex<float>> data = createFakeFft(4096, {{0,0.01f}, {1,0}});
+
+    FftBinCombiner fftBinCombiner(1,0, getFloorDbFs16bit(), frequencyIndexes);
+    const auto dbfsValuesOf16bitSource = fftBinCombiner.combineMagnitudes(data);
+    EXPECT_FLOAT_EQ(getFloorDbFs16bit(), dbfsValuesOf16bitSource.at(0));
+    EXPECT_FLOAT_EQ(getFloorDbFs16bit(), dbfsValuesOf16bitSource.at(1));
+    EXPECT_FLOAT_EQ(getFloorDbFs16bit(), dbfsValuesOf16bitSource.at(2));
+
+    fftBinCombiner.updateFloorDbFs(getFloorDbFs(SampleFormat::Float32));
+    const auto dbfsValuesOfFloatSource = fftBinCombiner.combineMagnitudes(data);
+    EXPECT_NEAR(-130.309f, dbfsValuesOfFloatSource.at(0), 0.001f);
+    EXPECT_FLOAT_EQ(getFloorDbFs24bit(), dbfsValuesOfFloatSource.at(1));
+    EXPECT_FLOAT_EQ(getFloorDbFs24bit(), dbfsValuesOfFloatSource.at(2));
+}
@@ -229,6 +229,78 @@ TEST_P(WelchCalculatorTest, checkingIfCalculatorWorksWellWithOverlappingAbovePro
     EXPECT_EQ(17, result.size());
 }
 
+TEST_P(WelchCalculatorTest, captureTimeOfSegmentIsTakenFromBlockHoldingItsNewestSample)
+{
+    const std::chrono::steady_clock::time_point firstCaptureTime(std::chrono::seconds(1));
+    const std::chrono::steady_clock::time_point secondCaptureTime(std::chrono::seconds(2));
+
+    std::vector<float> signal = generateSignal(numberOfSamples,numberOfSamples,signalAmplitude);
+
+    WelchCalculator welchCalculator(GetParam(), numberOfSamples, 0.5, generateWindow(numberOfSamples));
+    welchCalculator.updateBuffer(signal, firstCaptureTime);
+    welchCalculator.updateBuffer(signal, secondCaptureTime);
+
+    EXPECT_EQ(3, welchCalculator.calculate().size());
+    EXPECT_EQ(welchCalculator.getCaptureTimes(), std::vector<std::chrono::steady_clock::time_point>({firstCaptureTime, secondCaptureTime, secondCaptureTime}));
+
+    EXPECT_TRUE(welchCalculator.calculate().empty());
+    EXPECT_TRUE(welchCalculator.getCaptureTimes().empty());
+}
+
+TEST_P(WelchCalculatorTest, bufferedSamplesAreKeptWhenFftSizeIsChanged)
+{
+    std::vector<float> signal = generateSignal(numberOfSamples,numberOfSamples,signalAmplitude);
+
+    WelchCalculator welchCalculator(GetParam(), numberOfSamples, 0, generateWindow(numberOfSamples));
+    welchCalculator.updateBuffer(signal);
+    welchCalculator.updateFftSize(numberOfSamples / 2, generateWindow(numberOfSamples / 2));
+
+    const auto result = welchCalculator.calculate();
+
+    ASSERT_EQ(2, result.size());
+    EXPECT_EQ(numberOfSamples / 2, result.at(0).size());
+    EXPECT_EQ(numberOfSamples / 2, result.at(1).size());
+
+    welchCalculator.updateFftSize(numberOfSamples, generateWindow(numberOfSamples));
+    welchCalculator.updateBuffer(signal);
+
+    const auto resultAfterRestoring = welchCalculator.calculate();
+
+    ASSERT_EQ(1, resultAfterRestoring.size());
+    verifyFftData(resultAfterRestoring.at(0), {}, {{0,0}, {1,signalAmplitude}, {2,0}, {8,0}, {15,signalAmplitude}}, {{1,-90}, {15,90}});
+}
+
+TEST_P(WelchCalculatorTest, preparedFftSizeGivesSameResultsAsSizeCreatedOnDemand)
+{
+    std::vector<float> signal = generateSignal(numberOfSamples,numberOfSamples,signalAmplitude);
+
+    WelchCalculator preparedCalculator(GetParam(), numberOfSamples, 0, generateWindow(numberOfSamples));
+    WelchCalculator calculatorCreatedOnDemand(GetParam(), numberOfSamples, 0, generateWindow(numberOfSamples));
+    preparedCalculator.prepareFftSize(numberOfSamples / 2);
+
+    for(auto *calculator : {&preparedCalculator, &calculatorCreatedOnDemand})
+    {
+        calculator->updateFftSize(numberOfSamples / 2, generateWindow(numberOfSamples / 2));
+        calculator->updateBuffer(signal);
+    }
+
+    const auto preparedResult = preparedCalculator.calculate();
+    const auto resultCreatedOnDemand = calculatorCreatedOnDemand.calculate();
+
+    ASSERT_EQ(2, preparedResult.size());
+    ASSERT_EQ(resultCreatedOnDemand.size(), preparedResult.size());
+
+    for(uint32_t i=0; i<preparedResult.size(); ++i)
+    {
+        ASSERT_EQ(resultCreatedOnDemand.at(i).size(), preparedResult.at(i).size());
+        for(uint32_t j=0; j<preparedResult.at(i).size(); ++j)
+        {
+            EXPECT_NEAR(resultCreatedOnDemand.at(i).at(j).real(), preparedResult.at(i).at(j).real(), 1e-4);
+            EXPECT_NEAR(resultCreatedOnDemand.at(i).at(j).imag(), preparedResult.at(i).at(j).imag(), 1e-4);
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     WelchCalculatorTest,
     WelchCalculatorTest,
@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/dataSource/FileDataSource.hpp"
+#include "core/CommonData.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+
+class FileDataSourceTests : public ::testing::Test
+{
+public:
+
+    ~FileDataSourceTests()
+    {
+        std::filesystem::remove(path);
+    }
+
+    template<typename T>
+    void append(std::vector<uint8_t> &bytes, T value, size_t numberOfBytes = sizeof(T))
+    {
+        uint8_t buffer[sizeof(T)];
+        std::memcpy(buffer, &value, sizeof(T));
+        bytes.insert(bytes.end(), buffer, buffer + numberOfBytes);
+    }
+
+    void appendId(std::vector<uint8_t> &bytes, const char *id)
+    {
+        bytes.insert(bytes.end(), id, id + 4);
+    }
+
+    std::vector<uint8_t> getWaveHeader(uint16_t formatTag, uint16_t numberOfChannels, uint16_t bitsPerSample, uint32_t dataSize, bool rf64 = false)
+    {
+        std::vector<uint8_t> bytes;
+        const uint16_t blockAlign = numberOfChannels * bitsPerSample / 8;
+
+        appendId(bytes, rf64 ? "RF64" : "RIFF");
+        append<uint32_t>(bytes, rf64 ? 0xFFFFFFFF : 36 + dataSize);
+        appendId(bytes, "WAVE");
+
+        if(rf64)
+        {
+            appendId(bytes, "ds64");
+            append<uint32_t>(bytes, 28);
+            append<uint64_t>(bytes, 36 + 36 + dataSize);
+            append<uint64_t>(bytes, dataSize);
+            append<uint64_t>(bytes, dataSize / blockAlign);
+            append<uint32_t>(bytes, 0);
+        }
+
+        appendId(bytes, "fmt ");
+        append<uint32_t>(bytes, 16);
+        append<uint16_t>(bytes, formatTag);
+        append<uint16_t>(bytes, numberOfChannels);
+        append<uint32_t>(bytes, samplingRate);
+        append<uint32_t>(bytes, samplingRate * blockAlign);
+        append<uint16_t>(bytes, blockAlign);
+        append<uint16_t>(bytes, bitsPerSample);
+
+        appendId(bytes, "data");
+        append<uint32_t>(bytes, rf64 ? 0xFFFFFFFF : dataSize);
+
+        return bytes;
+    }
+
+    void writeFile(const std::vector<uint8_t> &bytes)
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "fileDataSourceTest.wav").string();
+    const uint32_t samplingRate{48000};
+    const uint32_t numberOfSamples{64};
+    const float precision{0.01};
+};
+
+TEST_F(FileDataSourceTests, int16StereoWaveIsDeinterleaved)
+{
+    const uint32_t numberOfFrames = 2 * numberOfSamples;
+    auto bytes = getWaveHeader(1, 2, 16, numberOfFrames * 4);
+
+    for(uint32_t i=0; i<numberOfFrames; ++i)
+    {
+        append<int16_t>(bytes, i);
+        append<int16_t>(bytes, -static_cast<int16_t>(i));
+    }
+    writeFile(bytes);
+
+    FileDataSource fileDataSource(path, FilePlayback{false, false, SampleFormat::Int16, 2});
+    ASSERT_TRUE(fileDataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_EQ(fileDataSource.getLayout().numberOfFrames, numberOfFrames);
+
+    fileDataSource.collectStereoDataFromHw();
+    const auto data = fileDataSource.collectStereoDataFromHw();
+
+    ASSERT_EQ(data.left.size(), numberOfSamples);
+    ASSERT_EQ(data.right.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_FLOAT_EQ(data.left[i], numberOfSamples + i);
+        EXPECT_FLOAT_EQ(data.right[i], -static_cast<float>(numberOfSamples + i));
+    }
+}
+
+TEST_F(FileDataSourceTests, int24MonoWaveFeedsBothChannels)
+{
+    auto bytes = getWaveHeader(1, 1, 24, numberOfSamples * 3);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        append<int32_t>(bytes, (i % 2) ? -4194304 : 4194304, 3);
+    }
+    writeFile(bytes);
+
+    FileDataSource fileDataSource(path, FilePlayback{false, true, SampleFormat::Int16, 2});
+    ASSERT_TRUE(fileDataSource.initialize(numberOfSamples, samplingRate));
+
+    const auto data = fileDataSource.collectStereoDataFromHw();
+
+    ASSERT_EQ(data.left.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        const float expected = ((i % 2) ? -0.5f : 0.5f) * getFullScaleAmplitude();
+        EXPECT_NEAR(data.left[i], expected, precision);
+        EXPECT_NEAR(data.right[i], expected, precision);
+    }
+}
+
+TEST_F(FileDataSourceTests, float32MultichannelRf64UsesFirstTwoChannels)
+{
+    const uint16_t numberOfChannels{6};
+    auto bytes = getWaveHeader(3, numberOfChannels, 32, numberOfSamples * numberOfChannels * 4, true);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        for(uint16_t channel=0; channel<numberOfChannels; ++channel)
+        {
+            append<float>(bytes, (channel + 1) * 0.1f);
+        }
+    }
+    writeFile(bytes);
+
+    FileDataSource fileDataSource(path, FilePlayback{false, true, SampleFormat::Int16, 2});
+    ASSERT_TRUE(fileDataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_EQ(fileDataSource.getLayout().numberOfChannels, numberOfChannels);
+    EXPECT_EQ(fileDataSource.getLayout().numberOfFrames, numberOfSamples);
+
+    const auto data = fileDataSource.collectStereoDataFromHw();
+
+    ASSERT_EQ(data.left.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_NEAR(data.left[i], 0.1f * getFullScaleAmplitude(), precision);
+        EXPECT_NEAR(data.right[i], 0.2f * getFullScaleAmplitude(), precision);
+    }
+}
+
+TEST_F(FileDataSourceTests, rawFileUsesConfiguredFormat)
+{
+    std::vector<uint8_t> bytes;
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        append<int32_t>(bytes, 1073741824);
+        append<int32_t>(bytes, -1073741824);
+        append<int32_t>(bytes, 0);
+    }
+    writeFile(bytes);
+
+    FileDataSource fileDataSource(path, FilePlayback{false, true, SampleFormat::Int32, 3});
+    ASSERT_TRUE(fileDataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_EQ(fileDataSource.getLayout().samplingRate, samplingRate);
+
+    const auto data = fileDataSource.collectStereoDataFromHw();
+
+    ASSERT_EQ(data.left.size(), numberOfSamples);
+    EXPECT_NEAR(data.left.front(), 0.5f * getFullScaleAmplitude(), precision);
+    EXPECT_NEAR(data.right.back(), -0.5f * getFullScaleAmplitude(), precision);
+}
+
+TEST_F(FileDataSourceTests, playbackStopsOrLoopsAtTheEndOfFile)
+{
+    auto bytes = getWaveHeader(1, 2, 16, numberOfSamples * 4);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        append<int16_t>(bytes, i);
+        append<int16_t>(bytes, i);
+    }
+    writeFile(bytes);
+
+    FileDataSource loopingDataSource(path, FilePlayback{false, true, SampleFormat::Int16, 2});
+    ASSERT_TRUE(loopingDataSource.initialize(numberOfSamples, samplingRate));
+
+    for(int i=0; i<3; ++i)
+    {
+        const auto data = loopingDataSource.collectStereoDataFromHw();
+        ASSERT_EQ(data.left.size(), numberOfSamples);
+        EXPECT_FLOAT_EQ(data.left.front(), 0);
+    }
+    EXPECT_FALSE(loopingDataSource.checkIfEndOfFileReached());
+
+    FileDataSource singleDataSource(path, FilePlayback{false, false, SampleFormat::Int16, 2});
+    ASSERT_TRUE(singleDataSource.initialize(numberOfSamples, samplingRate));
+
+    EXPECT_EQ(singleDataSource.collectStereoDataFromHw().left.size(), numberOfSamples);
+    EXPECT_TRUE(singleDataSource.collectStereoDataFromHw().left.empty());
+    EXPECT_TRUE(singleDataSource.checkIfEndOfFileReached());
+    EXPECT_FALSE(singleDataSource.checkIfErrorOccured());
+}
+
+TEST_F(FileDataSourceTests, realtimePacingFollowsSamplingRate)
+{
+    const uint32_t numberOfBlocks{10};
+    auto bytes = getWaveHeader(1, 2, 16, numberOfSamples * 4);
+    bytes.resize(bytes.size() + numberOfSamples * 4);
+    writeFile(bytes);
+
+    FileDataSource realtimeDataSource(path, FilePlayback{true, true, SampleFormat::Int16, 2});
+    ASSERT_TRUE(realtimeDataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_TRUE(realtimeDataSource.isRealtime());
+
+    const auto start = std::chrono::steady_clock::now();
+    for(uint32_t i=0; i<numberOfBlocks; ++i)
+    {
+        realtimeDataSource.collectStereoDataFromHw();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, std::chrono::microseconds(1000000ull * numberOfBlocks * numberOfSamples / samplingRate));
+
+    FileDataSource unthrottledDataSource(path, FilePlayback{false, true, SampleFormat::Int16, 2});
+    ASSERT_TRUE(unthrottledDataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_FALSE(unthrottledDataSource.isRealtime());
+}
+
+TEST_F(FileDataSourceTests, invalidFilesAreReported)
+{
+    FileDataSource missingDataSource(path + ".missing", FilePlayback{true, true, SampleFormat::Int16, 2});
+    EXPECT_FALSE(missingDataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_TRUE(missingDataSource.checkIfErrorOccured());
+
+    auto bytes = getWaveHeader(1, 2, 8, numberOfSamples * 2);
+    bytes.resize(bytes.size() + numberOfSamples * 2);
+    writeFile(bytes);
+
+    FileDataSource unsupportedDataSource(path, FilePlayback{true, true, SampleFormat::Int16, 2});
+    EXPECT_FALSE(unsupportedDataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_TRUE(unsupportedDataSource.checkIfErrorOccured());
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/dataSource/FrameLog.hpp"
+#include "core/dataSource/FrameLogDataSource.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+using namespace std::chrono;
+
+class FrameLogTests : public ::testing::Test
+{
+public:
+
+    ~FrameLogTests()
+    {
+        std::filesystem::remove(path);
+    }
+
+    std::vector<StereoData> getBlocks(bool integerSamples)
+    {
+        std::mt19937 generator(3);
+        std::uniform_real_distribution<float> distribution(-32767, 32767);
+        std::vector<StereoData> blocks;
+
+        for(uint32_t i=0; i<numberOfBlocks; ++i)
+        {
+            StereoData data{std::vector<float>(numberOfSamples), std::vector<float>(numberOfSamples)};
+
+            for(uint32_t j=0; j<numberOfSamples; ++j)
+            {
+                // a slowly changing signal, as captured audio usually is
+                const float value = 20000 * std::sin(0.01f * (i * numberOfSamples + j)) + distribution(generator) / 100;
+                data.left[j] = integerSamples ? std::nearbyint(value) : value;
+                data.right[j] = integerSamples ? std::nearbyint(-value / 2) : -value / 2;
+            }
+            blocks.push_back(std::move(data));
+        }
+        return blocks;
+    }
+
+    void record(const std::vector<StereoData> &blocks, FrameLogEncoding encoding, milliseconds interval = 0ms)
+    {
+        FrameLogWriter writer(path, samplingRate, encoding);
+        ASSERT_TRUE(writer.isOpen());
+
+        for(size_t i=0; i<blocks.size(); ++i)
+        {
+            writer.write(blocks[i], i * interval);
+        }
+    }
+
+    void overwrite(std::streamoff offset, const std::vector<uint8_t> &bytes)
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    // the first record follows the header of the log, its first channel follows the header of the record
+    const std::streamoff numberOfSamplesOffset{12 + 8};
+    const std::streamoff riceParameterOffset{12 + 12 + 5};
+
+    const std::string path = (std::filesystem::temp_directory_path() / "frameLogTest.safl").string();
+    const uint32_t samplingRate{48000};
+    const uint32_t numberOfSamples{256};
+    const uint32_t numberOfBlocks{20};
+};
+
+TEST_F(FrameLogTests, floatAndLosslessEncodingsAreBitExact)
+{
+    for(const bool integerSamples : {false, true})
+    {
+        for(const auto encoding : {FrameLogEncoding::Float32, FrameLogEncoding::Lossless})
+        {
+            const auto blocks = getBlocks(integerSamples);
+            record(blocks, encoding);
+
+            FrameLogReader reader(path);
+            ASSERT_TRUE(reader.isOpen());
+            EXPECT_EQ(reader.getSamplingRate(), samplingRate);
+
+            for(const auto &block : blocks)
+            {
+                const auto record = reader.readNext();
+                ASSERT_TRUE(record);
+                EXPECT_EQ(record->data.left, block.left);
+                EXPECT_EQ(record->data.right, block.right);
+            }
+            EXPECT_FALSE(reader.readNext());
+        }
+    }
+}
+
+TEST_F(FrameLogTests, losslessEncodingCompressesIntegerSamples)
+{
+    const auto blocks = getBlocks(true);
+
+    record(blocks, FrameLogEncoding::Float32);
+    const auto floatSize = std::filesystem::file_size(path);
+
+    record(blocks, FrameLogEncoding::Lossless);
+    const auto losslessSize = std::filesystem::file_size(path);
+
+    record(blocks, FrameLogEncoding::Int16);
+    const auto int16Size = std::filesystem::file_size(path);
+
+    EXPECT_LT(losslessSize, int16Size);
+    EXPECT_LT(int16Size, floatSize);
+}
+
+TEST_F(FrameLogTests, int16EncodingRoundsSamples)
+{
+    const auto blocks = getBlocks(false);
+    record(blocks, FrameLogEncoding::Int16);
+
+    FrameLogReader reader(path);
+    const auto record = reader.readNext();
+
+    ASSERT_TRUE(record);
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_EQ(record->data.left[i], std::nearbyint(blocks.front().left[i]));
+    }
+}
+
+TEST_F(FrameLogTests, replayDeliversRecordedBlocksInLoop)
+{
+    const auto blocks = getBlocks(false);
+    record(blocks, FrameLogEncoding::Lossless);
+
+    FrameLogDataSource dataSource(path, false);
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_FALSE(dataSource.isRealtime());
+
+    for(uint32_t i=0; i<2 * numberOfBlocks; ++i)
+    {
+        const auto data = dataSource.collectStereoDataFromHw();
+        EXPECT_EQ(data.left, blocks[i % numberOfBlocks].left);
+        EXPECT_EQ(data.right, blocks[i % numberOfBlocks].right);
+    }
+    EXPECT_TRUE(dataSource.checkIfEndOfLogReached());
+}
+
+TEST_F(FrameLogTests, replayKeepsRecordedTiming)
+{
+    record(getBlocks(true), FrameLogEncoding::Lossless, 5ms);
+
+    FrameLogDataSource dataSource(path, true);
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+
+    const auto startTime = steady_clock::now();
+
+    for(uint32_t i=0; i<numberOfBlocks; ++i)
+    {
+        dataSource.collectStereoDataFromHw();
+    }
+
+    EXPECT_GE(steady_clock::now() - startTime, (numberOfBlocks - 1) * 5ms);
+}
+
+TEST_F(FrameLogTests, damagedLogIsReported)
+{
+    record(getBlocks(true), FrameLogEncoding::Lossless);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 10);
+
+    FrameLogDataSource dataSource(path, false);
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+
+    for(uint32_t i=0; (i<numberOfBlocks) && !dataSource.checkIfErrorOccured(); ++i)
+    {
+        dataSource.collectStereoDataFromHw();
+    }
+    EXPECT_TRUE(dataSource.checkIfErrorOccured());
+}
+
+TEST_F(FrameLogTests, damagedRecordHeadersAreRejectedBeforeDecoding)
+{
+    record(getBlocks(true), FrameLogEncoding::Lossless);
+    overwrite(numberOfSamplesOffset, {0xff, 0xff, 0xff, 0x7f});
+
+    {
+        FrameLogReader reader(path);
+        ASSERT_TRUE(reader.isOpen());
+        EXPECT_THROW(reader.readNext(), std::runtime_error);
+    }
+
+    record(getBlocks(true), FrameLogEncoding::Lossless);
+    overwrite(riceParameterOffset, {200});
+
+    FrameLogReader reader(path);
+    ASSERT_TRUE(reader.isOpen());
+    EXPECT_THROW(reader.readNext(), std::runtime_error);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/FrameBudgetWatchdog.hpp"
+#include "core/gpu/GpuTimer.hpp"
+#include "helpers/OpenGlMock.hpp"
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::SetArgPointee;
+using ::testing::NiceMock;
+
+
+TEST(FrameBudgetWatchdogTests, framesWithinBudgetAreNotReported)
+{
+    FrameBudgetWatchdog watchdog(10000us);
+    const auto now = steady_clock::now();
+
+    EXPECT_EQ(std::nullopt, watchdog.check({{"background", 2000us}, {"rectangles", 8000us}}, now));
+    EXPECT_EQ(std::nullopt, FrameBudgetWatchdog(0us).check({{"rectangles", 80000us}}, now));
+}
+
+TEST(FrameBudgetWatchdogTests, longestOperationIsReportedOncePerSecond)
+{
+    FrameBudgetWatchdog watchdog(10000us);
+    const auto now = steady_clock::now();
+    const std::vector<OperationTime> operationTimes{{"background", 2000us}, {"rectangles", 9000us}, {"highlight", 500us}};
+
+    const auto report = watchdog.check(operationTimes, now);
+
+    ASSERT_NE(std::nullopt, report);
+    EXPECT_NE(std::string::npos, report->find("11500 us"));
+    EXPECT_NE(std::string::npos, report->find("longest operation: rectangles 9000 us"));
+
+    EXPECT_EQ(std::nullopt, watchdog.check(operationTimes, now + 100ms));
+    EXPECT_EQ(std::nullopt, watchdog.check(operationTimes, now + 900ms));
+
+    const auto nextReport = watchdog.check(operationTimes, now + 1000ms);
+
+    ASSERT_NE(std::nullopt, nextReport);
+    EXPECT_NE(std::string::npos, nextReport->find("frames over the budget: 3"));
+}
+
+class GpuTimerTests : public ::testing::Test
+{
+public:
+    NiceMock<OpenGlMock> openGL;
+};
+
+TEST_F(GpuTimerTests, resultsAreCollectedWhenQueriesAreReused)
+{
+    const auto firstSection = std::make_shared<StageMetrics>("gpu/first");
+    const auto secondSection = std::make_shared<StageMetrics>("gpu/second");
+    const uint32_t numberOfQueries{8};
+
+    EXPECT_CALL(openGL, glGenQueries(numberOfQueries, _)).WillOnce(Invoke([](GLsizei n, GLuint *ids){
+        for(GLsizei i=0; i<n; ++i)
+        {
+            ids[i] = i + 1;
+        }
+    }));
+
+    GpuTimer gpuTimer({firstSection, secondSection});
+
+    EXPECT_CALL(openGL, glBeginQuery(GL_TIME_ELAPSED, _)).Times(numberOfQueries + 2);
+    EXPECT_CALL(openGL, glEndQuery(GL_TIME_ELAPSED)).Times(numberOfQueries + 2);
+    EXPECT_CALL(openGL, glGetQueryObjectiv(_, GL_QUERY_RESULT_AVAILABLE, _)).WillRepeatedly(Invoke([](GLuint id, GLenum, GLint *isAvailable){
+        *isAvailable = (id % 2) ? GL_TRUE : GL_FALSE;
+    }));
+    EXPECT_CALL(openGL, glGetQueryObjectui64v(_, GL_QUERY_RESULT, _)).WillRepeatedly(SetArgPointee<2>(GLuint64{250000}));
+
+    for(int frame=0; frame<5; ++frame)
+    {
+        gpuTimer.startFrame();
+
+        for(uint32_t section=0; section<2; ++section)
+        {
+            gpuTimer.begin(section);
+            gpuTimer.end();
+        }
+    }
+
+    // queries of the first frame are reused by the fifth one, only the first section has its result ready
+    const auto firstSummary = LatencyHistogram::summarize(firstSection->getProcessingTimes());
+
+    EXPECT_EQ(1, firstSummary.count);
+    EXPECT_NEAR(250, firstSummary.p50.count(), 250 / LatencyHistogram::numberOfSubBuckets);
+    EXPECT_EQ(0, LatencyHistogram::summarize(secondSection->getProcessingTimes()).count);
+    EXPECT_EQ(0, firstSection->getNumberOfCalls());
+
+    EXPECT_CALL(openGL, glDeleteQueries(numberOfQueries, _)).Times(1);
+}
+
+TEST_F(GpuTimerTests, supportDependsOnContextVersion)
+{
+    GLAD_GL_VERSION_3_3 = 0;
+    EXPECT_FALSE(GpuTimer::isSupported());
+
+    GLAD_GL_VERSION_3_3 = 1;
+    EXPECT_TRUE(GpuTimer::isSupported());
+
+    GLAD_GL_VERSION_3_3 = 0;
+}
@@ -71,6 +71,16 @@ TEST_F(FrequenciesInfoTests, testingClosestFrequencies)
     valueChecker({0,0,0,1,1,2}, frequenciesInfo.getRectangleIndexesClosestToFrequencies({1.0f, 0.99f * binFrequency, 1.49f * binFrequency, 1.51f * binFrequency, 2.49f * binFrequency, 2.51f * binFrequency}));
 }
 
+TEST_F(FrequenciesInfoTests, mergedRectanglesTakeFrequenciesOfAllTheirRectangles)
+{
+    FrequenciesInfo frequenciesInfo(44100, 4096, {0, 10, 20, 30, 40});
+
+    positionValuesChecker<FrequencyIndex>(FrequencyIndexesPerRectangle{{{0},{1}},{{1},{2,3}},{{2},{4}}}, frequenciesInfo.getFrequencyIndexesOfMergedRectangles(2));
+
+    // a rectangle without frequencies takes the closest one
+    positionValuesChecker<FrequencyIndex>(FrequencyIndexesPerRectangle{{{0},{0}},{{1},{1}},{{2},{2}},{{3},{3}},{{4},{4}}}, frequenciesInfo.getFrequencyIndexesOfMergedRectangles(1));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     FrequenciesInfoTests,
     FrequenciesInfoTests,
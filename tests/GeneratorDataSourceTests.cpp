@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/dataSource/GeneratorDataSource.hpp"
+#include "core/CommonData.hpp"
+#include "helpers/TestHelpers.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+class GeneratorDataSourceTests : public ::testing::Test
+{
+public:
+
+    std::vector<float> collect(GeneratorDataSource &dataSource, uint32_t numberOfBlocks, bool leftChannel = true)
+    {
+        std::vector<float> result;
+
+        for(uint32_t i=0; i<numberOfBlocks; ++i)
+        {
+            const auto data = dataSource.collectStereoDataFromHw();
+            const auto &channel = leftChannel ? data.left : data.right;
+            result.insert(result.end(), channel.begin(), channel.end());
+        }
+        return result;
+    }
+
+    float getRms(const std::vector<float> &signal)
+    {
+        return std::sqrt(std::inner_product(signal.begin(), signal.end(), signal.begin(), 0.0) / signal.size());
+    }
+
+    const GeneratorSignal off{SignalType::Off, 0, 0, 0, 0, 0};
+    const uint32_t samplingRate{48000};
+    const uint32_t numberOfSamples{100};
+    const float precision{0.5};
+};
+
+TEST_F(GeneratorDataSourceTests, sineIsContinuousAcrossBlocks)
+{
+    GeneratorDataSource dataSource({SignalType::Sine, -6.0206f, 1000, 0, 0, 1}, off, false);
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+    EXPECT_FALSE(dataSource.isRealtime());
+
+    const auto signal = collect(dataSource, 50);
+    const auto expected = generateSignal(signal.size(), samplingRate, 1000, getFullScaleAmplitude() / 2);
+
+    for(size_t i=0; i<signal.size(); ++i)
+    {
+        ASSERT_NEAR(signal[i], expected[i], precision) << "sample " << i;
+    }
+}
+
+TEST_F(GeneratorDataSourceTests, channelsAreConfiguredSeparately)
+{
+    GeneratorDataSource dataSource(off, {SignalType::Multitone, 0, 100, 800, 0, 1}, false);
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+
+    const auto data = dataSource.collectStereoDataFromHw();
+    EXPECT_TRUE(std::all_of(data.left.begin(), data.left.end(), [](float value){ return value == 0; }));
+
+    // 100, 200, 400 and 800 Hz, each with a quarter of the amplitude
+    const auto signal = collect(dataSource, 48, false);
+    EXPECT_NEAR(getRms(signal), getFullScaleAmplitude() / 4 * std::sqrt(4 / 2.0f), 1);
+    EXPECT_LE(*std::max_element(signal.begin(), signal.end()), getFullScaleAmplitude());
+}
+
+TEST_F(GeneratorDataSourceTests, noiseIsDeterministicForSeed)
+{
+    for(const auto type : {SignalType::WhiteNoise, SignalType::PinkNoise})
+    {
+        GeneratorDataSource first({type, 0, 0, 0, 0, 5}, {type, 0, 0, 0, 0, 6}, false);
+        GeneratorDataSource second({type, 0, 0, 0, 0, 5}, {type, 0, 0, 0, 0, 6}, false);
+        first.initialize(numberOfSamples, samplingRate);
+        second.initialize(numberOfSamples, samplingRate);
+
+        const auto firstData = first.collectStereoDataFromHw();
+        const auto secondData = second.collectStereoDataFromHw();
+
+        EXPECT_EQ(firstData.left, secondData.left);
+        EXPECT_EQ(firstData.right, secondData.right);
+        EXPECT_NE(firstData.left, firstData.right);
+
+        const auto signal = collect(first, 480);
+        EXPECT_NEAR(getRms(signal) / (getFullScaleAmplitude() / std::sqrt(3.0f)), 1, 0.25);
+    }
+}
+
+TEST_F(GeneratorDataSourceTests, impulsesAreRepeatedEveryPeriod)
+{
+    GeneratorDataSource dataSource({SignalType::Impulse, 0, 0, 0, 0.01, 1}, off, false);
+    dataSource.initialize(numberOfSamples, samplingRate);
+
+    const auto signal = collect(dataSource, 20);
+
+    for(size_t i=0; i<signal.size(); ++i)
+    {
+        ASSERT_EQ(signal[i], (i % 480 == 0) ? getFullScaleAmplitude() : 0) << "sample " << i;
+    }
+}
+
+TEST_F(GeneratorDataSourceTests, sweepRisesFromStartToStopFrequency)
+{
+    GeneratorDataSource dataSource({SignalType::Sweep, 0, 100, 10000, 1, 1}, off, false);
+    dataSource.initialize(numberOfSamples, samplingRate);
+
+    auto countZeroCrossings = [](const std::vector<float> &signal, size_t begin, size_t end)
+    {
+        uint32_t result{0};
+        for(size_t i=begin+1; i<end; ++i)
+        {
+            result += (signal[i-1] < 0) != (signal[i] < 0);
+        }
+        return result;
+    };
+
+    const auto signal = collect(dataSource, samplingRate / numberOfSamples);
+    const size_t window = samplingRate / 100;
+
+    // two zero crossings per period in 10 ms windows at the start and at the end of the sweep
+    EXPECT_NEAR(countZeroCrossings(signal, 0, window), 2, 1);
+    EXPECT_NEAR(countZeroCrossings(signal, signal.size() - window, signal.size()), 2 * 100 * 0.99, 10);
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/Helpers.hpp"
+#include <gtest/gtest.h>
+
+
+struct NumberOfSamplesCollectedFromHwParams
+{
+    uint32_t samplingRate;
+    uint32_t numberOfSamples;
+    uint32_t numberOfFramesPerSecond;
+    uint32_t expectedNumberOfSamplesCollectedFromHw;
+};
+
+class NumberOfSamplesCollectedFromHwTests : public ::testing::TestWithParam<NumberOfSamplesCollectedFromHwParams>
+{
+};
+
+TEST_P(NumberOfSamplesCollectedFromHwTests, test)
+{
+    auto params = GetParam();
+
+    EXPECT_EQ(params.expectedNumberOfSamplesCollectedFromHw, calculateNumberOfSamplesCollectedFromHw(params.samplingRate, params.numberOfSamples, params.numberOfFramesPerSecond));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    NumberOfSamplesCollectedFromHwTests,
+    NumberOfSamplesCollectedFromHwTests,
+    ::testing::Values(
+        NumberOfSamplesCollectedFromHwParams{48000, 8192, 55, 256},
+        NumberOfSamplesCollectedFromHwParams{192000, 8192, 55, 1024},
+        NumberOfSamplesCollectedFromHwParams{44100, 16384, 10, 2048},
+        NumberOfSamplesCollectedFromHwParams{8000, 2048, 1, 1024},
+        NumberOfSamplesCollectedFromHwParams{8000, 256, 1000, 64},
+        NumberOfSamplesCollectedFromHwParams{384000, 65536, 1, 4096},
+        NumberOfSamplesCollectedFromHwParams{48000, 8192, 0, 4096})
+    );
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/gpu/InstanceRingBuffer.hpp"
+#include "helpers/OpenGlMock.hpp"
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::NiceMock;
+using ::testing::InSequence;
+
+
+class InstanceRingBufferTests : public ::testing::Test
+{
+public:
+    struct Instance
+    {
+        float x, y;
+    };
+
+    NiceMock<OpenGlMock> openGL;
+    const uint32_t numberOfInstances{4};
+};
+
+TEST_F(InstanceRingBufferTests, regionsOfPersistentlyMappedStorageAreWrittenInTurn)
+{
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr size = InstanceRingBuffer::numberOfRegions * numberOfInstances * sizeof(Instance);
+
+    EXPECT_CALL(openGL, glNamedBufferStorage(_, size, nullptr, flags)).Times(1);
+    EXPECT_CALL(openGL, glMapNamedBufferRange(_, 0, size, flags)).Times(1);
+    EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times(0);
+
+    InstanceRingBuffer instances(numberOfInstances, sizeof(Instance));
+
+    const auto *storage = reinterpret_cast<const Instance*>(openGL.getBufferStorage(instances.getBuffer()).data());
+
+    for(uint32_t frame=0; frame<2 * InstanceRingBuffer::numberOfRegions; ++frame)
+    {
+        auto *mappedInstances = instances.startWriting<Instance>();
+        const auto region = frame % InstanceRingBuffer::numberOfRegions;
+
+        EXPECT_EQ(storage + region * numberOfInstances, mappedInstances);
+        EXPECT_EQ(region * numberOfInstances, instances.getBaseInstance());
+
+        mappedInstances[numberOfInstances - 1] = Instance{0, static_cast<float>(frame)};
+        instances.finishDrawing();
+    }
+
+    EXPECT_EQ(5, storage[3 * numberOfInstances - 1].y);
+}
+
+TEST_F(InstanceRingBufferTests, regionIsWrittenAgainWhenGpuFinishedReadingIt)
+{
+    InstanceRingBuffer instances(numberOfInstances, sizeof(Instance));
+    std::vector<GLsync> fences;
+
+    for(uint32_t region=0; region<InstanceRingBuffer::numberOfRegions; ++region)
+    {
+        fences.push_back(reinterpret_cast<GLsync>(region + 100));
+
+        EXPECT_CALL(openGL, glClientWaitSync(_,_,_)).Times(0);
+        EXPECT_CALL(openGL, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)).WillOnce(Return(fences.back()));
+
+        instances.startWriting<Instance>();
+        instances.finishDrawing();
+    }
+
+    {
+        InSequence s;
+
+        EXPECT_CALL(openGL, glClientWaitSync(fences.front(), GL_SYNC_FLUSH_COMMANDS_BIT, _)).WillOnce(Return(GL_TIMEOUT_EXPIRED)).WillOnce(Return(GL_CONDITION_SATISFIED));
+        EXPECT_CALL(openGL, glDeleteSync(fences.front())).Times(1);
+    }
+
+    instances.startWriting<Instance>();
+
+    EXPECT_EQ(0, instances.getBaseInstance());
+}
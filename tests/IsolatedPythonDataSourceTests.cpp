@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/dataSource/IsolatedPythonDataSource.hpp"
+#include "helpers/TestHelpers.hpp"
+#include "helpers/ValuesChecker.hpp"
+#include <gtest/gtest.h>
+#include <signal.h>
+#include <chrono>
+
+
+class IsolatedPythonDataSourceTests : public ValuesChecker<-1,2>, public ::testing::Test
+{
+public:
+
+    StereoData collectUntilDataArrives(IsolatedPythonDataSource &dataSource, std::chrono::seconds timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        while(std::chrono::steady_clock::now() < deadline)
+        {
+            auto stereoData = dataSource.collectStereoDataFromHw();
+
+            if(!stereoData.left.empty())
+            {
+                return stereoData;
+            }
+        }
+        return {};
+    }
+
+    const std::string workerPath{PYTHON_WORKER_PATH};
+    const uint32_t numberOfSamples{1024};
+    const float samplingFrequency{44100};
+};
+
+TEST_F(IsolatedPythonDataSourceTests, samplesArePassedThroughSharedRing)
+{
+    const auto expectedLeftSignal = generateSignal(numberOfSamples, samplingFrequency, 1000, 32767);
+    const auto expectedRightSignal = generateSignal(numberOfSamples, samplingFrequency, 1000, 16384);
+
+    IsolatedPythonDataSource dataSource("testAudioConfig", workerPath);
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingFrequency));
+    EXPECT_NE(dataSource.getWorkerProcessId(), ChildProcess::getCurrentProcessId());
+
+    for(int i=0; i<3; ++i)
+    {
+        auto stereoData = collectUntilDataArrives(dataSource, std::chrono::seconds(5));
+
+        valueChecker(expectedLeftSignal, stereoData.left);
+        valueChecker(expectedRightSignal, stereoData.right);
+    }
+
+    EXPECT_FALSE(dataSource.checkIfErrorOccured());
+    EXPECT_EQ(dataSource.getNumberOfRestarts(), 0);
+}
+
+TEST_F(IsolatedPythonDataSourceTests, killedWorkerIsRestarted)
+{
+    IsolatedPythonDataSource dataSource("testBufferAudioConfig", workerPath);
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingFrequency));
+    ASSERT_EQ(collectUntilDataArrives(dataSource, std::chrono::seconds(5)).left.size(), numberOfSamples);
+
+    const auto killedWorker = dataSource.getWorkerProcessId();
+    kill(static_cast<pid_t>(killedWorker), SIGKILL);
+
+    // blocks already in the ring are consumed first
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while((dataSource.getNumberOfRestarts() == 0) && (std::chrono::steady_clock::now() < deadline))
+    {
+        dataSource.collectStereoDataFromHw();
+    }
+
+    EXPECT_EQ(dataSource.getNumberOfRestarts(), 1);
+    EXPECT_NE(dataSource.getWorkerProcessId(), killedWorker);
+    EXPECT_EQ(collectUntilDataArrives(dataSource, std::chrono::seconds(10)).left.size(), numberOfSamples);
+    EXPECT_FALSE(dataSource.checkIfErrorOccured());
+}
+
+TEST_F(IsolatedPythonDataSourceTests, missingModuleIsReportedAsError)
+{
+    IsolatedPythonDataSource dataSource("notExistingAudioConfig", workerPath);
+
+    EXPECT_FALSE(dataSource.initialize(numberOfSamples, samplingFrequency));
+    EXPECT_TRUE(dataSource.checkIfErrorOccured());
+    EXPECT_TRUE(dataSource.collectStereoDataFromHw().left.empty());
+}
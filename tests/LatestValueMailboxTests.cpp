@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/LatestValueMailbox.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+
+TEST(LatestValueMailboxTests, onlyNewestValueIsTaken)
+{
+    LatestValueMailbox<int> mailbox;
+
+    EXPECT_EQ(nullptr, mailbox.getNewValue());
+
+    for(int i=1; i<=3; ++i)
+    {
+        mailbox.publish(std::move(i));
+    }
+
+    const auto value = mailbox.getNewValue();
+
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(3, *value);
+    EXPECT_EQ(3, mailbox.getSequenceNumberOfLastValue());
+    EXPECT_EQ(3, mailbox.getNumberOfPublishedValues());
+    EXPECT_EQ(2, mailbox.getNumberOfOverwrittenValues());
+    EXPECT_EQ(nullptr, mailbox.getNewValue());
+
+    mailbox.publish(4);
+
+    ASSERT_NE(nullptr, mailbox.getNewValue());
+    EXPECT_EQ(4, mailbox.getSequenceNumberOfLastValue());
+    EXPECT_EQ(2, mailbox.getNumberOfOverwrittenValues());
+}
+
+TEST(LatestValueMailboxTests, waitingEndsOnNewValueTimeoutOrStop)
+{
+    LatestValueMailbox<int> mailbox;
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    EXPECT_FALSE(mailbox.waitForNewValue(std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - startTime, std::chrono::milliseconds(20));
+
+    std::thread producer([&mailbox](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        mailbox.publish(1);
+    });
+
+    EXPECT_TRUE(mailbox.waitForNewValue(std::chrono::seconds(5)));
+    producer.join();
+
+    ASSERT_NE(nullptr, mailbox.getNewValue());
+
+    mailbox.stop();
+
+    EXPECT_TRUE(mailbox.waitForNewValue(std::chrono::seconds(5)));
+    EXPECT_EQ(nullptr, mailbox.getNewValue());
+}
+
+TEST(LatestValueMailboxTests, consumerNeverSeesPartiallyWrittenValue)
+{
+    LatestValueMailbox<std::vector<uint32_t>> mailbox;
+    const uint32_t numberOfValues{20000};
+
+    std::thread producer([&mailbox, numberOfValues](){
+        for(uint32_t i=1; i<=numberOfValues; ++i)
+        {
+            mailbox.publish(std::vector<uint32_t>(64, i));
+        }
+        mailbox.stop();
+    });
+
+    uint64_t previousSequenceNumber{0};
+
+    while(previousSequenceNumber < numberOfValues)
+    {
+        const auto value = mailbox.getNewValue();
+
+        if(value == nullptr)
+        {
+            mailbox.waitForNewValue(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        const auto sequenceNumber = mailbox.getSequenceNumberOfLastValue();
+
+        ASSERT_GT(sequenceNumber, previousSequenceNumber);
+        ASSERT_EQ(std::vector<uint32_t>(64, sequenceNumber), *value);
+        previousSequenceNumber = sequenceNumber;
+    }
+
+    producer.join();
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/gpu/LinesInsideGpu.hpp"
+#include "helpers/OpenGlMock.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+
+class LinesInsideGpuTests : public ::testing::Test
+{
+public:
+    NiceMock<OpenGlMock> openGL;
+    const std::vector<std::vector<float>> colors{{1, 0, 0, 1}, {0, 1, 0, 1}, {0, 0, 1, 1}};
+    const uint32_t verticesPerLine{2};
+
+    std::string getVertexShader()
+    {
+        std::string vertexShader;
+
+        EXPECT_CALL(openGL, glCreateShaderProgramv(GL_FRAGMENT_SHADER, 1, _)).Times(1);
+        EXPECT_CALL(openGL, glCreateShaderProgramv(GL_VERTEX_SHADER, 1, _)).WillOnce([&vertexShader](GLenum, GLsizei, const GLchar *const* strings)
+        {
+            vertexShader = strings[0];
+            return 1;
+        });
+
+        LinesInsideGpu::initialize();
+        return vertexShader;
+    }
+};
+
+TEST_F(LinesInsideGpuTests, everyLayerStartsAtVertexTakenByShaderForBeginningOfLine)
+{
+    LinesInsideGpu lines({{2, colors.at(0)}, {1, colors.at(1)}, {3, colors.at(2)}});
+
+    // the shader takes the end of a line from the vertex within the line
+    EXPECT_NE(std::string::npos, getVertexShader().find("int end = gl_VertexID % 2;"));
+
+    EXPECT_CALL(openGL, glMultiDrawArraysIndirect(GL_LINES, _, colors.size(), 0)).WillOnce([this](GLenum, const void *indirect, GLsizei, GLsizei)
+    {
+        const auto *commands = static_cast<const DrawArraysIndirectCommand*>(openGL.getCommandsOfBoundIndirectBuffer(indirect));
+
+        for(uint32_t layer=0; layer<colors.size(); ++layer)
+        {
+            EXPECT_EQ(verticesPerLine, commands[layer].count);
+            EXPECT_EQ(0, commands[layer].first % verticesPerLine);
+
+            // vertices are read with the same indexes as instances, colors are bound at binding 0
+            const auto *color = static_cast<const float*>(openGL.getInstancesOfBoundVertexArray(0, commands[layer].first));
+            EXPECT_EQ(colors.at(layer), std::vector<float>(color, color + 4));
+        }
+    });
+
+    const Line line{{10, 10}, {20, 20}};
+    lines.draw({Lines(2, line), Lines(1, line), Lines(3, line)});
+}
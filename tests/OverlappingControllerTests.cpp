@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/OverlappingController.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+
+class OverlappingControllerTests : public ::testing::Test
+{
+public:
+    static constexpr uint32_t samplingRate{48000};
+    static constexpr uint32_t numberOfSamples{8192};
+    static constexpr uint32_t desiredFrameRate{60};
+
+    static float getFrameRate(float overlapping)
+    {
+        return samplingRate / (numberOfSamples * (1 - overlapping));
+    }
+
+    // spectra are produced at the demanded rate and one of them is taken for every displayed frame,
+    // the drafter waits for vsync, so drawing a frame takes the whole period of the display
+    void displayFrames(OverlappingController &controller, float displayFrameRate, uint32_t numberOfFrames)
+    {
+        const auto timeBetweenFrames = duration_cast<steady_clock::duration>(duration<float>(1 / displayFrameRate));
+
+        for(uint32_t i=0; i<numberOfFrames; ++i)
+        {
+            swapTime += timeBetweenFrames;
+            queueDepth = std::max(queueDepth + getFrameRate(controller.getState().overlapping) / displayFrameRate - 1, 0.0f);
+            controller.update(FrameSwap{swapTime, timeBetweenFrames}, std::lround(queueDepth));
+        }
+    }
+
+    time_point<steady_clock> swapTime{steady_clock::now()};
+    float queueDepth{0};
+};
+
+TEST_F(OverlappingControllerTests, emptyQueueKeepsDesiredFrameRateWithoutWindup)
+{
+    OverlappingController controller(FlowControl{4, 20, 10, 0, 1}, samplingRate, numberOfSamples, desiredFrameRate);
+
+    for(int i=1; i<=100; ++i)
+    {
+        EXPECT_EQ(std::nullopt, controller.update(FrameSwap{swapTime + i * 16ms, 5ms}, 0));
+    }
+
+    EXPECT_TRUE(controller.getState().saturated);
+    EXPECT_EQ(0, controller.getState().integral);
+    EXPECT_FLOAT_EQ(desiredFrameRate, controller.getState().demandedFrameRate);
+    EXPECT_NEAR(62.5, controller.getState().measuredFrameRate, 0.1);
+}
+
+TEST_F(OverlappingControllerTests, slowDisplayIsFollowedAndQueueIsKeptNearTarget)
+{
+    OverlappingController controller(FlowControl{4, 20, 10, 0, 1}, samplingRate, numberOfSamples, desiredFrameRate);
+
+    displayFrames(controller, 30, 300);
+
+    EXPECT_NEAR(30, controller.getState().demandedFrameRate, 3);
+    EXPECT_NEAR(1, queueDepth, 1);
+
+    // the display keeps up again, the desired rate is reached within a few frames
+    displayFrames(controller, 120, 20);
+
+    EXPECT_NEAR(desiredFrameRate, getFrameRate(controller.getState().overlapping), 1);
+    EXPECT_NEAR(0, queueDepth, 1);
+}
+
+TEST_F(OverlappingControllerTests, integralIsFrozenWhileRateIsLimited)
+{
+    OverlappingController controller(FlowControl{4, 20, 10, 0, 1}, samplingRate, numberOfSamples, desiredFrameRate);
+
+    for(int i=1; i<=500; ++i)
+    {
+        controller.update(FrameSwap{swapTime + i * 16ms, 16ms}, 20);
+    }
+
+    const auto state = controller.getState();
+
+    EXPECT_TRUE(state.saturated);
+    EXPECT_FLOAT_EQ(static_cast<float>(samplingRate) / numberOfSamples, state.demandedFrameRate);
+    EXPECT_EQ(0, state.overlapping);
+    EXPECT_EQ(0, state.integral);
+}
+
+TEST_F(OverlappingControllerTests, smallChangesAreFilteredOutByHysteresis)
+{
+    OverlappingController controllerWithHysteresis(FlowControl{4, 0, 0, 0.01, 1}, samplingRate, numberOfSamples, desiredFrameRate);
+    OverlappingController controllerWithoutHysteresis(FlowControl{4, 0, 0, 0, 1}, samplingRate, numberOfSamples, desiredFrameRate);
+
+    EXPECT_EQ(std::nullopt, controllerWithHysteresis.update(FrameSwap{swapTime, {}}, 2));
+
+    const auto overlapping = controllerWithoutHysteresis.update(FrameSwap{swapTime, {}}, 2);
+
+    ASSERT_NE(std::nullopt, overlapping);
+    EXPECT_NEAR(56, getFrameRate(*overlapping), 0.01);
+    EXPECT_FLOAT_EQ(56, controllerWithoutHysteresis.getState().demandedFrameRate);
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/QualityGovernor.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+
+class QualityGovernorTests : public ::testing::Test
+{
+public:
+    const QualityControl settings{true, 85, 40, 4, 5};
+    const PipelineLoad overload{"fftCalculator", 95, 0, 0};
+    const PipelineLoad normalLoad{"fftCalculator", 60, 0, 0};
+    const PipelineLoad lowLoad{"fftCalculator", 20, 0, 0};
+
+    // checks are done once per second like in the flowController
+    std::optional<QualityTransition> check(QualityGovernor &governor, const PipelineLoad &load)
+    {
+        now += 1s;
+        return governor.update(load, now);
+    }
+
+    time_point<steady_clock> now{steady_clock::now()};
+};
+
+TEST_F(QualityGovernorTests, qualityIsLoweredStepByStepAfterTwoOverloadedChecks)
+{
+    QualityGovernor governor(settings);
+
+    for(const auto level : {QualityLevel::FewerWelchSegments, QualityLevel::SmallerFftSize, QualityLevel::MergedBars, QualityLevel::SkippedExpensiveLayers})
+    {
+        EXPECT_EQ(std::nullopt, check(governor, overload));
+
+        const auto transition = check(governor, overload);
+
+        ASSERT_NE(std::nullopt, transition);
+        EXPECT_EQ(level, transition->level);
+        EXPECT_EQ(level, governor.getLevel());
+        EXPECT_EQ("fftCalculator busy 95% of the time", transition->reason);
+    }
+
+    EXPECT_EQ(std::nullopt, check(governor, overload));
+    EXPECT_EQ(std::nullopt, check(governor, overload));
+    EXPECT_EQ(QualityLevel::SkippedExpensiveLayers, governor.getLevel());
+
+    EXPECT_EQ(4096, getFftSize(governor.getLevel(), 8192));
+    EXPECT_FLOAT_EQ(30, getMaxFrameRate(governor.getLevel(), 60));
+    EXPECT_EQ(2, getNumberOfMergedBars(governor.getLevel()));
+    EXPECT_TRUE(areExpensiveLayersSkipped(governor.getLevel()));
+    EXPECT_EQ(8192, getFftSize(QualityLevel::FewerWelchSegments, 8192));
+    EXPECT_EQ(1, getNumberOfMergedBars(QualityLevel::SmallerFftSize));
+}
+
+TEST_F(QualityGovernorTests, overloadHasToLastTwoChecksUnlessValuesAreDropped)
+{
+    QualityGovernor governor(settings);
+
+    EXPECT_EQ(std::nullopt, check(governor, overload));
+    EXPECT_EQ(std::nullopt, check(governor, normalLoad));
+    EXPECT_EQ(std::nullopt, check(governor, PipelineLoad{"processing", 10, 5, 0}));
+    EXPECT_EQ(std::nullopt, check(governor, normalLoad));
+
+    const auto transition = check(governor, PipelineLoad{"processing", 10, 0, 3});
+
+    ASSERT_NE(std::nullopt, transition);
+    EXPECT_EQ(QualityLevel::FewerWelchSegments, transition->level);
+    EXPECT_EQ("3 values dropped by overflowing queues", transition->reason);
+
+    std::ostringstream os;
+    os<<*transition;
+    EXPECT_EQ("quality lowered: 0 (full quality) -> 1 (fewer Welch segments), 3 values dropped by overflowing queues", os.str());
+}
+
+TEST_F(QualityGovernorTests, qualityIsRestoredAfterHeadroomLastsForRestoreDelay)
+{
+    QualityGovernor governor(settings);
+
+    check(governor, overload);
+    check(governor, overload);
+    ASSERT_EQ(QualityLevel::FewerWelchSegments, governor.getLevel());
+
+    for(int i=0; i<4; ++i)
+    {
+        EXPECT_EQ(std::nullopt, check(governor, lowLoad));
+    }
+
+    // load between the restore threshold and the budget starts the waiting again
+    EXPECT_EQ(std::nullopt, check(governor, normalLoad));
+
+    for(int i=0; i<5; ++i)
+    {
+        EXPECT_EQ(std::nullopt, check(governor, lowLoad));
+    }
+
+    const auto transition = check(governor, lowLoad);
+
+    ASSERT_NE(std::nullopt, transition);
+    EXPECT_EQ(QualityLevel::Full, transition->level);
+    EXPECT_EQ("fftCalculator busy below 40% of the time for 5 s", transition->reason);
+    EXPECT_EQ(std::nullopt, check(governor, lowLoad));
+}
+
+TEST_F(QualityGovernorTests, restoreDelayGrowsWhenRestoredQualityCannotBeKept)
+{
+    QualityGovernor governor(settings);
+
+    auto lowerAndRestore = [&](uint32_t expectedRestoreDelayInSeconds)
+    {
+        check(governor, overload);
+        ASSERT_NE(std::nullopt, check(governor, overload));
+
+        check(governor, lowLoad);
+
+        for(uint32_t i=1; i<expectedRestoreDelayInSeconds; ++i)
+        {
+            ASSERT_EQ(std::nullopt, check(governor, lowLoad));
+        }
+
+        ASSERT_NE(std::nullopt, check(governor, lowLoad));
+        ASSERT_EQ(QualityLevel::Full, governor.getLevel());
+    };
+
+    lowerAndRestore(5);
+    lowerAndRestore(10);
+    lowerAndRestore(20);
+    lowerAndRestore(40);
+    lowerAndRestore(40);
+}
+
+TEST_F(QualityGovernorTests, disabledGovernorKeepsFullQuality)
+{
+    QualityGovernor governor(QualityControl{false, 85, 40, 4, 5});
+
+    for(int i=0; i<10; ++i)
+    {
+        EXPECT_EQ(std::nullopt, check(governor, PipelineLoad{"fftCalculator", 100, 100, 100}));
+    }
+
+    EXPECT_EQ(QualityLevel::Full, governor.getLevel());
+}
+
+TEST(PipelineLoadMeterTests, busiestStageIsFoundFromProcessingTimes)
+{
+    Metrics::clear();
+
+    const auto fftCalculatorMetrics = Metrics::registerStage("fftCalculator");
+    const auto firstOperationMetrics = Metrics::registerStage("drawing/first");
+    const auto secondOperationMetrics = Metrics::registerStage("drawing/second");
+    const auto now = steady_clock::now();
+
+    PipelineLoadMeter pipelineLoadMeter({{"fftCalculator", fftCalculatorMetrics}});
+
+    fftCalculatorMetrics->recordProcessingTime(100ms);
+
+    const auto startingLoad = pipelineLoadMeter.measure(1, 7, now);
+
+    EXPECT_EQ(0, startingLoad.cpuLoadInPercents);
+    EXPECT_EQ(0, startingLoad.numberOfDroppedValues);
+
+    fftCalculatorMetrics->recordProcessingTime(400ms);
+    firstOperationMetrics->recordProcessingTime(300ms);
+    secondOperationMetrics->recordProcessingTime(200ms);
+
+    const auto load = pipelineLoadMeter.measure(2, 10, now + 1s);
+
+    EXPECT_EQ("drawing", load.busiestStage);
+    EXPECT_FLOAT_EQ(50, load.cpuLoadInPercents);
+    EXPECT_EQ(2, load.queueDepth);
+    EXPECT_EQ(3, load.numberOfDroppedValues);
+
+    fftCalculatorMetrics->recordProcessingTime(900ms);
+
+    const auto nextLoad = pipelineLoadMeter.measure(0, 10, now + 3s);
+
+    EXPECT_EQ("fftCalculator", nextLoad.busiestStage);
+    EXPECT_FLOAT_EQ(45, nextLoad.cpuLoadInPercents);
+    EXPECT_EQ(0, nextLoad.numberOfDroppedValues);
+
+    Metrics::clear();
+}
@@ -35,3 +35,83 @@ TEST_F(PythonDataSourceTests, pythonDataSourceTest)
     valueChecker(expectedLeftSignal, stereoData.left);
     valueChecker(expectedRightSignal, stereoData.right);
 }
+
+TEST_F(PythonDataSourceTests, interleavedBufferIsDeinterleaved)
+{
+    const uint32_t numberOfSamples{1024};
+    const float samplingFrequency{48000};
+
+    const auto expectedLeftSignal = generateSignal(numberOfSamples, 16, 1, 32767);
+
+    PythonDataSource pythonDataSource("testBufferAudioConfig");
+    pythonDataSource.initialize(numberOfSamples, samplingFrequency);
+    auto stereoData = pythonDataSource.collectStereoDataFromHw();
+
+    ASSERT_FALSE(pythonDataSource.checkIfErrorOccured());
+    ASSERT_EQ(stereoData.left.size(), numberOfSamples);
+    ASSERT_EQ(stereoData.right.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_NEAR(stereoData.left[i], expectedLeftSignal[i], 2);
+        EXPECT_NEAR(stereoData.right[i], -0.5 * expectedLeftSignal[i], 2);
+    }
+}
+
+TEST_F(PythonDataSourceTests, planarBuffersAreCopied)
+{
+    const uint32_t numberOfSamples{1024};
+    const float samplingFrequency{44100};
+
+    const auto expectedLeftSignal = generateSignal(numberOfSamples, 16, 1, 32767);
+
+    PythonDataSource pythonDataSource("testBufferAudioConfig");
+    pythonDataSource.initialize(numberOfSamples, samplingFrequency);
+    auto stereoData = pythonDataSource.collectStereoDataFromHw();
+
+    ASSERT_FALSE(pythonDataSource.checkIfErrorOccured());
+    ASSERT_EQ(stereoData.left.size(), numberOfSamples);
+    ASSERT_EQ(stereoData.right.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_NEAR(stereoData.left[i], expectedLeftSignal[i], 2);
+        EXPECT_NEAR(stereoData.right[i], -0.5 * expectedLeftSignal[i], 2);
+    }
+}
+
+TEST_F(PythonDataSourceTests, bytesAreTakenAsInt16Samples)
+{
+    const uint32_t numberOfSamples{1024};
+    const float samplingFrequency{16000};
+
+    const auto expectedLeftSignal = generateSignal(numberOfSamples, 16, 1, 32767);
+
+    PythonDataSource pythonDataSource("testBufferAudioConfig");
+    pythonDataSource.initialize(numberOfSamples, samplingFrequency);
+    auto stereoData = pythonDataSource.collectStereoDataFromHw();
+
+    ASSERT_FALSE(pythonDataSource.checkIfErrorOccured());
+    ASSERT_EQ(stereoData.left.size(), numberOfSamples);
+    ASSERT_EQ(stereoData.right.size(), numberOfSamples);
+
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_NEAR(stereoData.left[i], expectedLeftSignal[i], 2);
+        EXPECT_NEAR(stereoData.right[i], -0.5 * expectedLeftSignal[i], 2);
+    }
+}
+
+TEST_F(PythonDataSourceTests, int8SamplesAreRejected)
+{
+    const uint32_t numberOfSamples{1024};
+    const float samplingFrequency{8000};
+
+    PythonDataSource pythonDataSource("testBufferAudioConfig");
+    pythonDataSource.initialize(numberOfSamples, samplingFrequency);
+    auto stereoData = pythonDataSource.collectStereoDataFromHw();
+
+    EXPECT_TRUE(pythonDataSource.checkIfErrorOccured());
+    EXPECT_TRUE(stereoData.left.empty());
+    EXPECT_TRUE(stereoData.right.empty());
+}
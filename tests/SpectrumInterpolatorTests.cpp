@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/SpectrumInterpolator.hpp"
+#include <gtest/gtest.h>
+
+
+TEST(SpectrumInterpolatorTests, firstSpectrumIsReturnedAsIs)
+{
+    SpectrumInterpolator interpolator;
+    const auto now = steady_clock::now();
+
+    EXPECT_TRUE(interpolator.isEmpty());
+
+    interpolator.push({-10, -20}, now, now);
+
+    EXPECT_FALSE(interpolator.isEmpty());
+    EXPECT_EQ((std::vector<float>{-10, -20}), interpolator.get(now + 1s));
+}
+
+TEST(SpectrumInterpolatorTests, spectraAreBlendedOverTimeBetweenCaptures)
+{
+    SpectrumInterpolator interpolator;
+    const auto captureTime = steady_clock::now();
+    const auto arrivalTime = captureTime + 5ms;
+
+    interpolator.push({-40, -20}, captureTime, arrivalTime);
+    interpolator.push({-20, -60}, captureTime + 20ms, arrivalTime + 20ms);
+
+    EXPECT_EQ((std::vector<float>{-40, -20}), interpolator.get(arrivalTime + 20ms));
+    EXPECT_EQ((std::vector<float>{-30, -40}), interpolator.get(arrivalTime + 30ms));
+    EXPECT_EQ((std::vector<float>{-20, -60}), interpolator.get(arrivalTime + 40ms));
+    EXPECT_EQ((std::vector<float>{-20, -60}), interpolator.get(arrivalTime + 100ms));
+
+    // a spectrum arriving in the middle of the blend continues from what is on the screen
+    interpolator.push({0, 0}, captureTime + 40ms, arrivalTime + 30ms);
+
+    EXPECT_EQ((std::vector<float>{-30, -40}), interpolator.get(arrivalTime + 30ms));
+    EXPECT_EQ((std::vector<float>{-15, -20}), interpolator.get(arrivalTime + 40ms));
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/gpu/StaticLayerCache.hpp"
+#include "helpers/OpenGlMock.hpp"
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Pointee;
+
+
+class StaticLayerCacheTests : public ::testing::Test
+{
+public:
+    NiceMock<OpenGlMock> openGL;
+    const WindowSize windowSize{1024, 768};
+    const WindowSize resizedWindowSize{800, 600};
+};
+
+TEST_F(StaticLayerCacheTests, textureIsCreatedAgainOnlyWhenSizeOfWindowChanges)
+{
+    StaticLayerCache cache;
+
+    EXPECT_FALSE(cache.isValid(windowSize));
+
+    EXPECT_CALL(openGL, glTextureStorage2D(_, 1, GL_RGBA8, windowSize.x, windowSize.y)).Times(1);
+    EXPECT_CALL(openGL, glDeleteTextures(_,_)).Times(0);
+
+    cache.startRendering(windowSize);
+    EXPECT_FALSE(cache.isValid(windowSize));
+    cache.finishRendering();
+
+    EXPECT_TRUE(cache.isValid(windowSize));
+    EXPECT_FALSE(cache.isValid(resizedWindowSize));
+
+    cache.startRendering(windowSize);
+    cache.finishRendering();
+
+    EXPECT_CALL(openGL, glDeleteTextures(1, Pointee(1))).Times(1);
+    EXPECT_CALL(openGL, glDeleteFramebuffers(1, Pointee(1))).Times(1);
+    EXPECT_CALL(openGL, glTextureStorage2D(2, 1, GL_RGBA8, resizedWindowSize.x, resizedWindowSize.y)).Times(1);
+
+    cache.startRendering(resizedWindowSize);
+    cache.finishRendering();
+
+    EXPECT_TRUE(cache.isValid(resizedWindowSize));
+    EXPECT_FALSE(cache.isValid(windowSize));
+
+    EXPECT_CALL(openGL, glDeleteTextures(1, Pointee(2))).Times(1);
+    EXPECT_CALL(openGL, glDeleteFramebuffers(1, Pointee(2))).Times(1);
+}
+
+TEST_F(StaticLayerCacheTests, cachedLayersAreDrawnWithOneTriangleCoveringScreen)
+{
+    StaticLayerCache::initialize();
+    StaticLayerCache cache;
+
+    cache.startRendering(windowSize);
+    cache.finishRendering();
+
+    EXPECT_CALL(openGL, glBindTextureUnit(0, 1)).Times(1);
+    EXPECT_CALL(openGL, glDrawArrays(GL_TRIANGLES, 0, 3)).Times(1);
+
+    cache.draw();
+
+    StaticLayerCache::finalize();
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -17,22 +17,22 @@ public:
     void firstThread()
     {
         const std::string processName{"firstThread"};
-        StatsManager statsManager(processName);
+        const auto stageMetrics = Metrics::registerStage(processName);
 
         for(int i=0;i<numberOfCalls; ++i)
         {
-            statsManager.update();
+            stageMetrics->update();
         }
     }
 
     void secondThread()
     {
         const std::string processName{"secondThread"};
-        StatsManager statsManager(processName);
+        const auto stageMetrics = Metrics::registerStage(processName);
 
         for(int i=0;i<numberOfCalls; ++i)
         {
-            statsManager.update();
+            stageMetrics->update();
         }
     }
 
@@ -47,8 +47,9 @@ TEST_F(StatsTests, concurrencyCheck)
     thread1.join();
     thread2.join();
 
-    EXPECT_EQ(numberOfCalls, StatsManager::getStatsFor("firstThread").getNumberOfCallsInLast(3000ms));
-    EXPECT_EQ(numberOfCalls, StatsManager::getStatsFor("secondThread").getNumberOfCallsInLast(3000ms));
+    EXPECT_EQ(numberOfCalls, Metrics::registerStage("firstThread")->getNumberOfCallsInLast(3000ms));
+    EXPECT_EQ(numberOfCalls, Metrics::registerStage("secondThread")->getNumberOfCallsInLast(3000ms));
+    EXPECT_EQ(numberOfCalls, Metrics::registerStage("firstThread")->getNumberOfCalls());
 }
 
 TEST_F(StatsTests, checkNumberOfCallsInLastTime)
@@ -57,21 +58,118 @@ TEST_F(StatsTests, checkNumberOfCallsInLastTime)
     const int nextNumberOfCalls{754};
 
     const std::string processName{"test"};
-    StatsManager statsManager(processName);
+    const auto stageMetrics = Metrics::registerStage(processName);
 
     for(int i=0;i<numberOfCalls; ++i)
     {
-        statsManager.update();
+        stageMetrics->update();
     }
 
-    EXPECT_EQ(numberOfCalls, StatsManager::getStatsFor("test").getNumberOfCallsInLast(1000ms));
+    EXPECT_EQ(numberOfCalls, stageMetrics->getNumberOfCallsInLast(1000ms));
 
     std::this_thread::sleep_for(1001ms);
 
     for(int i=0;i<nextNumberOfCalls; ++i)
     {
-        statsManager.update();
+        stageMetrics->update();
     }
 
-    EXPECT_EQ(nextNumberOfCalls, StatsManager::getStatsFor("test").getNumberOfCallsInLast(1000ms));
+    EXPECT_EQ(nextNumberOfCalls, stageMetrics->getNumberOfCallsInLast(1000ms));
+    EXPECT_EQ(numberOfCalls + nextNumberOfCalls, stageMetrics->getNumberOfCallsInLast(3000ms));
+}
+
+TEST_F(StatsTests, checkInterArrivalTimes)
+{
+    const int numberOfCalls{50};
+    const auto interval{2ms};
+
+    const auto stageMetrics = Metrics::registerStage("intervalTest");
+
+    EXPECT_EQ(0, LatencyHistogram::summarize(stageMetrics->getInterArrivalTimes()).count);
+
+    for(int i=0;i<numberOfCalls; ++i)
+    {
+        stageMetrics->update();
+        std::this_thread::sleep_for(interval);
+    }
+
+    const auto summary = LatencyHistogram::summarize(stageMetrics->getInterArrivalTimes());
+
+    EXPECT_EQ(numberOfCalls - 1, summary.count);
+    EXPECT_GE(summary.p50, interval);
+    EXPECT_LT(summary.p50, 10 * interval);
+    EXPECT_GE(summary.p99, summary.p50);
+    EXPECT_GE(summary.max, summary.p99);
+}
+
+TEST_F(StatsTests, checkProcessingTimes)
+{
+    const auto stageMetrics = Metrics::registerStage("processingTest");
+
+    for(int i=0;i<10; ++i)
+    {
+        const auto processingScope = stageMetrics->startProcessing();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    const auto firstSnapshot = stageMetrics->getProcessingTimes();
+
+    {
+        const auto processingScope = stageMetrics->startProcessing();
+        std::this_thread::sleep_for(20ms);
+    }
+
+    const auto summary = LatencyHistogram::summarize(stageMetrics->getProcessingTimes(), firstSnapshot);
+
+    EXPECT_EQ(11, stageMetrics->getNumberOfCalls());
+    EXPECT_EQ(1, summary.count);
+    EXPECT_GE(summary.p50, 20ms);
+    EXPECT_EQ(summary.p50, summary.max);
+}
+
+TEST_F(StatsTests, checkLatencies)
+{
+    const auto stageMetrics = Metrics::registerStage("latencyTest");
+
+    stageMetrics->recordLatency(steady_clock::now() - 30ms);
+    stageMetrics->recordLatency(time_point<steady_clock>{});
+
+    const auto summary = LatencyHistogram::summarize(stageMetrics->getLatencies());
+
+    EXPECT_EQ(1, summary.count);
+    EXPECT_GE(summary.p50, 30ms);
+    EXPECT_LT(summary.p50, 100ms);
+}
+
+TEST_F(StatsTests, histogramBucketsAreLogLinear)
+{
+    for(uint64_t value : {0, 1, 15, 16, 17, 100, 1000, 12345, 999999, 100000000})
+    {
+        const auto index = LatencyHistogram::getBucketIndex(value);
+        const auto upperBound = LatencyHistogram::getBucketUpperBound(index);
+
+        EXPECT_GE(upperBound, value);
+        EXPECT_LE(upperBound - value, value / LatencyHistogram::numberOfSubBuckets);
+
+        if(index > 0)
+        {
+            EXPECT_LT(LatencyHistogram::getBucketUpperBound(index - 1), value);
+        }
+    }
+
+    EXPECT_EQ(LatencyHistogram::numberOfBuckets - 1, LatencyHistogram::getBucketIndex(UINT64_MAX));
+
+    LatencyHistogram histogram;
+
+    for(int i=1; i<=100; ++i)
+    {
+        histogram.record(microseconds(i));
+    }
+
+    const auto summary = LatencyHistogram::summarize(histogram.getSnapshot());
+
+    EXPECT_EQ(100, summary.count);
+    EXPECT_NEAR(50, summary.p50.count(), 50 / LatencyHistogram::numberOfSubBuckets);
+    EXPECT_NEAR(99, summary.p99.count(), 99 / LatencyHistogram::numberOfSubBuckets);
+    EXPECT_NEAR(100, summary.max.count(), 100 / LatencyHistogram::numberOfSubBuckets);
 }
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/dataSource/StreamDataSource.hpp"
+#include "core/CommonData.hpp"
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <filesystem>
+#include <thread>
+#include <cstring>
+
+class StreamDataSourceTests : public ::testing::Test
+{
+public:
+
+    ~StreamDataSourceTests()
+    {
+        if(writer >= 0)
+        {
+            close(writer);
+        }
+        std::filesystem::remove(path);
+    }
+
+    void openFifoWriter()
+    {
+        writer = open(path.c_str(), O_WRONLY);
+        ASSERT_GE(writer, 0);
+    }
+
+    void connectToSocket()
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+        writer = socket(AF_UNIX, SOCK_STREAM, 0);
+        ASSERT_GE(writer, 0);
+        ASSERT_EQ(connect(writer, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+    }
+
+    template<typename T>
+    void send(const std::vector<T> &samples)
+    {
+        const auto *data = reinterpret_cast<const uint8_t*>(samples.data());
+        size_t numberOfBytes = samples.size() * sizeof(T);
+
+        while(numberOfBytes > 0)
+        {
+            const auto written = write(writer, data, numberOfBytes);
+            ASSERT_GT(written, 0);
+            data += written;
+            numberOfBytes -= written;
+        }
+    }
+
+    StereoData collect(StreamDataSource &dataSource)
+    {
+        for(int i=0; i<50; ++i)
+        {
+            auto data = dataSource.collectStereoDataFromHw();
+
+            if(!data.left.empty())
+            {
+                return data;
+            }
+        }
+        return {};
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "streamDataSourceTest").string();
+    const uint32_t samplingRate{48000};
+    const uint32_t numberOfSamples{64};
+    const float precision{0.01};
+    int writer{-1};
+};
+
+TEST_F(StreamDataSourceTests, readsInterleavedStereoInt16FromFifo)
+{
+    std::filesystem::remove(path);
+    ASSERT_EQ(mkfifo(path.c_str(), 0600), 0);
+
+    StreamDataSource dataSource(path, PcmFormat{SampleFormat::Int16, 2});
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+    openFifoWriter();
+
+    std::vector<int16_t> samples;
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        samples.push_back(static_cast<int16_t>(i * 256));
+        samples.push_back(static_cast<int16_t>(-static_cast<int>(i) * 256));
+    }
+    send(samples);
+
+    const auto data = collect(dataSource);
+
+    ASSERT_EQ(data.left.size(), numberOfSamples);
+    for(uint32_t i=0; i<numberOfSamples; ++i)
+    {
+        EXPECT_NEAR(data.left[i], i * 256 / 32768.0f * getFullScaleAmplitude(), 1.0);
+        EXPECT_NEAR(data.right[i], -(i * 256 / 32768.0f * getFullScaleAmplitude()), 1.0);
+    }
+}
+
+TEST_F(StreamDataSourceTests, readsMonoFloatFromUnixSocketAndAcceptsNextWriter)
+{
+    StreamDataSource dataSource("unix:" + path, PcmFormat{SampleFormat::Float32, 1});
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+
+    for(float value : {0.25f, -0.5f})
+    {
+        connectToSocket();
+        send(std::vector<float>(numberOfSamples, value));
+
+        const auto data = collect(dataSource);
+
+        ASSERT_EQ(data.left.size(), numberOfSamples);
+        EXPECT_NEAR(data.left.front(), value * getFullScaleAmplitude(), precision);
+        EXPECT_NEAR(data.right.back(), value * getFullScaleAmplitude(), precision);
+
+        close(writer);
+        writer = -1;
+    }
+}
+
+TEST_F(StreamDataSourceTests, countsUnderrunWhenWriterIsLate)
+{
+    std::filesystem::remove(path);
+    ASSERT_EQ(mkfifo(path.c_str(), 0600), 0);
+
+    StreamDataSource dataSource(path, PcmFormat{SampleFormat::Int16, 2});
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+
+    EXPECT_TRUE(dataSource.collectStereoDataFromHw().left.empty());
+    EXPECT_EQ(dataSource.getNumberOfUnderruns(), 1);
+    EXPECT_EQ(dataSource.getNumberOfOverruns(), 0);
+}
+
+TEST_F(StreamDataSourceTests, dropsWholeFramesWhenRingIsFull)
+{
+    std::filesystem::remove(path);
+    ASSERT_EQ(mkfifo(path.c_str(), 0600), 0);
+
+    // 3 bytes per frame never divides the power of two ring, so the overrun starts inside a frame
+    StreamDataSource dataSource(path, PcmFormat{SampleFormat::Int24, 1});
+    ASSERT_TRUE(dataSource.initialize(numberOfSamples, samplingRate));
+    openFifoWriter();
+
+    const size_t numberOfFrames = 4 * samplingRate;
+    std::vector<uint8_t> samples;
+    for(size_t i=0; i<numberOfFrames; ++i)
+    {
+        samples.insert(samples.end(), {0x00, 0x00, 0x20});
+    }
+    send(samples);
+
+    for(int i=0; (i<100) && (dataSource.getNumberOfOverruns() == 0); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_GT(dataSource.getNumberOfOverruns(), 0);
+
+    for(int i=0; i<8; ++i)
+    {
+        const auto data = collect(dataSource);
+
+        ASSERT_EQ(data.left.size(), numberOfSamples);
+        for(const auto sample : data.left)
+        {
+            ASSERT_NEAR(sample, 0.25f * getFullScaleAmplitude(), precision);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/gpu/TextLayout.hpp"
+#include <gtest/gtest.h>
+
+
+class TextLayoutTests : public ::testing::Test
+{
+public:
+    const float glyphHeight{17};
+
+    // characters from ' ' to 'c', ' ' is not drawable and 'b' is not supported
+    FontMetrics getFont()
+    {
+        FontMetrics font{' ', glyphHeight, std::vector<FontMetrics::Glyph>('c' - ' ' + 1, FontMetrics::Glyph{false, false, 0, 0, 0, 0, 0})};
+
+        font.glyphs.at(' ' - ' ') = FontMetrics::Glyph{true, false, 4, 0, 0, 0, 0};
+        font.glyphs.at('a' - ' ') = FontMetrics::Glyph{true, true, 5, 0.1f, 0.2f, 0.3f, 0.4f};
+        font.glyphs.at('b' - ' ') = FontMetrics::Glyph{false, true, 6, 0, 0, 0, 0};
+        font.glyphs.at('c' - ' ') = FontMetrics::Glyph{true, true, 7, 0.5f, 0.6f, 0.7f, 0.8f};
+
+        return font;
+    }
+};
+
+TEST_F(TextLayoutTests, glyphsOfLineArePlacedOneAfterAnother)
+{
+    const auto layout = layOutText("ac", getFont());
+
+    ASSERT_EQ(2, layout.glyphs.size());
+    EXPECT_EQ(0, layout.glyphs.at(0).x);
+    EXPECT_EQ(5, layout.glyphs.at(1).x);
+    EXPECT_EQ(0, layout.glyphs.at(1).y);
+    EXPECT_EQ(7, layout.glyphs.at(1).width);
+    EXPECT_EQ(glyphHeight, layout.glyphs.at(1).height);
+    EXPECT_FLOAT_EQ(0.5f, layout.glyphs.at(1).u1);
+    EXPECT_FLOAT_EQ(0.8f, layout.glyphs.at(1).v2);
+
+    EXPECT_EQ(12, layout.width);
+    EXPECT_EQ(glyphHeight, layout.height);
+}
+
+TEST_F(TextLayoutTests, spacesMoveNextGlyphAndUnsupportedCharactersAreSkipped)
+{
+    const auto layout = layOutText("a bc{", getFont());
+
+    ASSERT_EQ(2, layout.glyphs.size());
+    EXPECT_EQ(0, layout.glyphs.at(0).x);
+    EXPECT_EQ(5 + 4, layout.glyphs.at(1).x);
+    EXPECT_EQ(5 + 4 + 7, layout.width);
+}
+
+TEST_F(TextLayoutTests, newLineStartsAtLeftEdgeBelowPreviousLine)
+{
+    const auto layout = layOutText("acc\na\r\nc", getFont());
+
+    ASSERT_EQ(5, layout.glyphs.size());
+    EXPECT_EQ(0, layout.glyphs.at(3).x);
+    EXPECT_EQ(glyphHeight, layout.glyphs.at(3).y);
+    EXPECT_EQ(0, layout.glyphs.at(4).x);
+    EXPECT_EQ(2 * glyphHeight, layout.glyphs.at(4).y);
+
+    // the widest line gives the width of the text
+    EXPECT_EQ(5 + 7 + 7, layout.width);
+    EXPECT_EQ(3 * glyphHeight, layout.height);
+}
+
+TEST_F(TextLayoutTests, carriageReturnMovesNextGlyphToLeftEdgeOfSameLine)
+{
+    const auto layout = layOutText("cc\ra", getFont());
+
+    ASSERT_EQ(3, layout.glyphs.size());
+    EXPECT_EQ(0, layout.glyphs.at(2).x);
+    EXPECT_EQ(0, layout.glyphs.at(2).y);
+    EXPECT_EQ(14, layout.width);
+    EXPECT_EQ(glyphHeight, layout.height);
+}
+
+TEST_F(TextLayoutTests, textIsAlignedAroundPointItIsDrawnAt)
+{
+    const auto layout = layOutText("cc\nc", getFont());
+
+    EXPECT_EQ(std::make_pair(0.0f, 0.0f), getAlignmentOffset(layout, HorizontalAligment::LEFT, VerticalAligment::TOP));
+    EXPECT_EQ(std::make_pair(-7.0f, -glyphHeight), getAlignmentOffset(layout, HorizontalAligment::CENTER, VerticalAligment::CENTER));
+    EXPECT_EQ(std::make_pair(-14.0f, -2 * glyphHeight), getAlignmentOffset(layout, HorizontalAligment::RIGHT, VerticalAligment::BOTTOM));
+}
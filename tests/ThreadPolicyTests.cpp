@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/ThreadPolicy.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+
+class ThreadPolicyTests : public ::testing::Test
+{
+public:
+
+    const ThreadSettingsPerStage settingsPerStage{
+        {0,{1, 70, 0, 1}},
+        {1,{2, 60}},
+        {2,{0, 0}},
+        {3,{7, 0}}
+    };
+};
+
+TEST_F(ThreadPolicyTests, checkParsingOfSettings)
+{
+    ThreadPolicy samplesUpdaterPolicy(settingsPerStage, PipelineStage::SamplesUpdater);
+    EXPECT_EQ(samplesUpdaterPolicy.getSettings().policy, SchedulingPolicy::Fifo);
+    EXPECT_EQ(samplesUpdaterPolicy.getSettings().priority, 70);
+    EXPECT_EQ(samplesUpdaterPolicy.getSettings().cpus, (std::vector<uint32_t>{0, 1}));
+
+    ThreadPolicy fftCalculatorPolicy(settingsPerStage, PipelineStage::FftCalculator);
+    EXPECT_EQ(fftCalculatorPolicy.getSettings().policy, SchedulingPolicy::RoundRobin);
+    EXPECT_EQ(fftCalculatorPolicy.getSettings().priority, 60);
+    EXPECT_TRUE(fftCalculatorPolicy.getSettings().cpus.empty());
+
+    ThreadPolicy drafterPolicy(settingsPerStage, PipelineStage::Drafter);
+    EXPECT_EQ(drafterPolicy.getSettings().policy, SchedulingPolicy::Default);
+
+    ThreadPolicy flowControllerPolicy(settingsPerStage, PipelineStage::FlowController);
+    EXPECT_EQ(flowControllerPolicy.getSettings().policy, SchedulingPolicy::Default);
+    EXPECT_TRUE(flowControllerPolicy.getSettings().cpus.empty());
+}
+
+TEST_F(ThreadPolicyTests, defaultPolicyIsAlwaysApplied)
+{
+    bool result{false};
+
+    std::thread thread([&](){
+        result = ThreadPolicy(settingsPerStage, PipelineStage::Processing).applyToCurrentThread("processing");
+    });
+    thread.join();
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(ThreadPolicyTests, affinityToFirstCpu)
+{
+    bool result{false};
+
+    std::thread thread([&](){
+        result = ThreadPolicy({{0,{0, 0, 0}}}, PipelineStage::SamplesUpdater).applyToCurrentThread("samplesUpdater");
+    });
+    thread.join();
+
+    EXPECT_TRUE(result);
+}
+
+TEST_F(ThreadPolicyTests, notExistingCpuFallsBackGracefully)
+{
+    bool result{true};
+    bool threadFinished{false};
+
+    std::thread thread([&](){
+        result = ThreadPolicy({{0,{0, 0, 4000}}}, PipelineStage::SamplesUpdater).applyToCurrentThread("samplesUpdater");
+        threadFinished = true;
+    });
+    thread.join();
+
+    EXPECT_FALSE(result);
+    EXPECT_TRUE(threadFinished);
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2024-2026, Sylwester Kominek
+ * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+ * see file LICENSE in this source tree.
+ */
+
+#include "core/Tracer.hpp"
+#include "core/Stats.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <atomic>
+
+
+class TracerTests : public ::testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        Tracer::clear();
+        Tracer::setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        Tracer::setEnabled(false);
+        Tracer::clear();
+    }
+
+    static uint32_t countOccurrences(const std::string &text, const std::string &pattern)
+    {
+        uint32_t numberOfOccurrences{0};
+
+        for(auto position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1))
+        {
+            ++numberOfOccurrences;
+        }
+
+        return numberOfOccurrences;
+    }
+};
+
+TEST_F(TracerTests, disabledTracerRecordsNothing)
+{
+    Tracer::setEnabled(false);
+
+    {
+        const TraceScope traceScope("operation");
+        Tracer::counter("queue size", 3);
+    }
+
+    EXPECT_EQ(std::string::npos, Tracer::getChromeTrace().find("operation"));
+    EXPECT_EQ(std::string::npos, Tracer::getChromeTrace().find("queue size"));
+}
+
+TEST_F(TracerTests, eventsOfEachThreadAreExported)
+{
+    auto worker = [](const std::string &threadName)
+    {
+        Tracer::setCurrentThreadName(threadName);
+
+        for(int i=0; i<3; ++i)
+        {
+            const TraceScope traceScope("draw \"frame\"");
+            Tracer::counter("queue size", i);
+        }
+    };
+
+    std::thread firstThread(worker, "firstThread");
+    std::thread secondThread(worker, "secondThread");
+    firstThread.join();
+    secondThread.join();
+
+    const auto trace = Tracer::getChromeTrace();
+
+    EXPECT_EQ(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"firstThread\"}"));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"secondThread\"}"));
+    EXPECT_EQ(6, countOccurrences(trace, "{\"name\":\"draw \\\"frame\\\"\",\"ph\":\"B\""));
+    EXPECT_EQ(6, countOccurrences(trace, "{\"name\":\"draw \\\"frame\\\"\",\"ph\":\"E\""));
+    EXPECT_EQ(2, countOccurrences(trace, "\"args\":{\"value\":2.000}"));
+    EXPECT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+}
+
+TEST_F(TracerTests, processingOfStageIsTraced)
+{
+    const auto stageMetrics = Metrics::registerStage("tracedStage");
+
+    for(int i=0; i<5; ++i)
+    {
+        const auto processingScope = stageMetrics->startProcessing();
+    }
+
+    const auto trace = Tracer::getChromeTrace();
+
+    EXPECT_EQ(5, countOccurrences(trace, "{\"name\":\"tracedStage\",\"ph\":\"B\""));
+    EXPECT_EQ(5, countOccurrences(trace, "{\"name\":\"tracedStage\",\"ph\":\"E\""));
+}
+
+TEST_F(TracerTests, bufferKeepsNewestEvents)
+{
+    TraceBuffer buffer(1);
+    const uint32_t numberOfEvents{TraceBuffer::capacity + 10};
+
+    for(uint32_t i=0; i<numberOfEvents; ++i)
+    {
+        buffer.add('C', "a name which is longer than the space reserved for it in the event", i);
+    }
+
+    auto events = buffer.getEvents();
+
+    ASSERT_EQ(TraceBuffer::capacity, events.size());
+    EXPECT_EQ(10, events.front().value);
+    EXPECT_EQ(numberOfEvents - 1, events.back().value);
+    EXPECT_EQ(TraceEvent::maxNameLength, std::string(events.back().name.data()).size());
+
+    for(uint32_t i=1; i<events.size(); ++i)
+    {
+        EXPECT_LE(events.at(i - 1).timestamp, events.at(i).timestamp);
+    }
+
+    buffer.clear();
+    buffer.add('C', "counter", 1);
+
+    events = buffer.getEvents();
+
+    ASSERT_EQ(1, events.size());
+    EXPECT_EQ(std::string("counter"), events.front().name.data());
+}
+
+TEST_F(TracerTests, eventsOverwrittenWhileCopyingAreDropped)
+{
+    TraceBuffer buffer(1);
+    std::atomic<bool> writing{true};
+
+    // the name repeats the value, so an event mixed from two writes is detected
+    std::thread writer([&buffer, &writing]()
+    {
+        for(uint32_t i=0; writing; ++i)
+        {
+            buffer.add('C', std::to_string(i), i);
+        }
+    });
+
+    for(uint32_t i=0; i<20; ++i)
+    {
+        const auto events = buffer.getEvents();
+
+        for(uint32_t j=0; j<events.size(); ++j)
+        {
+            ASSERT_EQ(std::to_string(static_cast<uint32_t>(events.at(j).value)), events.at(j).name.data());
+
+            if(j > 0)
+            {
+                ASSERT_LT(events.at(j - 1).value, events.at(j).value);
+            }
+        }
+    }
+
+    writing = false;
+    writer.join();
+}
+
+TEST_F(TracerTests, traceIsSavedToFile)
+{
+    const auto path = (std::filesystem::temp_directory_path() / "TracerTests.json").string();
+
+    {
+        const TraceScope traceScope("saved");
+    }
+
+    ASSERT_TRUE(Tracer::saveChromeTrace(path));
+
+    std::ifstream file(path);
+    std::stringstream content;
+    content<<file.rdbuf();
+
+    EXPECT_EQ(Tracer::getChromeTrace(), content.str());
+    EXPECT_FALSE(Tracer::saveChromeTrace((std::filesystem::temp_directory_path() / "missingDirectory" / "trace.json").string()));
+
+    std::filesystem::remove(path);
+}
@@ -53,6 +53,7 @@ struct WindowTests  : public WindowTestsBase, public ::testing::Test
         config.data.add(HorizontalDrawingArea{{5,90}});
         config.data.add(VerticalDbfsRange{{-96.32, 0}});
         config.data.add(SingleScaleMode{false});
+        config.data.add(FrameTimingSettings{FrameTiming{0, false}});
 
         return config;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -20,10 +20,21 @@ PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = nullptr;
 PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = nullptr;
 PFNGLDRAWARRAYSPROC glad_glDrawArrays = nullptr;
 PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = nullptr;
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = nullptr;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = nullptr;
 PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = nullptr;
 PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = nullptr;
 PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = nullptr;
 PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = nullptr;
+PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = nullptr;
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = nullptr;
+PFNGLFENCESYNCPROC glad_glFenceSync = nullptr;
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = nullptr;
+PFNGLDELETESYNCPROC glad_glDeleteSync = nullptr;
+PFNGLBINDBUFFERPROC glad_glBindBuffer = nullptr;
+PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = nullptr;
+PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = nullptr;
+PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = nullptr;
 
 PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = nullptr;
 PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = nullptr;
@@ -37,6 +48,24 @@ PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = nullptr;
 PFNGLVIEWPORTPROC glad_glViewport = nullptr;
 PFNGLENABLEPROC glad_glEnable = nullptr;
 PFNGLBLENDFUNCPROC glad_glBlendFunc = nullptr;
+PFNGLGENQUERIESPROC glad_glGenQueries = nullptr;
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries = nullptr;
+PFNGLBEGINQUERYPROC glad_glBeginQuery = nullptr;
+PFNGLENDQUERYPROC glad_glEndQuery = nullptr;
+PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = nullptr;
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = nullptr;
+PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = nullptr;
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = nullptr;
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures = nullptr;
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = nullptr;
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = nullptr;
+PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = nullptr;
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = nullptr;
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = nullptr;
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = nullptr;
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = nullptr;
+PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = nullptr;
+int GLAD_GL_VERSION_3_3 = 0;
 
 std::function<int()> gladLoadGLFunction;
 std::function<void(GLsizei , GLuint *)> glCreateProgramPipelinesFunction;
@@ -47,6 +76,15 @@ std::function<void(GLsizei, GLuint *)> glCreateVertexArraysFunction;
 std::function<void(GLsizei, GLuint *)> glCreateBuffersFunction;
 std::function<void(GLuint, GLsizeiptr, const void *, GLbitfield)> glNamedBufferStorageFunction;
 std::function<void(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)> glNamedBufferSubDataFunction;
+std::function<void*(GLuint, GLintptr, GLsizeiptr, GLbitfield)> glMapNamedBufferRangeFunction;
+std::function<void(GLuint, GLuint, GLintptr, GLintptr, GLsizeiptr)> glCopyNamedBufferSubDataFunction;
+std::function<GLsync(GLenum, GLbitfield)> glFenceSyncFunction;
+std::function<GLenum(GLsync, GLbitfield, GLuint64)> glClientWaitSyncFunction;
+std::function<void(GLsync)> glDeleteSyncFunction;
+std::function<void(GLenum, GLuint)> glBindBufferFunction;
+std::function<void(GLenum, GLuint, GLuint)> glBindBufferBaseFunction;
+std::function<void(GLuint, GLuint, GLuint)> glDispatchComputeFunction;
+std::function<void(GLbitfield)> glMemoryBarrierFunction;
 
 std::function<void(GLuint, GLuint)> glEnableVertexArrayAttribFunction;
 std::function<void(GLuint, GLuint, GLint, GLenum, GLboolean, GLuint)> glVertexArrayAttribFormatFunction;
@@ -63,6 +101,8 @@ std::function<void(GLuint, GLint, GLfloat, GLfloat)> glProgramUniform2fFunction;
 std::function<void(GLuint, GLint, GLfloat, GLfloat, GLfloat, GLfloat)> glProgramUniform4fFunction;
 std::function<void(GLenum, GLint, GLsizei)> glDrawArraysFunction;
 std::function<void(GLenum, GLint, GLsizei, GLsizei)> glDrawArraysInstancedFunction;
+std::function<void(GLenum, GLint, GLsizei, GLsizei, GLuint)> glDrawArraysInstancedBaseInstanceFunction;
+std::function<void(GLenum, const void *, GLsizei, GLsizei)> glMultiDrawArraysIndirectFunction;
 std::function<void(GLsizei, const GLuint *)> glDeleteProgramPipelinesFunction;
 std::function<void(GLuint)> glDeleteProgramFunction;
 std::function<void(GLfloat, GLfloat, GLfloat, GLfloat)> glClearColorFunction;
@@ -70,6 +110,23 @@ std::function<void(GLbitfield)> glClearFunction;
 std::function<void(GLint, GLint,GLsizei, GLsizei)> glViewportFunction;
 std::function<void(GLenum)> glEnableFunction;
 std::function<void(GLenum, GLenum)> glBlendFuncFunction;
+std::function<void(GLsizei, GLuint *)> glGenQueriesFunction;
+std::function<void(GLsizei, const GLuint *)> glDeleteQueriesFunction;
+std::function<void(GLenum, GLuint)> glBeginQueryFunction;
+std::function<void(GLenum)> glEndQueryFunction;
+std::function<void(GLuint, GLenum, GLint *)> glGetQueryObjectivFunction;
+std::function<void(GLuint, GLenum, GLuint64 *)> glGetQueryObjectui64vFunction;
+std::function<void(GLsizei, const GLuint *)> glDeleteVertexArraysFunction;
+std::function<void(GLenum, GLsizei, GLuint *)> glCreateTexturesFunction;
+std::function<void(GLsizei, const GLuint *)> glDeleteTexturesFunction;
+std::function<void(GLuint, GLsizei, GLenum, GLsizei, GLsizei)> glTextureStorage2DFunction;
+std::function<void(GLuint, GLuint)> glBindTextureUnitFunction;
+std::function<void(GLsizei, GLuint *)> glCreateFramebuffersFunction;
+std::function<void(GLsizei, const GLuint *)> glDeleteFramebuffersFunction;
+std::function<void(GLuint, GLenum, GLuint, GLint)> glNamedFramebufferTextureFunction;
+std::function<void(GLenum, GLuint)> glBindFramebufferFunction;
+std::function<void(GLuint, GLenum, GLint, const GLfloat *)> glClearNamedFramebufferfvFunction;
+std::function<void(GLenum, GLenum, GLenum, GLenum)> glBlendFuncSeparateFunction;
 
 int gladLoadGL(void)
 {
@@ -121,6 +178,51 @@ void glNamedBufferSubDataMock(GLuint buffer, GLintptr offset, GLsizeiptr size, c
     glNamedBufferSubDataFunction(buffer, offset, size, data);
 }
 
+void* glMapNamedBufferRangeMock(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    return glMapNamedBufferRangeFunction(buffer, offset, length, access);
+}
+
+void glCopyNamedBufferSubDataMock(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    glCopyNamedBufferSubDataFunction(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+GLsync glFenceSyncMock(GLenum condition, GLbitfield flags)
+{
+    return glFenceSyncFunction(condition, flags);
+}
+
+GLenum glClientWaitSyncMock(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    return glClientWaitSyncFunction(sync, flags, timeout);
+}
+
+void glDeleteSyncMock(GLsync sync)
+{
+    glDeleteSyncFunction(sync);
+}
+
+void glBindBufferMock(GLenum target, GLuint buffer)
+{
+    glBindBufferFunction(target, buffer);
+}
+
+void glBindBufferBaseMock(GLenum target, GLuint index, GLuint buffer)
+{
+    glBindBufferBaseFunction(target, index, buffer);
+}
+
+void glDispatchComputeMock(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ)
+{
+    glDispatchComputeFunction(numGroupsX, numGroupsY, numGroupsZ);
+}
+
+void glMemoryBarrierMock(GLbitfield barriers)
+{
+    glMemoryBarrierFunction(barriers);
+}
+
 void glEnableVertexArrayAttribMock(GLuint vaobj, GLuint index)
 {
     glEnableVertexArrayAttribFunction(vaobj, index);
@@ -165,9 +267,10 @@ GLint glGetUniformLocationMock(GLuint program, const GLchar *name)
 {
     return glGetUniformLocationFunction(program, name);
 }
+
 void glProgramUniform1uiMock(GLuint program, GLint location, GLuint v0)
 {
-    glProgramUniform1fFunction(program, location, v0);
+    glProgramUniform1uiFunction(program, location, v0);
 }
 
 void glProgramUniform1fMock(GLuint program, GLint location, GLfloat v0)
@@ -195,6 +298,16 @@ void glDrawArraysInstancedMock(GLenum mode, GLint first, GLsizei count, GLsizei
     glDrawArraysInstancedFunction(mode, first, count,instancecount);
 }
 
+void glDrawArraysInstancedBaseInstanceMock(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    glDrawArraysInstancedBaseInstanceFunction(mode, first, count, instancecount, baseinstance);
+}
+
+void glMultiDrawArraysIndirectMock(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    glMultiDrawArraysIndirectFunction(mode, indirect, drawcount, stride);
+}
+
 void glDeleteProgramPipelinesMock(GLsizei n, const GLuint *pipelines)
 {
     glDeleteProgramPipelinesFunction(n, pipelines);
@@ -230,6 +343,91 @@ void glBlendFuncMock(GLenum sfactor, GLenum dfactor)
     glBlendFuncFunction(sfactor,dfactor);
 }
 
+void glGenQueriesMock(GLsizei n, GLuint *ids)
+{
+    glGenQueriesFunction(n, ids);
+}
+
+void glDeleteQueriesMock(GLsizei n, const GLuint *ids)
+{
+    glDeleteQueriesFunction(n, ids);
+}
+
+void glBeginQueryMock(GLenum target, GLuint id)
+{
+    glBeginQueryFunction(target, id);
+}
+
+void glEndQueryMock(GLenum target)
+{
+    glEndQueryFunction(target);
+}
+
+void glGetQueryObjectivMock(GLuint id, GLenum pname, GLint *params)
+{
+    glGetQueryObjectivFunction(id, pname, params);
+}
+
+void glGetQueryObjectui64vMock(GLuint id, GLenum pname, GLuint64 *params)
+{
+    glGetQueryObjectui64vFunction(id, pname, params);
+}
+
+void glDeleteVertexArraysMock(GLsizei n, const GLuint *arrays)
+{
+    glDeleteVertexArraysFunction(n, arrays);
+}
+
+void glCreateTexturesMock(GLenum target, GLsizei n, GLuint *textures)
+{
+    glCreateTexturesFunction(target, n, textures);
+}
+
+void glDeleteTexturesMock(GLsizei n, const GLuint *textures)
+{
+    glDeleteTexturesFunction(n, textures);
+}
+
+void glTextureStorage2DMock(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    glTextureStorage2DFunction(texture, levels, internalformat, width, height);
+}
+
+void glBindTextureUnitMock(GLuint unit, GLuint texture)
+{
+    glBindTextureUnitFunction(unit, texture);
+}
+
+void glCreateFramebuffersMock(GLsizei n, GLuint *framebuffers)
+{
+    glCreateFramebuffersFunction(n, framebuffers);
+}
+
+void glDeleteFramebuffersMock(GLsizei n, const GLuint *framebuffers)
+{
+    glDeleteFramebuffersFunction(n, framebuffers);
+}
+
+void glNamedFramebufferTextureMock(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    glNamedFramebufferTextureFunction(framebuffer, attachment, texture, level);
+}
+
+void glBindFramebufferMock(GLenum target, GLuint framebuffer)
+{
+    glBindFramebufferFunction(target, framebuffer);
+}
+
+void glClearNamedFramebufferfvMock(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    glClearNamedFramebufferfvFunction(framebuffer, buffer, drawbuffer, value);
+}
+
+void glBlendFuncSeparateMock(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    glBlendFuncSeparateFunction(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
 
 OpenGlMock::OpenGlMock()
 {
@@ -242,6 +440,15 @@ OpenGlMock::OpenGlMock()
     ::glad_glCreateBuffers = glCreateBuffersMock;
     ::glad_glNamedBufferStorage = glNamedBufferStorageMock;
     ::glad_glNamedBufferSubData = glNamedBufferSubDataMock;
+    ::glad_glMapNamedBufferRange = glMapNamedBufferRangeMock;
+    ::glad_glCopyNamedBufferSubData = glCopyNamedBufferSubDataMock;
+    ::glad_glFenceSync = glFenceSyncMock;
+    ::glad_glClientWaitSync = glClientWaitSyncMock;
+    ::glad_glDeleteSync = glDeleteSyncMock;
+    ::glad_glBindBuffer = glBindBufferMock;
+    ::glad_glBindBufferBase = glBindBufferBaseMock;
+    ::glad_glDispatchCompute = glDispatchComputeMock;
+    ::glad_glMemoryBarrier = glMemoryBarrierMock;
 
     ::glad_glEnableVertexArrayAttrib = glEnableVertexArrayAttribMock;
     ::glad_glVertexArrayAttribFormat = glVertexArrayAttribFormatMock;
@@ -259,6 +466,8 @@ OpenGlMock::OpenGlMock()
     ::glad_glProgramUniform4f = glProgramUniform4fMock;
     ::glad_glDrawArrays = glDrawArraysMock;
     ::glad_glDrawArraysInstanced = glDrawArraysInstancedMock;
+    ::glad_glDrawArraysInstancedBaseInstance = glDrawArraysInstancedBaseInstanceMock;
+    ::glad_glMultiDrawArraysIndirect = glMultiDrawArraysIndirectMock;
     ::glad_glDeleteProgramPipelines = glDeleteProgramPipelinesMock;
     ::glad_glDeleteProgram = glDeleteProgramMock;
     ::glad_glClearColor = glClearColorMock;
@@ -266,6 +475,23 @@ OpenGlMock::OpenGlMock()
     ::glad_glViewport = glViewportMock;
     ::glad_glEnable = glEnableMock;
     ::glad_glBlendFunc = glBlendFuncMock;
+    ::glad_glGenQueries = glGenQueriesMock;
+    ::glad_glDeleteQueries = glDeleteQueriesMock;
+    ::glad_glBeginQuery = glBeginQueryMock;
+    ::glad_glEndQuery = glEndQueryMock;
+    ::glad_glGetQueryObjectiv = glGetQueryObjectivMock;
+    ::glad_glGetQueryObjectui64v = glGetQueryObjectui64vMock;
+    ::glad_glDeleteVertexArrays = glDeleteVertexArraysMock;
+    ::glad_glCreateTextures = glCreateTexturesMock;
+    ::glad_glDeleteTextures = glDeleteTexturesMock;
+    ::glad_glTextureStorage2D = glTextureStorage2DMock;
+    ::glad_glBindTextureUnit = glBindTextureUnitMock;
+    ::glad_glCreateFramebuffers = glCreateFramebuffersMock;
+    ::glad_glDeleteFramebuffers = glDeleteFramebuffersMock;
+    ::glad_glNamedFramebufferTexture = glNamedFramebufferTextureMock;
+    ::glad_glBindFramebuffer = glBindFramebufferMock;
+    ::glad_glClearNamedFramebufferfv = glClearNamedFramebufferfvMock;
+    ::glad_glBlendFuncSeparate = glBlendFuncSeparateMock;
 
     gladLoadGLFunction = [this]()
     {
@@ -294,16 +520,34 @@ OpenGlMock::OpenGlMock()
 
     glCreateVertexArraysFunction =[this](GLsizei n, GLuint *arrays)
     {
+        for(GLsizei i=0; i<n; ++i)
+        {
+            arrays[i] = ++lastVertexArrayName;
+        }
+
         this->glCreateVertexArrays(n, arrays);
     };
 
     glCreateBuffersFunction = [this](GLsizei n, GLuint *buffers)
     {
+        for(GLsizei i=0; i<n; ++i)
+        {
+            buffers[i] = ++lastBufferName;
+        }
+
         this->glCreateBuffers(n, buffers);
     };
 
     glNamedBufferStorageFunction= [this](GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
     {
+        auto &storage = bufferStorages[buffer];
+        storage.assign(size, 0);
+
+        if(data)
+        {
+            std::copy_n(static_cast<const uint8_t*>(data), size, storage.begin());
+        }
+
         this->glNamedBufferStorage(buffer, size, data, flags);
     };
 
@@ -312,6 +556,69 @@ OpenGlMock::OpenGlMock()
         this->glNamedBufferSubData(buffer, offset, size, data);
     };
 
+    glMapNamedBufferRangeFunction = [this](GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+    {
+        if(auto *memory = this->glMapNamedBufferRange(buffer, offset, length, access))
+        {
+            return memory;
+        }
+
+        return static_cast<void*>(bufferStorages[buffer].data() + offset);
+    };
+
+    glCopyNamedBufferSubDataFunction = [this](GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+    {
+        const auto &readStorage = bufferStorages[readBuffer];
+        std::copy_n(readStorage.begin() + readOffset, size, bufferStorages[writeBuffer].begin() + writeOffset);
+
+        this->glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+    };
+
+    glFenceSyncFunction = [this](GLenum condition, GLbitfield flags)
+    {
+        if(auto fence = this->glFenceSync(condition, flags))
+        {
+            return fence;
+        }
+
+        return reinterpret_cast<GLsync>(++lastFence);
+    };
+
+    glClientWaitSyncFunction = [this](GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        return this->glClientWaitSync(sync, flags, timeout);
+    };
+
+    glDeleteSyncFunction = [this](GLsync sync)
+    {
+        this->glDeleteSync(sync);
+    };
+
+    glBindBufferFunction = [this](GLenum target, GLuint buffer)
+    {
+        if(target == GL_DRAW_INDIRECT_BUFFER)
+        {
+            boundIndirectBuffer = buffer;
+        }
+
+        this->glBindBuffer(target, buffer);
+    };
+
+    glBindBufferBaseFunction = [this](GLenum target, GLuint index, GLuint buffer)
+    {
+        this->glBindBufferBase(target, index, buffer);
+    };
+
+    glDispatchComputeFunction = [this](GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ)
+    {
+        this->glDispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
+    };
+
+    glMemoryBarrierFunction = [this](GLbitfield barriers)
+    {
+        this->glMemoryBarrier(barriers);
+    };
+
     glEnableVertexArrayAttribFunction= [this](GLuint vaobj, GLuint index)
     {
         this->glEnableVertexArrayAttrib(vaobj, index);
@@ -324,6 +631,7 @@ OpenGlMock::OpenGlMock()
 
     glVertexArrayVertexBufferFunction= [this](GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
     {
+        vertexBufferBindings[{vaobj, bindingindex}] = VertexBufferBinding{buffer, offset, stride};
         this->glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
     };
 
@@ -344,6 +652,7 @@ OpenGlMock::OpenGlMock()
 
     glBindVertexArrayFunction = [this](GLuint array)
     {
+        boundVertexArray = array;
         this->glBindVertexArray(array);
     };
 
@@ -387,6 +696,16 @@ OpenGlMock::OpenGlMock()
         this->glDrawArraysInstanced(mode, first, count, instancecount);
     };
 
+    glDrawArraysInstancedBaseInstanceFunction = [this](GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+    {
+        this->glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+    };
+
+    glMultiDrawArraysIndirectFunction = [this](GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+    {
+        this->glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+    };
+
     glDeleteProgramPipelinesFunction = [this](GLsizei n, const GLuint *pipelines)
     {
         this->glDeleteProgramPipelines(n, pipelines);
@@ -422,5 +741,115 @@ OpenGlMock::OpenGlMock()
         this->glBlendFunc(sfactor, dfactor);
     };
 
+    glGenQueriesFunction = [this](GLsizei n, GLuint *ids)
+    {
+        this->glGenQueries(n, ids);
+    };
+
+    glDeleteQueriesFunction = [this](GLsizei n, const GLuint *ids)
+    {
+        this->glDeleteQueries(n, ids);
+    };
+
+    glBeginQueryFunction = [this](GLenum target, GLuint id)
+    {
+        this->glBeginQuery(target, id);
+    };
+
+    glEndQueryFunction = [this](GLenum target)
+    {
+        this->glEndQuery(target);
+    };
+
+    glGetQueryObjectivFunction = [this](GLuint id, GLenum pname, GLint *params)
+    {
+        this->glGetQueryObjectiv(id, pname, params);
+    };
+
+    glGetQueryObjectui64vFunction = [this](GLuint id, GLenum pname, GLuint64 *params)
+    {
+        this->glGetQueryObjectui64v(id, pname, params);
+    };
+
+    glDeleteVertexArraysFunction = [this](GLsizei n, const GLuint *arrays)
+    {
+        this->glDeleteVertexArrays(n, arrays);
+    };
+
+    glCreateTexturesFunction = [this](GLenum target, GLsizei n, GLuint *textures)
+    {
+        for(GLsizei i=0; i<n; ++i)
+        {
+            textures[i] = ++lastTextureName;
+        }
+
+        this->glCreateTextures(target, n, textures);
+    };
+
+    glDeleteTexturesFunction = [this](GLsizei n, const GLuint *textures)
+    {
+        this->glDeleteTextures(n, textures);
+    };
+
+    glTextureStorage2DFunction = [this](GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        this->glTextureStorage2D(texture, levels, internalformat, width, height);
+    };
+
+    glBindTextureUnitFunction = [this](GLuint unit, GLuint texture)
+    {
+        this->glBindTextureUnit(unit, texture);
+    };
+
+    glCreateFramebuffersFunction = [this](GLsizei n, GLuint *framebuffers)
+    {
+        for(GLsizei i=0; i<n; ++i)
+        {
+            framebuffers[i] = ++lastFramebufferName;
+        }
+
+        this->glCreateFramebuffers(n, framebuffers);
+    };
+
+    glDeleteFramebuffersFunction = [this](GLsizei n, const GLuint *framebuffers)
+    {
+        this->glDeleteFramebuffers(n, framebuffers);
+    };
+
+    glNamedFramebufferTextureFunction = [this](GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+    {
+        this->glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+    };
+
+    glBindFramebufferFunction = [this](GLenum target, GLuint framebuffer)
+    {
+        this->glBindFramebuffer(target, framebuffer);
+    };
+
+    glClearNamedFramebufferfvFunction = [this](GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+    {
+        this->glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+    };
+
+    glBlendFuncSeparateFunction = [this](GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+    {
+        this->glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    };
+
+}
+
+const std::vector<uint8_t>& OpenGlMock::getBufferStorage(GLuint buffer) const
+{
+    return bufferStorages.at(buffer);
 }
 
+const void* OpenGlMock::getInstancesOfBoundVertexArray(GLuint bindingIndex, GLuint baseInstance) const
+{
+    const auto &binding = vertexBufferBindings.at({boundVertexArray, bindingIndex});
+    return getBufferStorage(binding.buffer).data() + binding.offset + baseInstance * binding.stride;
+}
+
+const void* OpenGlMock::getCommandsOfBoundIndirectBuffer(const void *indirect) const
+{
+    return getBufferStorage(boundIndirectBuffer).data() + reinterpret_cast<uintptr_t>(indirect);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -8,6 +8,8 @@
 
 #include <glad/glad.h>
 #include <gmock/gmock.h>
+#include <map>
+#include <vector>
 
 
 class OpenGlMock
@@ -20,6 +22,15 @@ public:
     MOCK_METHOD2(glCreateBuffers, void(GLsizei, GLuint *));
     MOCK_METHOD4(glNamedBufferStorage, void(GLuint, GLsizeiptr, const void *, GLbitfield));
     MOCK_METHOD4(glNamedBufferSubData, void(GLuint, GLintptr, GLsizeiptr, const void *));
+    MOCK_METHOD4(glMapNamedBufferRange, void*(GLuint, GLintptr, GLsizeiptr, GLbitfield));
+    MOCK_METHOD5(glCopyNamedBufferSubData, void(GLuint, GLuint, GLintptr, GLintptr, GLsizeiptr));
+    MOCK_METHOD2(glFenceSync, GLsync(GLenum, GLbitfield));
+    MOCK_METHOD3(glClientWaitSync, GLenum(GLsync, GLbitfield, GLuint64));
+    MOCK_METHOD1(glDeleteSync, void(GLsync));
+    MOCK_METHOD2(glBindBuffer, void(GLenum, GLuint));
+    MOCK_METHOD3(glBindBufferBase, void(GLenum, GLuint, GLuint));
+    MOCK_METHOD3(glDispatchCompute, void(GLuint, GLuint, GLuint));
+    MOCK_METHOD1(glMemoryBarrier, void(GLbitfield));
 
     MOCK_METHOD2(glEnableVertexArrayAttrib, void(GLuint, GLuint));
     MOCK_METHOD6(glVertexArrayAttribFormat, void(GLuint, GLuint, GLint, GLenum, GLboolean, GLuint));
@@ -40,6 +51,8 @@ public:
     MOCK_METHOD6(glProgramUniform4f, void(GLuint, GLint, GLfloat, GLfloat, GLfloat, GLfloat));
     MOCK_METHOD3(glDrawArrays, void(GLenum, GLint, GLsizei));
     MOCK_METHOD4(glDrawArraysInstanced, void(GLenum, GLint, GLsizei, GLsizei));
+    MOCK_METHOD5(glDrawArraysInstancedBaseInstance, void(GLenum, GLint, GLsizei, GLsizei, GLuint));
+    MOCK_METHOD4(glMultiDrawArraysIndirect, void(GLenum, const void *, GLsizei, GLsizei));
 
     MOCK_METHOD2(glDeleteProgramPipelines, void(GLsizei, const GLuint *));
     MOCK_METHOD1(glDeleteProgram, void(GLuint));
@@ -49,7 +62,54 @@ public:
     MOCK_METHOD4(glViewport, void(GLint , GLint ,GLsizei , GLsizei));
     MOCK_METHOD1(glEnable, void(GLenum));
     MOCK_METHOD2(glBlendFunc, void(GLenum, GLenum));
+    MOCK_METHOD4(glBlendFuncSeparate, void(GLenum, GLenum, GLenum, GLenum));
 
+    MOCK_METHOD2(glDeleteVertexArrays, void(GLsizei, const GLuint *));
+    MOCK_METHOD3(glCreateTextures, void(GLenum, GLsizei, GLuint *));
+    MOCK_METHOD2(glDeleteTextures, void(GLsizei, const GLuint *));
+    MOCK_METHOD5(glTextureStorage2D, void(GLuint, GLsizei, GLenum, GLsizei, GLsizei));
+    MOCK_METHOD2(glBindTextureUnit, void(GLuint, GLuint));
+    MOCK_METHOD2(glCreateFramebuffers, void(GLsizei, GLuint *));
+    MOCK_METHOD2(glDeleteFramebuffers, void(GLsizei, const GLuint *));
+    MOCK_METHOD4(glNamedFramebufferTexture, void(GLuint, GLenum, GLuint, GLint));
+    MOCK_METHOD2(glBindFramebuffer, void(GLenum, GLuint));
+    MOCK_METHOD4(glClearNamedFramebufferfv, void(GLuint, GLenum, GLint, const GLfloat *));
+
+    MOCK_METHOD2(glGenQueries, void(GLsizei, GLuint *));
+    MOCK_METHOD2(glDeleteQueries, void(GLsizei, const GLuint *));
+    MOCK_METHOD2(glBeginQuery, void(GLenum, GLuint));
+    MOCK_METHOD1(glEndQuery, void(GLenum));
+    MOCK_METHOD3(glGetQueryObjectiv, void(GLuint, GLenum, GLint *));
+    MOCK_METHOD3(glGetQueryObjectui64v, void(GLuint, GLenum, GLuint64 *));
+
+    // Buffers, vertex arrays, textures and framebuffers get consecutive names, storage of
+    // buffers and their bindings to vertex arrays are recorded, so glMapNamedBufferRange
+    // returns real memory unless the expectation returns its own pointer, copies between
+    // buffers are made and tests can check what a draw reads. Fences which are not returned by the expectation get consecutive
+    // fake handles.
+    const std::vector<uint8_t>& getBufferStorage(GLuint buffer) const;
+    // instances read by a draw with the given base instance from the bound vertex array
+    const void* getInstancesOfBoundVertexArray(GLuint bindingIndex, GLuint baseInstance) const;
+    // commands read by a multi-draw with the given offset from the bound draw indirect buffer
+    const void* getCommandsOfBoundIndirectBuffer(const void *indirect) const;
+
+private:
+    struct VertexBufferBinding
+    {
+        GLuint buffer;
+        GLintptr offset;
+        GLsizei stride;
+    };
+
+    std::map<GLuint, std::vector<uint8_t>> bufferStorages;
+    std::map<std::pair<GLuint, GLuint>, VertexBufferBinding> vertexBufferBindings;
+    GLuint lastBufferName{0};
+    GLuint lastVertexArrayName{0};
+    GLuint lastTextureName{0};
+    GLuint lastFramebufferName{0};
+    GLuint boundVertexArray{0};
+    GLuint boundIndirectBuffer{0};
+    uintptr_t lastFence{0};
 };
 
 
@@ -11,9 +11,11 @@ std::function<PaError()> Pa_InitializeFunction;
 std::function<const char *(PaError)> Pa_GetErrorTextFunction;
 std::function<PaDeviceIndex()> Pa_GetDefaultInputDeviceFunction;
 std::function<const PaDeviceInfo*(PaDeviceIndex)> Pa_GetDeviceInfoFunction;
+std::function<PaError(const PaStreamParameters *,const PaStreamParameters *,double)> Pa_IsFormatSupportedFunction;
 std::function<PaError(PaStream**,const PaStreamParameters *,const PaStreamParameters *,double,unsigned long,PaStreamFlags,PaStreamCallback *,void *userData)> Pa_OpenStreamFunction;
 std::function<PaError(PaStream *)> Pa_StartStreamFunction;
 std::function<PaError(PaStream*,void *,unsigned long)> Pa_ReadStreamFunction;
+std::function<signed long(PaStream*)> Pa_GetStreamReadAvailableFunction;
 std::function<PaError(PaStream *)> Pa_StopStreamFunction;
 std::function<PaError(PaStream *)> Pa_CloseStreamFunction;
 std::function<PaError()> Pa_TerminateFunction;
@@ -39,6 +41,11 @@ const PaDeviceInfo* Pa_GetDeviceInfo(PaDeviceIndex device)
     return Pa_GetDeviceInfoFunction(device);
 }
 
+PaError Pa_IsFormatSupported(const PaStreamParameters *inputParameters,const PaStreamParameters *outputParameters,double sampleRate)
+{
+    return Pa_IsFormatSupportedFunction(inputParameters, outputParameters, sampleRate);
+}
+
 PaError Pa_OpenStream(PaStream** stream,const PaStreamParameters *inputParameters,const PaStreamParameters *outputParameters,double sampleRate,unsigned long framesPerBuffer,PaStreamFlags streamFlags,PaStreamCallback *streamCallback,void *userData )
 {
     return Pa_OpenStreamFunction(stream, inputParameters, outputParameters,sampleRate, framesPerBuffer, streamFlags, streamCallback, userData);
@@ -54,6 +61,11 @@ PaError Pa_ReadStream(PaStream* stream,void *buffer,unsigned long frames)
     return Pa_ReadStreamFunction(stream, buffer, frames);
 }
 
+signed long Pa_GetStreamReadAvailable(PaStream* stream)
+{
+    return Pa_GetStreamReadAvailableFunction(stream);
+}
+
 PaError Pa_StopStream(PaStream *stream)
 {
     return Pa_StopStreamFunction(stream);
@@ -91,6 +103,11 @@ PortAudioMock::PortAudioMock()
         return this->Pa_GetDeviceInfo(device);
     };
 
+    Pa_IsFormatSupportedFunction = [this](const PaStreamParameters *inputParameters,const PaStreamParameters *outputParameters,double sampleRate)
+    {
+        return this->Pa_IsFormatSupported(inputParameters, outputParameters, sampleRate);
+    };
+
     Pa_OpenStreamFunction = [this](PaStream** stream,const PaStreamParameters *inputParameters,const PaStreamParameters *outputParameters,double sampleRate,unsigned long framesPerBuffer,PaStreamFlags streamFlags,PaStreamCallback *streamCallback,void *userData )
     {
         return Pa_OpenStream(stream, inputParameters, outputParameters,sampleRate, framesPerBuffer, streamFlags, streamCallback, userData);
@@ -106,6 +123,11 @@ PortAudioMock::PortAudioMock()
         return this->Pa_ReadStream(stream, buffer, frames);
     };
 
+    Pa_GetStreamReadAvailableFunction = [this](PaStream* stream)
+    {
+        return this->Pa_GetStreamReadAvailable(stream);
+    };
+
     Pa_StopStreamFunction = [this](PaStream *stream)
     {
         return this->Pa_StopStream(stream);
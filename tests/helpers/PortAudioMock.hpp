@@ -19,9 +19,11 @@ public:
     MOCK_METHOD1(Pa_GetErrorText, const char *(PaError errorCode));
     MOCK_METHOD0(Pa_GetDefaultInputDevice, const PaDeviceIndex());
     MOCK_METHOD1(Pa_GetDeviceInfo, const PaDeviceInfo*(PaDeviceIndex));
+    MOCK_METHOD3(Pa_IsFormatSupported, PaError(const PaStreamParameters *,const PaStreamParameters *,double));
     MOCK_METHOD8(Pa_OpenStream, PaError(PaStream**,const PaStreamParameters *,const PaStreamParameters *,double,unsigned long,PaStreamFlags,PaStreamCallback *,void *));
     MOCK_METHOD1(Pa_StartStream, PaError(PaStream *));
     MOCK_METHOD3(Pa_ReadStream, PaError(PaStream*,void *,unsigned long));
+    MOCK_METHOD1(Pa_GetStreamReadAvailable, signed long(PaStream*));
     MOCK_METHOD1(Pa_StopStream, PaError(PaStream *));
     MOCK_METHOD1(Pa_CloseStream, PaError(PaStream *));
     MOCK_METHOD0(Pa_Terminate, PaError());
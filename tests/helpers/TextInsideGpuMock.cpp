@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -11,6 +11,7 @@ std::function<void()> initializeFunction;
 std::function<void(const HorizontalAligment, const VerticalAligment, const float, const float)> drawFunction;
 std::function<void(const std::string &, const HorizontalAligment, const VerticalAligment, const float, const float)> draw2Function;
 std::function<void(const HorizontalAligment, const VerticalAligment)> draw3Function;
+std::function<void()> drawQueuedFunction;
 std::function<void()> finalizeFunction;
 
 
@@ -55,6 +56,11 @@ void TextInsideGpu::draw(const HorizontalAligment horizontalAligment, const Vert
     draw3Function(horizontalAligment, verticalAligment);
 }
 
+void TextInsideGpu::drawQueued()
+{
+    drawQueuedFunction();
+}
+
 void TextInsideGpu::finalize()
 {
     finalizeFunction();
@@ -93,6 +99,11 @@ TextInsideGpuMock::TextInsideGpuMock()
         this->draw(horizontalAligment, verticalAligment);
     };
 
+    drawQueuedFunction = [this]()
+    {
+        this->drawQueued();
+    };
+
     finalizeFunction = [this]()
     {
         this->finalize();
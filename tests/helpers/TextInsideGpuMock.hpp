@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Sylwester Kominek
+ * Copyright (C) 2024-2026, Sylwester Kominek
  * This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
  * see file LICENSE in this source tree.
  */
@@ -19,6 +19,7 @@ public:
     MOCK_METHOD2(draw, void(const HorizontalAligment, const VerticalAligment));
     MOCK_METHOD4(draw, void(const HorizontalAligment, const VerticalAligment verticalAligment, const float, const float));
     MOCK_METHOD5(draw, void(const std::string &, const HorizontalAligment, const VerticalAligment verticalAligment, const float, const float));
+    MOCK_METHOD0(drawQueued, void());
     MOCK_METHOD0(initialize, void());
     MOCK_METHOD0(finalize, void());
 };
@@ -12,6 +12,7 @@ std::function<bool()> checkIfWindowShouldBeClosedFunction;
 std::function<bool()> checkIfWindowShouldBeRecreatedFunction;
 std::function<std::optional<uint16_t>()> getUpdatedThemeNumberFunction;
 std::function<std::optional<ThemeConfig>()> checkIfThemeShouldBeChangedFunction;
+std::function<bool()> checkIfTraceShouldBeSavedFunction;
 std::function<void()> swapBuffersFunction;
 std::function<CursorPosition()> getCursorPositionFunction;
 std::function<WindowSize()> getWindowSizeFunction;
@@ -57,6 +58,11 @@ std::optional<ThemeConfig> WindowBase::checkIfThemeShouldBeChanged()
     return checkIfThemeShouldBeChangedFunction();
 }
 
+bool WindowBase::checkIfTraceShouldBeSaved()
+{
+    return checkIfTraceShouldBeSavedFunction();
+}
+
 void WindowBase::swapBuffers()
 {
     swapBuffersFunction();
@@ -103,6 +109,11 @@ WindowBaseMock::WindowBaseMock() : WindowBase({}, false)
         return this->checkIfThemeShouldBeChanged();
     };
 
+    checkIfTraceShouldBeSavedFunction = [this]()
+    {
+        return this->checkIfTraceShouldBeSaved();
+    };
+
     swapBuffersFunction = [this]()
     {
         return this->swapBuffers();
@@ -8,6 +8,7 @@
 #include "TextInsideGpuMock.hpp"
 #include "WindowBaseMock.hpp"
 #include "OpenGlMock.hpp"
+#include "core/gpu/DrawCommandTable.hpp"
 #include <iostream>
 #include <gtest/gtest.h>
 
@@ -46,18 +47,14 @@ struct WindowTestsBase
     const uint32_t backgroundCall{1};
     const uint32_t rectanglesCall{1};
     const uint32_t dynamicMaxholdSecondaryRectanglesCall{1};
-    const uint32_t smallRectanglesCall{1};
     const uint32_t linesCall{1};
-    const uint32_t dynamicMaxholdLinesCall{1};
-    const uint32_t dynamicMaxholdSecondaryLinesCall{1};
     const uint32_t highlightedVerticalLineCall{1};
-    const uint32_t horizontalLines{1};
-    const uint32_t verticalLines{1};
+    const uint32_t staticLinesCall{1};
+    const uint32_t staticLayerCacheCall{1};
+    const uint32_t maxHoldsCall{2};
+    const uint32_t dbfsUniformsCall{7};
 
-    struct Instance
-    {
-        float x, y;
-    };
+    const GLuint dbfsBinding{2};
 
     void expectCreateWindow()
     {
@@ -66,114 +63,166 @@ struct WindowTestsBase
 
     void expectInitializeGPU(const uint32_t numberOfRectangles, const bool additionalRectanglesEnabled)
     {
-        const uint32_t differentTypesCall{backgroundCall + rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + linesCall};
-        const uint32_t numberOfRectanglesCalls = (additionalRectanglesEnabled ? (rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + smallRectanglesCall+backgroundCall) : (rectanglesCall+backgroundCall));
-        const uint32_t numberOfLinesCalls = (linesCall + dynamicMaxholdLinesCall + dynamicMaxholdSecondaryLinesCall + highlightedVerticalLineCall + horizontalLines + verticalLines);
+        const uint32_t differentTypesCall{backgroundCall + rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + linesCall + linesCall + staticLayerCacheCall};
+        const uint32_t computeShaderCall{1};
+        // layers drawn with one shader program share a vertex array and a table of draw commands
+        const uint32_t numberOfRectanglesCalls = (additionalRectanglesEnabled ? (rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + backgroundCall) : (rectanglesCall+backgroundCall));
+        const uint32_t numberOfDynamicLinesCalls = linesCall;
+        const uint32_t numberOfStaticLinesCalls = (highlightedVerticalLineCall + staticLinesCall);
+        const uint32_t numberOfDrawCommandTables = numberOfRectanglesCalls + numberOfDynamicLinesCalls + numberOfStaticLinesCalls;
+        // values, update times of every max hold and the copy of max hold values read by the CPU
+        const uint32_t numberOfDbfsBuffers = 1 + maxHoldsCall + 1;
 
         EXPECT_CALL(openGL, gladLoadGL()).Times(1);
         EXPECT_CALL(openGL, glEnable(GL_BLEND)).Times(1);
         EXPECT_CALL(openGL, glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)).Times(1);
 
-        EXPECT_CALL(openGL, glCreateShaderProgramv(_,_,_)).Times(2*differentTypesCall);
-        EXPECT_CALL(openGL, glGetProgramInfoLog(_,_,_,_)).Times(2*differentTypesCall);
-        EXPECT_CALL(openGL, glCreateProgramPipelines(_,_)).Times(differentTypesCall);
-        EXPECT_CALL(openGL, glUseProgramStages(_,_,_)).Times(2*differentTypesCall);
-        EXPECT_CALL(openGL, glGetUniformLocation(_,_)).Times(2*(rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + backgroundCall));
+        EXPECT_CALL(openGL, glCreateShaderProgramv(_,_,_)).Times(2*differentTypesCall + computeShaderCall);
+        EXPECT_CALL(openGL, glGetProgramInfoLog(_,_,_,_)).Times(2*differentTypesCall + computeShaderCall);
+        EXPECT_CALL(openGL, glCreateProgramPipelines(_,_)).Times(differentTypesCall + computeShaderCall);
+        EXPECT_CALL(openGL, glUseProgramStages(_,_,_)).Times(2*differentTypesCall + computeShaderCall);
+        EXPECT_CALL(openGL, glGetUniformLocation(_,_)).Times(3*(rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + backgroundCall) + 2*linesCall + dbfsUniformsCall);
+        EXPECT_CALL(openGL, glProgramUniform2f(_,_,_,_)).Times(rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + backgroundCall + linesCall);
         EXPECT_CALL(text, initialize()).Times(1);
 
-        EXPECT_CALL(openGL, glCreateVertexArrays(_,_)).Times(numberOfRectanglesCalls + numberOfLinesCalls);
-        EXPECT_CALL(openGL, glCreateBuffers(_,_)).Times(2*(numberOfRectanglesCalls + numberOfLinesCalls));
-        EXPECT_CALL(openGL, glNamedBufferStorage(_,_,_,_)).Times(2*(numberOfRectanglesCalls + numberOfLinesCalls));
+        EXPECT_CALL(openGL, glCreateVertexArrays(_,_)).Times(numberOfRectanglesCalls + numberOfDynamicLinesCalls + numberOfStaticLinesCalls + staticLayerCacheCall);
+        EXPECT_CALL(openGL, glCreateBuffers(_,_)).Times(numberOfRectanglesCalls + numberOfDynamicLinesCalls + 2*numberOfStaticLinesCalls + numberOfDrawCommandTables + numberOfDbfsBuffers);
+        EXPECT_CALL(openGL, glNamedBufferStorage(_,_,_,_)).Times(numberOfRectanglesCalls + numberOfDynamicLinesCalls + 2*numberOfStaticLinesCalls + numberOfDrawCommandTables + numberOfDbfsBuffers);
+
+        EXPECT_CALL(openGL, glEnableVertexArrayAttrib(_,_)).Times(4*numberOfRectanglesCalls + 3*(numberOfDynamicLinesCalls + numberOfStaticLinesCalls));
+        EXPECT_CALL(openGL, glVertexArrayAttribFormat(_,_,_,_,_,_)).Times(4*numberOfRectanglesCalls + 3*(numberOfDynamicLinesCalls + numberOfStaticLinesCalls));
+        EXPECT_CALL(openGL, glVertexArrayVertexBuffer(_,_,_,_,_)).Times(numberOfRectanglesCalls + numberOfDynamicLinesCalls + 2*numberOfStaticLinesCalls);
+        EXPECT_CALL(openGL, glVertexArrayAttribBinding(_,_,_)).Times(4*numberOfRectanglesCalls + 3*(numberOfDynamicLinesCalls + numberOfStaticLinesCalls));
 
-        EXPECT_CALL(openGL, glEnableVertexArrayAttrib(_,_)).Times(3*(numberOfRectanglesCalls + numberOfLinesCalls));
-        EXPECT_CALL(openGL, glVertexArrayAttribFormat(_,_,_,_,_,_)).Times(3*(numberOfRectanglesCalls + numberOfLinesCalls));
-        EXPECT_CALL(openGL, glVertexArrayVertexBuffer(_,_,_,_,_)).Times(2*(numberOfRectanglesCalls + numberOfLinesCalls));
-        EXPECT_CALL(openGL, glVertexArrayAttribBinding(_,_,_)).Times(3*(numberOfRectanglesCalls + numberOfLinesCalls));
+        EXPECT_CALL(openGL, glMapNamedBufferRange(_,_,_,_)).Times(numberOfStaticLinesCalls + numberOfDrawCommandTables + 2);
+        EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times(0);
+        EXPECT_CALL(openGL, glVertexArrayBindingDivisor(_,_,_)).Times(numberOfRectanglesCalls + numberOfDynamicLinesCalls + numberOfStaticLinesCalls);
+    }
 
-        EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times((numberOfRectanglesCalls));
-        EXPECT_CALL(openGL, glVertexArrayBindingDivisor(_,_,_)).Times((numberOfRectanglesCalls + numberOfLinesCalls));
+    // the spectrum is uploaded once and max hold values are calculated by the compute pass
+    void expectDbfsUpdate()
+    {
+        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(1);
+        EXPECT_CALL(openGL, glProgramUniform1ui(_,_,_)).Times(3 + 2*maxHoldsCall);
+        EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(1 + maxHoldsCall);
+        EXPECT_CALL(openGL, glBindBufferBase(GL_SHADER_STORAGE_BUFFER,_,_)).Times(1 + maxHoldsCall);
+        EXPECT_CALL(openGL, glDispatchCompute(1,1,1)).Times(maxHoldsCall);
+        EXPECT_CALL(openGL, glMemoryBarrier(_)).Times(1);
+        EXPECT_CALL(openGL, glCopyNamedBufferSubData(_,_,_,_,_)).Times(1);
     }
 
+    // layers which do not change are rendered into the texture in the first frame only
+    void expectRenderingOfStaticLayers(const WindowSize &windowSize)
+    {
+        InSequence s;
+
+        EXPECT_CALL(openGL, glCreateTextures(GL_TEXTURE_2D,1,_)).Times(1);
+        EXPECT_CALL(openGL, glTextureStorage2D(_,1,GL_RGBA8,windowSize.x,windowSize.y)).Times(1);
+        EXPECT_CALL(openGL, glCreateFramebuffers(1,_)).Times(1);
+        EXPECT_CALL(openGL, glNamedFramebufferTexture(_,GL_COLOR_ATTACHMENT0,_,0)).Times(1);
+        EXPECT_CALL(openGL, glBindFramebuffer(GL_FRAMEBUFFER,::testing::Ne(0))).Times(1);
+        EXPECT_CALL(openGL, glViewport(0,0,windowSize.x,windowSize.y)).Times(1);
+        EXPECT_CALL(openGL, glClearNamedFramebufferfv(_,GL_COLOR,0,_)).Times(1);
+        EXPECT_CALL(openGL, glBlendFuncSeparate(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA,GL_ONE,GL_ONE_MINUS_SRC_ALPHA)).Times(1);
+        EXPECT_CALL(text, drawQueued()).Times(1);
+        EXPECT_CALL(openGL, glBlendFuncSeparate(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA,GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA)).Times(1);
+        EXPECT_CALL(openGL, glBindFramebuffer(GL_FRAMEBUFFER,0)).Times(1);
+        EXPECT_CALL(openGL, glViewport(0,0,windowSize.x,windowSize.y)).Times(1);
+    }
+
+    void expectDrawOfStaticLayers()
+    {
+        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(1);
+        EXPECT_CALL(openGL, glBindVertexArray(_)).Times(1);
+        EXPECT_CALL(openGL, glBindTextureUnit(0,_)).Times(1);
+        EXPECT_CALL(openGL, glDrawArrays(GL_TRIANGLES,0,3)).Times(1);
+    }
+
+    // bars and dynamic max hold rectangles are drawn by one multi-draw
     void expectDraw(const uint32_t numberOfRectangles, const bool additionalRectanglesEnabled)
     {
-        const uint32_t numberOfRectanglesCalls = (additionalRectanglesEnabled ? (rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + smallRectanglesCall) : (rectanglesCall))+backgroundCall;
+        const uint32_t numberOfRectanglesCalls = (additionalRectanglesEnabled ? (rectanglesCall + dynamicMaxholdSecondaryRectanglesCall) : (rectanglesCall))+backgroundCall;
         const uint32_t timeUpdateCall = (rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + backgroundCall);
+        const uint32_t dbfsUpdateCall{1};
 
         EXPECT_CALL(openGL, glClear(_)).Times(1);
         EXPECT_CALL(windowBase, getWindowSize).WillOnce(Return(WindowSize{1024,768}));
-        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(timeUpdateCall+numberOfRectanglesCalls);
-        EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(timeUpdateCall);
-
-        EXPECT_CALL(openGL, glBindVertexArray(_)).Times(numberOfRectanglesCalls);
-
-        EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times((numberOfRectanglesCalls)).RetiresOnSaturation();
-        EXPECT_CALL(openGL, glDrawArraysInstanced(_,_,_,_)).Times((numberOfRectanglesCalls));
+        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(dbfsUpdateCall+numberOfRectanglesCalls+staticLayerCacheCall);
+        EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(1+maxHoldsCall+timeUpdateCall);
+        EXPECT_CALL(openGL, glDispatchCompute(_,_,_)).Times(maxHoldsCall);
+
+        EXPECT_CALL(openGL, glBindVertexArray(_)).Times(numberOfRectanglesCalls+staticLayerCacheCall);
+        expectRenderingOfStaticLayers(WindowSize{1024,768});
+        EXPECT_CALL(openGL, glDrawArrays(GL_TRIANGLES,0,3)).Times(staticLayerCacheCall);
+
+        EXPECT_CALL(openGL, glVertexArrayVertexBuffer(_,dbfsBinding,_,0,sizeof(float))).Times((numberOfRectanglesCalls));
+        EXPECT_CALL(openGL, glBindBuffer(GL_DRAW_INDIRECT_BUFFER,_)).Times((numberOfRectanglesCalls));
+        EXPECT_CALL(openGL, glMultiDrawArraysIndirect(GL_TRIANGLE_FAN,_,_,0)).Times((numberOfRectanglesCalls));
+        EXPECT_CALL(openGL, glDrawArraysInstanced(_,_,_,_)).Times(0);
+        EXPECT_CALL(openGL, glClientWaitSync(_,_,_)).Times(0);
         EXPECT_CALL(windowBase, getCursorPosition()).WillOnce(Return(CursorPosition{0,0}));
         EXPECT_CALL(windowBase, swapBuffers()).Times(1);
     }
 
-    void expectDraw(const std::vector<float> &positions, const bool additionalRectanglesEnabled)
+    void expectDrawOfRectangles(const uint32_t numberOfLayers)
+    {
+        EXPECT_CALL(openGL, glVertexArrayVertexBuffer(_,dbfsBinding,_,0,sizeof(float))).Times(1);
+        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(1);
+        EXPECT_CALL(openGL, glBindVertexArray(_)).Times(1);
+        EXPECT_CALL(openGL, glBindBuffer(GL_DRAW_INDIRECT_BUFFER,_)).Times(1);
+        EXPECT_CALL(openGL, glMultiDrawArraysIndirect(GL_TRIANGLE_FAN,_,numberOfLayers,0)).Times(1);
+    }
+
+    void expectDraw(const std::vector<float> &dBFs, const bool additionalRectanglesEnabled)
     {
         const uint32_t backgroundCall{1};
-        const uint32_t numberOfRectangles = positions.size();
-        const uint32_t numberOfSmallRectangles = positions.size();
+        const uint32_t barsAndDynamicMaxHoldLayers{2};
+
+        expectDbfsUpdate();
 
         InSequence s;
 
         EXPECT_CALL(windowBase, getWindowSize).WillOnce(Return(WindowSize{1024,768}));
         EXPECT_CALL(openGL, glClear(_)).Times(1);
 
-        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(rectanglesCall);
-        EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(rectanglesCall);
-
-        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(dynamicMaxholdSecondaryRectanglesCall);
-        EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(dynamicMaxholdSecondaryRectanglesCall);
-
-        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(backgroundCall);
-        EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(backgroundCall);
+        EXPECT_CALL(openGL, glProgramUniform1f(_,_,_)).Times(rectanglesCall + dynamicMaxholdSecondaryRectanglesCall + backgroundCall);
 
-        EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times(backgroundCall);
-        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(backgroundCall);
-        EXPECT_CALL(openGL, glBindVertexArray(_)).Times(backgroundCall);
-        EXPECT_CALL(openGL, glDrawArraysInstanced(_,_,_,_)).Times(backgroundCall);
+        expectDrawOfRectangles(backgroundCall);
+        expectRenderingOfStaticLayers(WindowSize{1024,768});
+        expectDrawOfStaticLayers();
 
         EXPECT_CALL(windowBase, getCursorPosition()).WillOnce(Return(CursorPosition{0,0}));
 
 
         if(additionalRectanglesEnabled)
         {
-            EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times(dynamicMaxholdSecondaryRectanglesCall);
-            EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(dynamicMaxholdSecondaryRectanglesCall);
-            EXPECT_CALL(openGL, glBindVertexArray(_)).Times(dynamicMaxholdSecondaryRectanglesCall);
-            EXPECT_CALL(openGL, glDrawArraysInstanced(_,_,_,_)).Times(dynamicMaxholdSecondaryRectanglesCall);
+            expectDrawOfRectangles(dynamicMaxholdSecondaryRectanglesCall);
         }
 
-        EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_))
-            .Times(rectanglesCall)
-            .WillOnce([positions](GLuint, GLintptr, GLsizeiptr size, const void* data)
+        EXPECT_CALL(openGL, glVertexArrayVertexBuffer(_,dbfsBinding,_,0,sizeof(float))).Times(1);
+        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(1);
+        EXPECT_CALL(openGL, glBindVertexArray(_)).Times(1);
+        EXPECT_CALL(openGL, glBindBuffer(GL_DRAW_INDIRECT_BUFFER,_)).Times(1);
+        EXPECT_CALL(openGL, glMultiDrawArraysIndirect(GL_TRIANGLE_FAN,_,barsAndDynamicMaxHoldLayers,0))
+            .WillOnce([this, dBFs, additionalRectanglesEnabled](GLenum, const void *indirect, GLsizei, GLsizei)
             {
-                EXPECT_EQ(positions.size() * sizeof(Instance), size);
+                const auto *commands = static_cast<const DrawArraysIndirectCommand*>(openGL.getCommandsOfBoundIndirectBuffer(indirect));
+                const auto &bars = commands[0];
+                const auto &dynamicMaxHold = commands[1];
 
-                const auto* instancesPtr = static_cast<const Instance*>(data);
+                EXPECT_EQ(dBFs.size(), bars.instanceCount);
+                EXPECT_EQ(0, bars.first);
+                EXPECT_EQ(additionalRectanglesEnabled ? dBFs.size() : 0, dynamicMaxHold.instanceCount);
+                EXPECT_EQ(4, dynamicMaxHold.first);
 
-                for(uint16_t i=0;i<positions.size();++i)
+                const auto* dBFsPtr = static_cast<const float*>(openGL.getInstancesOfBoundVertexArray(dbfsBinding, bars.baseInstance));
+
+                for(uint16_t i=0;i<dBFs.size();++i)
                 {
-                    EXPECT_NEAR(instancesPtr[i].y, positions.at(i), 0.001);
+                    EXPECT_NEAR(dBFsPtr[i], dBFs.at(i), 0.05);
                 }
             });
 
-        EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(rectanglesCall);
-        EXPECT_CALL(openGL, glBindVertexArray(_)).Times(rectanglesCall);
-        EXPECT_CALL(openGL, glDrawArraysInstanced(_,_,_,_)).Times(rectanglesCall);
-
-        if(additionalRectanglesEnabled)
-        {
-            EXPECT_CALL(openGL, glNamedBufferSubData(_,_,_,_)).Times(smallRectanglesCall);
-            EXPECT_CALL(openGL, glBindProgramPipeline(_)).Times(smallRectanglesCall);
-            EXPECT_CALL(openGL, glBindVertexArray(_)).Times(smallRectanglesCall);
-            EXPECT_CALL(openGL, glDrawArraysInstanced(_,_,_,_)).Times(smallRectanglesCall);
-        }
-
         EXPECT_CALL(windowBase, swapBuffers()).Times(1);
     }
 
@@ -194,8 +243,11 @@ struct WindowTestsBase
 
     void expectDestroyWindow()
     {
-        EXPECT_CALL(openGL, glDeleteProgramPipelines(_,_)).Times(4);
-        EXPECT_CALL(openGL, glDeleteProgram(_)).Times(8);
+        EXPECT_CALL(openGL, glDeleteProgramPipelines(_,_)).Times(7);
+        EXPECT_CALL(openGL, glDeleteProgram(_)).Times(13);
+        EXPECT_CALL(openGL, glDeleteVertexArrays(1,_)).Times(1);
+        EXPECT_CALL(openGL, glDeleteFramebuffers(1,_)).Times(1);
+        EXPECT_CALL(openGL, glDeleteTextures(1,_)).Times(1);
         EXPECT_CALL(text, finalize()).Times(1);
     }
 
@@ -0,0 +1,38 @@
+# DO NOT EDIT THIS FILE, IT IS USED ONLY IN TESTS
+# Copyright (C) 2024-2026, Sylwester Kominek
+# This file is part of SpectrumAnalyzer program licensed under GPLv2 or later,
+# see file LICENSE in this source tree.
+
+import array
+import math
+
+# Both layouts accepted by getStereoData are exercised, the sampling rate selects one of them.
+# Other rates return raw int16 PCM as bytes or 8-bit samples, which are rejected.
+def initialize(dataLength, samplingRate):
+    global numberOfSamples
+    global interleaved
+    global sampleType
+
+    numberOfSamples = dataLength
+    interleaved = samplingRate in (48000, 16000, 8000)
+    sampleType = {16000: 'bytes', 8000: 'b'}.get(samplingRate, 'h')
+
+    return True
+
+def getStereoData():
+
+    left = [32767 * math.sin(2 * math.pi * n / 16) for n in range(numberOfSamples)]
+    right = [-0.5 * value for value in left]
+
+    if interleaved:
+        samples = array.array('h', [0] * (2 * numberOfSamples))
+        samples[0::2] = array.array('h', [round(value) for value in left])
+        samples[1::2] = array.array('h', [round(value) for value in right])
+
+        if sampleType == 'bytes':
+            return samples.tobytes()
+        if sampleType == 'b':
+            return array.array('b', [value >> 8 for value in samples])
+        return samples
+
+    return (array.array('f', left), array.array('d', right))